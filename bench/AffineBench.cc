@@ -0,0 +1,116 @@
+# include "BenchUtils.hh"
+# include "Affine2.hh"
+# include "Matrix4.hh"
+
+namespace utils {
+  namespace bench {
+
+    template <typename CoordinateType>
+    Affine2<CoordinateType>
+    benchTransform() {
+      return Affine2<CoordinateType>(
+        CoordinateType(2), CoordinateType(-1),
+        CoordinateType(1), CoordinateType(3),
+        CoordinateType(12), CoordinateType(-7)
+      );
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_AffinePointsLoop(benchmark::State& state) {
+      const auto points = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Affine2<CoordinateType> t = benchTransform<CoordinateType>();
+      std::vector<Vector2<CoordinateType>> out(points.size());
+
+      for (auto _ : state) {
+        for (std::size_t id = 0u ; id < points.size() ; ++id) {
+          out[id] = t.transform(points[id]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_AffinePointsBatch(benchmark::State& state) {
+      const auto points = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Affine2<CoordinateType> t = benchTransform<CoordinateType>();
+      std::vector<Vector2<CoordinateType>> out(points.size());
+
+      for (auto _ : state) {
+        t.transform(points.data(), points.size(), out.data());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    void
+    BM_AffinePointsSoA(benchmark::State& state) {
+      Vector2Batch<float> points(randomVectors<float>(static_cast<std::size_t>(state.range(0))));
+      // Alternate with the inverse so that values stay bounded.
+      const Affine2f t = Affine2f::rotation(0.3f);
+      Affine2f inv;
+      t.invert(inv);
+
+      bool forward = true;
+      for (auto _ : state) {
+        (forward ? t : inv).transform(points);
+        forward = !forward;
+        benchmark::DoNotOptimize(points.x());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_AffineBoxes(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Affine2<CoordinateType> t = benchTransform<CoordinateType>();
+      std::vector<Box<CoordinateType>> out(boxes.size());
+
+      for (auto _ : state) {
+        t.transform(boxes.data(), boxes.size(), out.data());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    void
+    BM_Matrix4Points(benchmark::State& state) {
+      const auto points = randomVectors<float>(static_cast<std::size_t>(state.range(0)));
+      std::vector<Vector3f> in;
+      in.reserve(points.size());
+      for (const Vector2f& p : points) {
+        in.emplace_back(p.x(), p.y(), p.x() - p.y());
+      }
+      const Matrix4f m = Matrix4f::translation(Vector3f(1.0f, 2.0f, 3.0f)) * Matrix4f::scaling(Vector3f(2.0f, 0.5f, 4.0f));
+      std::vector<Vector3f> out(in.size());
+
+      for (auto _ : state) {
+        m.transformPoints(in.data(), in.size(), out.data());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    BENCHMARK_TEMPLATE(BM_AffinePointsLoop, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_AffinePointsBatch, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_AffinePointsBatch, int)->Apply(batchSizes);
+    BENCHMARK(BM_AffinePointsSoA)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_AffineBoxes, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_AffineBoxes, int)->Apply(batchSizes);
+    BENCHMARK(BM_Matrix4Points)->Apply(batchSizes);
+
+  }
+}
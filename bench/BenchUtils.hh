@@ -0,0 +1,119 @@
+#ifndef    BENCH_UTILS_HH
+# define   BENCH_UTILS_HH
+
+# include <random>
+# include <vector>
+# include <type_traits>
+# include <benchmark/benchmark.h>
+# include "Box.hh"
+# include "Vector2.hh"
+
+namespace utils {
+  namespace bench {
+
+    /**
+     * @brief - The seed used by all generators so that successive runs of
+     *          the benchmarks process the exact same data.
+     */
+    constexpr unsigned kSeed = 0x5eed;
+
+    /**
+     * @brief - The extent of the world in which random elements are spread.
+     *          Chosen so that a reasonable fraction of boxes overlap.
+     */
+    constexpr float kWorldSize = 1000.0f;
+
+    /**
+     * @brief - Used to register the realistic batch sizes on a benchmark,
+     *          from `1K` up to `10M` elements.
+     * @param b - the benchmark to configure.
+     */
+    inline
+    void
+    batchSizes(benchmark::internal::Benchmark* b) {
+      b->RangeMultiplier(10)->Range(1000, 10000000);
+    }
+
+    /**
+     * @brief - Used to report both the throughput and the average time spent
+     *          for a single element in the batch processed by `state`.
+     * @param state - the benchmark state to update.
+     */
+    inline
+    void
+    reportPerElement(benchmark::State& state) {
+      const int64_t processed = state.iterations() * state.range(0);
+      state.SetItemsProcessed(processed);
+      state.counters["time/op"] = benchmark::Counter(
+        static_cast<double>(processed),
+        benchmark::Counter::kIsRate | benchmark::Counter::kInvert
+      );
+    }
+
+    /**
+     * @brief - Generates a uniformly distributed value in `[min; max]` with
+     *          a distribution matching the type of coordinate. Coordinates
+     *          which are not arithmetic types (such as `Fixed`) are drawn as
+     *          `float` values and converted.
+     */
+    template <typename CoordinateType>
+    CoordinateType
+    uniform(std::mt19937& rng, CoordinateType min, CoordinateType max) {
+      if constexpr (!std::is_arithmetic<CoordinateType>::value) {
+        return CoordinateType(uniform<float>(rng, static_cast<float>(min), static_cast<float>(max)));
+      }
+      else {
+        using Distribution = typename std::conditional<
+          std::is_integral<CoordinateType>::value,
+          std::uniform_int_distribution<CoordinateType>,
+          std::uniform_real_distribution<CoordinateType>
+        >::type;
+
+        return Distribution(min, max)(rng);
+      }
+    }
+
+    template <typename CoordinateType>
+    std::vector<Vector2<CoordinateType>>
+    randomVectors(std::size_t count) {
+      std::mt19937 rng(kSeed);
+      const CoordinateType extent = static_cast<CoordinateType>(kWorldSize);
+
+      std::vector<Vector2<CoordinateType>> out;
+      out.reserve(count);
+      for (std::size_t id = 0u ; id < count ; ++id) {
+        out.emplace_back(
+          uniform<CoordinateType>(rng, -extent, extent),
+          uniform<CoordinateType>(rng, -extent, extent)
+        );
+      }
+
+      return out;
+    }
+
+    template <typename CoordinateType>
+    std::vector<Box<CoordinateType>>
+    randomBoxes(std::size_t count) {
+      std::mt19937 rng(kSeed);
+      const CoordinateType extent = static_cast<CoordinateType>(kWorldSize);
+      const CoordinateType minDim = static_cast<CoordinateType>(1);
+      const CoordinateType maxDim = static_cast<CoordinateType>(kWorldSize / 10.0f);
+
+      std::vector<Box<CoordinateType>> out;
+      out.reserve(count);
+      for (std::size_t id = 0u ; id < count ; ++id) {
+        out.emplace_back(
+          uniform<CoordinateType>(rng, -extent, extent),
+          uniform<CoordinateType>(rng, -extent, extent),
+          uniform<CoordinateType>(rng, minDim, maxDim),
+          uniform<CoordinateType>(rng, minDim, maxDim)
+        );
+      }
+
+      return out;
+    }
+
+  }
+}
+
+#endif    /* BENCH_UTILS_HH */
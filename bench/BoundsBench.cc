@@ -0,0 +1,74 @@
+
+# include "BenchUtils.hh"
+# include "Bounds.hh"
+
+namespace utils {
+  namespace bench {
+
+    template <typename CoordinateType>
+    std::vector<Bounds<CoordinateType>>
+    randomBounds(std::size_t count) {
+      const auto boxes = randomBoxes<CoordinateType>(count);
+      return std::vector<Bounds<CoordinateType>>(boxes.cbegin(), boxes.cend());
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_BoundsIntersects(benchmark::State& state) {
+      const auto bounds = randomBounds<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Bounds<CoordinateType> query(Box<CoordinateType>(0, 0, 200, 200));
+
+      for (auto _ : state) {
+        std::size_t hits = 0u;
+        for (const auto& b : bounds) {
+          hits += query.intersects(b) ? 1u : 0u;
+        }
+        benchmark::DoNotOptimize(hits);
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_BoundsIntersect(benchmark::State& state) {
+      const auto bounds = randomBounds<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Bounds<CoordinateType> query(Box<CoordinateType>(0, 0, 200, 200));
+
+      for (auto _ : state) {
+        CoordinateType area = CoordinateType();
+        for (const auto& b : bounds) {
+          area += query.intersect(b).area();
+        }
+        benchmark::DoNotOptimize(area);
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_BoundsNearestPoint(benchmark::State& state) {
+      const auto points = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Bounds<CoordinateType> area(Box<CoordinateType>(0, 0, 200, 200));
+
+      for (auto _ : state) {
+        Vector2<CoordinateType> acc;
+        for (const auto& p : points) {
+          acc += area.getNearestPoint(p);
+        }
+        benchmark::DoNotOptimize(acc);
+      }
+
+      reportPerElement(state);
+    }
+
+    BENCHMARK_TEMPLATE(BM_BoundsIntersects, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BoundsIntersects, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BoundsIntersect, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BoundsIntersect, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BoundsNearestPoint, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BoundsNearestPoint, int)->Apply(batchSizes);
+
+  }
+}
@@ -0,0 +1,115 @@
+
+# include "BenchUtils.hh"
+
+namespace utils {
+  namespace bench {
+
+    template <typename CoordinateType>
+    void
+    BM_BoxIntersects(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Box<CoordinateType> query(0, 0, 200, 200);
+      const bool strict = (state.range(1) != 0);
+
+      for (auto _ : state) {
+        std::size_t hits = 0u;
+        for (const auto& box : boxes) {
+          hits += query.intersects(box, strict) ? 1u : 0u;
+        }
+        benchmark::DoNotOptimize(hits);
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_BoxIntersectsBottomLeft(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Box<CoordinateType> query(0, 0, 200, 200);
+
+      for (auto _ : state) {
+        std::size_t hits = 0u;
+        for (const auto& box : boxes) {
+          hits += query.intersectsBottomLeft(box) ? 1u : 0u;
+        }
+        benchmark::DoNotOptimize(hits);
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_BoxIntersect(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Box<CoordinateType> query(0, 0, 200, 200);
+
+      for (auto _ : state) {
+        CoordinateType area = CoordinateType();
+        for (const auto& box : boxes) {
+          area += query.intersect(box).area();
+        }
+        benchmark::DoNotOptimize(area);
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_BoxContainsPoint(benchmark::State& state) {
+      const auto points = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Box<CoordinateType> area(0, 0, 200, 200);
+
+      for (auto _ : state) {
+        std::size_t inside = 0u;
+        for (const auto& p : points) {
+          inside += area.contains(p) ? 1u : 0u;
+        }
+        benchmark::DoNotOptimize(inside);
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_BoxNearestPoint(benchmark::State& state) {
+      const auto points = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Box<CoordinateType> area(0, 0, 200, 200);
+
+      for (auto _ : state) {
+        Vector2<CoordinateType> acc;
+        for (const auto& p : points) {
+          acc += area.getNearestPoint(p);
+        }
+        benchmark::DoNotOptimize(acc);
+      }
+
+      reportPerElement(state);
+    }
+
+    inline
+    void
+    intersectsArgs(benchmark::internal::Benchmark* b) {
+      for (int64_t size = 1000 ; size <= 10000000 ; size *= 10) {
+        b->Args({size, 0});
+        b->Args({size, 1});
+      }
+      b->ArgNames({"n", "strict"});
+    }
+
+    BENCHMARK_TEMPLATE(BM_BoxIntersects, float)->Apply(intersectsArgs);
+    BENCHMARK_TEMPLATE(BM_BoxIntersects, int)->Apply(intersectsArgs);
+    BENCHMARK_TEMPLATE(BM_BoxIntersectsBottomLeft, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BoxIntersectsBottomLeft, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BoxIntersect, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BoxIntersect, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BoxContainsPoint, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BoxContainsPoint, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BoxNearestPoint, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BoxNearestPoint, int)->Apply(batchSizes);
+
+  }
+}
@@ -0,0 +1,67 @@
+# include "BenchUtils.hh"
+# include "BoxReduction.hh"
+
+namespace utils {
+  namespace bench {
+
+    template <typename CoordinateType>
+    void
+    BM_UnionOf(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const unsigned threads = static_cast<unsigned>(state.range(1));
+      Bounds<CoordinateType> out;
+
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(unionOf(boxes.data(), boxes.size(), out, threads));
+        benchmark::DoNotOptimize(out);
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_IntersectionOf(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const unsigned threads = static_cast<unsigned>(state.range(1));
+      Bounds<CoordinateType> out;
+
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(intersectionOf(boxes.data(), boxes.size(), out, threads));
+        benchmark::DoNotOptimize(out);
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_UnionArea(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const unsigned threads = static_cast<unsigned>(state.range(1));
+
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(unionArea(boxes.data(), boxes.size(), threads));
+      }
+
+      reportPerElement(state);
+    }
+
+    inline
+    void
+    reductionArgs(benchmark::internal::Benchmark* b) {
+      for (int64_t size = 1000 ; size <= 1000000 ; size *= 10) {
+        b->Args({size, 1});
+        b->Args({size, 0});
+      }
+      b->ArgNames({"n", "threads"});
+    }
+
+    BENCHMARK_TEMPLATE(BM_UnionOf, float)->Apply(reductionArgs)->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_UnionOf, int)->Apply(reductionArgs)->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_IntersectionOf, float)->Apply(reductionArgs)->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_UnionArea, float)->Apply(reductionArgs)->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_UnionArea, int)->Apply(reductionArgs)->UseRealTime();
+
+  }
+}
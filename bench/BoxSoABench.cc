@@ -0,0 +1,55 @@
+
+# include "BenchUtils.hh"
+# include "BoxSoA.hh"
+
+namespace utils {
+  namespace bench {
+
+    template <typename CoordinateType>
+    void
+    BM_BoxSoAIntersectsMany(benchmark::State& state) {
+      const BoxSoA<CoordinateType> boxes(randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0))));
+      const Box<CoordinateType> query(0, 0, 200, 200);
+      const bool strict = (state.range(1) != 0);
+      std::vector<std::uint8_t> mask(boxes.size());
+
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(intersectsMany(query, boxes, mask.data(), strict));
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_BoxSoAIntersectsBottomLeftMany(benchmark::State& state) {
+      const BoxSoA<CoordinateType> boxes(randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0))));
+      const Box<CoordinateType> query(0, 0, 200, 200);
+      std::vector<std::uint8_t> mask(boxes.size());
+
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(intersectsBottomLeftMany(query, boxes, mask.data()));
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    inline
+    void
+    intersectsManyArgs(benchmark::internal::Benchmark* b) {
+      for (int64_t size = 1000 ; size <= 10000000 ; size *= 10) {
+        b->Args({size, 0});
+        b->Args({size, 1});
+      }
+      b->ArgNames({"n", "strict"});
+    }
+
+    BENCHMARK_TEMPLATE(BM_BoxSoAIntersectsMany, float)->Apply(intersectsManyArgs);
+    BENCHMARK_TEMPLATE(BM_BoxSoAIntersectsMany, int)->Apply(intersectsManyArgs);
+    BENCHMARK_TEMPLATE(BM_BoxSoAIntersectsBottomLeftMany, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BoxSoAIntersectsBottomLeftMany, int)->Apply(batchSizes);
+
+  }
+}
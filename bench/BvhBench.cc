@@ -0,0 +1,67 @@
+
+# include "BenchUtils.hh"
+# include "Bvh.hh"
+
+namespace utils {
+  namespace bench {
+
+    template <typename CoordinateType>
+    void
+    BM_BvhBuild(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      Bvh<CoordinateType> bvh;
+
+      for (auto _ : state) {
+        bvh.build(boxes.data(), boxes.size());
+        benchmark::DoNotOptimize(bvh.size());
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_BvhQuery(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const auto queries = randomBoxes<CoordinateType>(1000u);
+      const Bvh<CoordinateType> bvh(boxes);
+
+      for (auto _ : state) {
+        std::size_t hits = 0u;
+        for (const auto& query : queries) {
+          bvh.forEachIntersecting(query, [&hits](std::size_t) { ++hits; });
+        }
+        benchmark::DoNotOptimize(hits);
+      }
+
+      state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_BvhNearest(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const auto points = randomVectors<CoordinateType>(1000u);
+      const Bvh<CoordinateType> bvh(boxes);
+
+      for (auto _ : state) {
+        std::size_t index = 0u;
+        float dist2 = 0.0f;
+        for (const auto& p : points) {
+          bvh.nearest(p, index, dist2);
+          benchmark::DoNotOptimize(index);
+        }
+      }
+
+      state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(points.size()));
+    }
+
+    BENCHMARK_TEMPLATE(BM_BvhBuild, float)->Apply(batchSizes)->Unit(benchmark::kMillisecond);
+    BENCHMARK_TEMPLATE(BM_BvhBuild, int)->Apply(batchSizes)->Unit(benchmark::kMillisecond);
+    BENCHMARK_TEMPLATE(BM_BvhQuery, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BvhQuery, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BvhNearest, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BvhNearest, int)->Apply(batchSizes);
+
+  }
+}
@@ -0,0 +1,104 @@
+# include "BenchUtils.hh"
+# include "SpaceFillingCurve.hh"
+
+namespace utils {
+  namespace bench {
+
+    void
+    BM_MortonEncode(benchmark::State& state) {
+      const auto points = randomVectors<int>(static_cast<std::size_t>(state.range(0)));
+      std::vector<std::uint64_t> out(points.size());
+
+      for (auto _ : state) {
+        for (std::size_t id = 0u ; id < points.size() ; ++id) {
+          out[id] = mortonEncode(points[id]);
+        }
+        benchmark::DoNotOptimize(out.data());
+      }
+
+      reportPerElement(state);
+    }
+
+    void
+    BM_HilbertEncode(benchmark::State& state) {
+      const auto points = randomVectors<int>(static_cast<std::size_t>(state.range(0)));
+      std::vector<std::uint64_t> out(points.size());
+
+      for (auto _ : state) {
+        for (std::size_t id = 0u ; id < points.size() ; ++id) {
+          out[id] = hilbertEncode(points[id]);
+        }
+        benchmark::DoNotOptimize(out.data());
+      }
+
+      reportPerElement(state);
+    }
+
+    template <Curve CurveType>
+    void
+    BM_CurveOrder(benchmark::State& state) {
+      const auto points = randomVectors<int>(static_cast<std::size_t>(state.range(0)));
+      std::vector<std::uint32_t> order;
+
+      for (auto _ : state) {
+        curveOrder(points.data(), points.size(), order, CurveType);
+        benchmark::DoNotOptimize(order.data());
+      }
+
+      reportPerElement(state);
+    }
+
+    /**
+     * @brief - Visits the tiles around each point of a batch in a large grid
+     *          stored in row-major order. The points are either in random
+     *          order (`0`) or sorted along the Morton (`1`) or Hilbert (`2`)
+     *          curve.
+     */
+    void
+    BM_TileLookup(benchmark::State& state) {
+      constexpr int kGridSize = 4096;
+
+      auto points = randomVectors<int>(static_cast<std::size_t>(state.range(0)));
+      for (Vector2i& p : points) {
+        p.x() = (p.x() + 1000) * (kGridSize - 3) / 2000 + 1;
+        p.y() = (p.y() + 1000) * (kGridSize - 3) / 2000 + 1;
+      }
+
+      if (state.range(1) > 0) {
+        sortByCurve(points.data(), points.size(), state.range(1) == 1 ? Curve::Morton : Curve::Hilbert);
+      }
+
+      std::vector<int> tiles(static_cast<std::size_t>(kGridSize) * kGridSize, 1);
+
+      for (auto _ : state) {
+        int sum = 0;
+        for (const Vector2i& p : points) {
+          for (int dy = -1 ; dy <= 1 ; ++dy) {
+            const int* row = tiles.data() + static_cast<std::size_t>(p.y() + dy) * kGridSize;
+            sum += row[p.x() - 1] + row[p.x()] + row[p.x() + 1];
+          }
+        }
+        benchmark::DoNotOptimize(sum);
+      }
+
+      reportPerElement(state);
+    }
+
+    inline
+    void
+    tileLookupArgs(benchmark::internal::Benchmark* b) {
+      for (int64_t order = 0 ; order <= 2 ; ++order) {
+        b->Args({100000, order});
+        b->Args({1000000, order});
+      }
+      b->ArgNames({"n", "order"});
+    }
+
+    BENCHMARK(BM_MortonEncode)->Apply(batchSizes);
+    BENCHMARK(BM_HilbertEncode)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_CurveOrder, Curve::Morton)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_CurveOrder, Curve::Hilbert)->Apply(batchSizes);
+    BENCHMARK(BM_TileLookup)->Apply(tileLookupArgs);
+
+  }
+}
@@ -0,0 +1,50 @@
+# include "BenchUtils.hh"
+# include "DirtyRegion.hh"
+
+namespace utils {
+  namespace bench {
+
+    /**
+     * @brief - Simulates the invalidations of a frame: many small boxes,
+     *          mostly clustered around a few widgets, are registered and
+     *          the region is then reset.
+     */
+    void
+    BM_DirtyRegionFrame(benchmark::State& state) {
+      const std::size_t count = static_cast<std::size_t>(state.range(0));
+      const std::size_t maxRects = static_cast<std::size_t>(state.range(1));
+
+      std::mt19937 rng(kSeed);
+      std::vector<Boxi> boxes;
+      boxes.reserve(count);
+      for (std::size_t id = 0u ; id < count ; ++id) {
+        const int widget = static_cast<int>(id % 8u) * 200;
+        boxes.emplace_back(
+          widget + uniform<int>(rng, 0, 100),
+          widget / 2 + uniform<int>(rng, 0, 100),
+          uniform<int>(rng, 1, 32),
+          uniform<int>(rng, 1, 32)
+        );
+      }
+
+      DirtyRegion region(maxRects);
+
+      for (auto _ : state) {
+        region.clear();
+        for (const Boxi& box : boxes) {
+          region.invalidate(box);
+        }
+        benchmark::DoNotOptimize(region.bounds().data());
+      }
+
+      state.counters["rects"] = static_cast<double>(region.size());
+      state.counters["pixels"] = static_cast<double>(region.area());
+      reportPerElement(state);
+    }
+
+    BENCHMARK(BM_DirtyRegionFrame)
+      ->ArgsProduct({{16, 128, 1024}, {8, 32, 128}})
+      ->ArgNames({"n", "maxRects"});
+
+  }
+}
@@ -0,0 +1,88 @@
+# include "BenchUtils.hh"
+# include "Fixed.hh"
+# include "Box.hh"
+# include "Vector2.hh"
+
+namespace utils {
+  namespace bench {
+
+    template <typename CoordinateType>
+    void
+    BM_FixedMulAdd(benchmark::State& state) {
+      const auto points = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const CoordinateType scale(0.5f);
+
+      for (auto _ : state) {
+        CoordinateType acc = CoordinateType();
+        for (const auto& p : points) {
+          acc += p.x() * scale + p.y();
+        }
+        benchmark::DoNotOptimize(acc);
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_FixedDivide(benchmark::State& state) {
+      const auto points = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      std::vector<CoordinateType> out(points.size());
+
+      for (auto _ : state) {
+        for (std::size_t id = 0u ; id < points.size() ; ++id) {
+          out[id] = points[id].x() / (points[id].y() + CoordinateType(2000.0f));
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_FixedVectorLength(benchmark::State& state) {
+      const auto points = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      std::vector<CoordinateType> out(points.size());
+
+      for (auto _ : state) {
+        for (std::size_t id = 0u ; id < points.size() ; ++id) {
+          // Scaled down so that the squared length fits the fixed point range.
+          out[id] = (points[id] / CoordinateType(16.0f)).length();
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_FixedBoxIntersects(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Box<CoordinateType> query(CoordinateType(0.0f), CoordinateType(0.0f), CoordinateType(200.0f), CoordinateType(200.0f));
+
+      for (auto _ : state) {
+        std::size_t hits = 0u;
+        for (const auto& box : boxes) {
+          hits += query.intersects(box) ? 1u : 0u;
+        }
+        benchmark::DoNotOptimize(hits);
+      }
+
+      reportPerElement(state);
+    }
+
+    BENCHMARK_TEMPLATE(BM_FixedMulAdd, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_FixedMulAdd, Fixed16)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_FixedDivide, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_FixedDivide, Fixed16)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_FixedVectorLength, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_FixedVectorLength, Fixed16)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_FixedBoxIntersects, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_FixedBoxIntersects, Fixed16)->Apply(batchSizes);
+
+  }
+}
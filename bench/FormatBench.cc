@@ -0,0 +1,67 @@
+
+# include "BenchUtils.hh"
+# include "Box.hh"
+
+namespace utils {
+  namespace bench {
+
+    template <typename CoordinateType>
+    void
+    BM_BoxToString(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+
+      for (auto _ : state) {
+        std::size_t total = 0u;
+        for (const auto& box : boxes) {
+          total += box.toString().size();
+        }
+        benchmark::DoNotOptimize(total);
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_BoxFormat(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      char buffer[kFormatBufferSize];
+
+      for (auto _ : state) {
+        std::size_t total = 0u;
+        for (const auto& box : boxes) {
+          total += box.format(buffer, sizeof(buffer));
+        }
+        benchmark::DoNotOptimize(total);
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_BoxEncode(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      std::vector<std::uint8_t> buffer(boxes.size() * Box<CoordinateType>::kEncodedSize);
+
+      for (auto _ : state) {
+        std::size_t offset = 0u;
+        for (const auto& box : boxes) {
+          offset += box.encode(buffer.data() + offset, buffer.size() - offset);
+        }
+        benchmark::DoNotOptimize(buffer.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    BENCHMARK_TEMPLATE(BM_BoxToString, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BoxToString, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BoxFormat, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BoxFormat, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BoxEncode, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_BoxEncode, int)->Apply(batchSizes);
+
+  }
+}
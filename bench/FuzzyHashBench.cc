@@ -0,0 +1,61 @@
+# include "BenchUtils.hh"
+# include "FuzzyHash.hh"
+
+namespace utils {
+  namespace bench {
+
+    /**
+     * @brief - Generates points snapped to a coarse grid so that a large
+     *          fraction of them are duplicates.
+     */
+    std::vector<Vector2f>
+    duplicatedPoints(std::size_t count) {
+      auto points = randomVectors<float>(count);
+      for (Vector2f& p : points) {
+        p = Vector2f(std::round(p.x() / 10.0f) * 10.0f, std::round(p.y() / 10.0f) * 10.0f + 0.001f);
+      }
+
+      return points;
+    }
+
+    void
+    BM_Dedupe(benchmark::State& state) {
+      const auto points = duplicatedPoints(static_cast<std::size_t>(state.range(0)));
+      std::vector<Vector2f> work;
+
+      for (auto _ : state) {
+        work = points;
+        benchmark::DoNotOptimize(dedupe(work.data(), work.size(), 0.01f));
+      }
+
+      reportPerElement(state);
+    }
+
+    void
+    BM_DedupeQuadratic(benchmark::State& state) {
+      const auto points = duplicatedPoints(static_cast<std::size_t>(state.range(0)));
+      const FuzzyHash<float> hasher(0.01f);
+      std::vector<Vector2f> kept;
+
+      for (auto _ : state) {
+        kept.clear();
+        for (const Vector2f& p : points) {
+          bool duplicate = false;
+          for (std::size_t id = 0u ; id < kept.size() && !duplicate ; ++id) {
+            duplicate = hasher.equal(kept[id], p);
+          }
+          if (!duplicate) {
+            kept.push_back(p);
+          }
+        }
+        benchmark::DoNotOptimize(kept.data());
+      }
+
+      reportPerElement(state);
+    }
+
+    BENCHMARK(BM_Dedupe)->RangeMultiplier(10)->Range(1000, 1000000);
+    BENCHMARK(BM_DedupeQuadratic)->RangeMultiplier(10)->Range(1000, 10000);
+
+  }
+}
@@ -0,0 +1,90 @@
+
+# include "BenchUtils.hh"
+# include "LocationBatchUtils.hh"
+
+namespace utils {
+  namespace bench {
+
+    template <typename CoordinateType>
+    void
+    BM_DistanceSquaredBatch(benchmark::State& state) {
+      const auto points = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const unsigned threads = static_cast<unsigned>(state.range(1));
+      const Vector2<CoordinateType> ref(12, -7);
+      std::vector<float> out(points.size());
+
+      for (auto _ : state) {
+        d2Batch(points.data(), points.size(), ref, out.data(), threads);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    void
+    BM_DistanceBatch(benchmark::State& state) {
+      const auto points = randomVectors<float>(static_cast<std::size_t>(state.range(0)));
+      const unsigned threads = static_cast<unsigned>(state.range(1));
+      const Point2f ref(12.0f, -7.0f);
+      std::vector<float> out(points.size());
+
+      for (auto _ : state) {
+        dBatch(points.data(), points.size(), ref, out.data(), threads);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    void
+    BM_ToDirectionBatch(benchmark::State& state) {
+      const auto starts = randomVectors<float>(static_cast<std::size_t>(state.range(0)));
+      const auto targets = randomVectors<float>(starts.size());
+      const unsigned threads = static_cast<unsigned>(state.range(1));
+      std::vector<Point2f> dirs(starts.size());
+      std::vector<float> dists(starts.size());
+
+      for (auto _ : state) {
+        const std::size_t valid = toDirectionBatch(starts.data(), targets.data(), starts.size(), dirs.data(), dists.data(), 0.0001f, threads);
+        benchmark::DoNotOptimize(valid);
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    void
+    BM_AngleFromDirectionBatch(benchmark::State& state) {
+      const auto dirs = randomVectors<float>(static_cast<std::size_t>(state.range(0)));
+      const unsigned threads = static_cast<unsigned>(state.range(1));
+      std::vector<float> out(dirs.size());
+
+      for (auto _ : state) {
+        angleFromDirectionBatch(dirs.data(), dirs.size(), out.data(), 0.0001f, threads);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    inline
+    void
+    batchArgs(benchmark::internal::Benchmark* b) {
+      for (int64_t size = 1000 ; size <= 10000000 ; size *= 10) {
+        b->Args({size, 1});
+        b->Args({size, 0});
+      }
+      b->ArgNames({"n", "threads"});
+    }
+
+    BENCHMARK_TEMPLATE(BM_DistanceSquaredBatch, float)->Apply(batchArgs)->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_DistanceSquaredBatch, int)->Apply(batchArgs)->UseRealTime();
+    BENCHMARK(BM_DistanceBatch)->Apply(batchArgs)->UseRealTime();
+    BENCHMARK(BM_ToDirectionBatch)->Apply(batchArgs)->UseRealTime();
+    BENCHMARK(BM_AngleFromDirectionBatch)->Apply(batchArgs)->UseRealTime();
+
+  }
+}
@@ -0,0 +1,148 @@
+
+# include "BenchUtils.hh"
+# include "LocationUtils.hh"
+# include "AngleUtils.hh"
+
+namespace utils {
+  namespace bench {
+
+    template <typename CoordinateType>
+    void
+    BM_Distance(benchmark::State& state) {
+      const auto points = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Vector2<CoordinateType> ref(12, -7);
+
+      for (auto _ : state) {
+        float total = 0.0f;
+        for (const auto& p : points) {
+          total += d(ref, p);
+        }
+        benchmark::DoNotOptimize(total);
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_DistanceSquared(benchmark::State& state) {
+      const auto points = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Vector2<CoordinateType> ref(12, -7);
+
+      for (auto _ : state) {
+        float total = 0.0f;
+        for (const auto& p : points) {
+          total += d2(ref, p);
+        }
+        benchmark::DoNotOptimize(total);
+      }
+
+      reportPerElement(state);
+    }
+
+    void
+    BM_AngleFromDirection(benchmark::State& state) {
+      const auto dirs = randomVectors<float>(static_cast<std::size_t>(state.range(0)));
+
+      for (auto _ : state) {
+        float total = 0.0f;
+        for (const auto& dir : dirs) {
+          total += angleFromDirection(dir.x(), dir.y());
+        }
+        benchmark::DoNotOptimize(total);
+      }
+
+      reportPerElement(state);
+    }
+
+    void
+    BM_IsInCone(benchmark::State& state) {
+      const auto points = randomVectors<float>(static_cast<std::size_t>(state.range(0)));
+      const Point2f o(1.0f, 2.0f);
+
+      for (auto _ : state) {
+        std::size_t inside = 0u;
+        for (const auto& p : points) {
+          inside += isInCone(o, 1.0f, 1.0f, 0.5f, p) ? 1u : 0u;
+        }
+        benchmark::DoNotOptimize(inside);
+      }
+
+      reportPerElement(state);
+    }
+
+    void
+    BM_ConeContains(benchmark::State& state) {
+      const auto points = randomVectors<float>(static_cast<std::size_t>(state.range(0)));
+      const Cone cone(Point2f(1.0f, 2.0f), 1.0f, 1.0f, 0.5f);
+
+      for (auto _ : state) {
+        std::size_t inside = 0u;
+        for (const auto& p : points) {
+          inside += cone.contains(p) ? 1u : 0u;
+        }
+        benchmark::DoNotOptimize(inside);
+      }
+
+      reportPerElement(state);
+    }
+
+    void
+    BM_ConeContainsBatch(benchmark::State& state) {
+      const auto points = randomVectors<float>(static_cast<std::size_t>(state.range(0)));
+      const Cone cone(Point2f(1.0f, 2.0f), 1.0f, 1.0f, 0.5f);
+      std::vector<std::uint8_t> mask(points.size());
+
+      for (auto _ : state) {
+        const std::size_t inside = cone.contains(points.data(), points.size(), mask.data());
+        benchmark::DoNotOptimize(inside);
+      }
+
+      reportPerElement(state);
+    }
+
+    void
+    BM_FastAtan2(benchmark::State& state) {
+      const auto dirs = randomVectors<float>(static_cast<std::size_t>(state.range(0)));
+
+      for (auto _ : state) {
+        float total = 0.0f;
+        for (const auto& dir : dirs) {
+          total += fastAtan2(dir.y(), dir.x());
+        }
+        benchmark::DoNotOptimize(total);
+      }
+
+      reportPerElement(state);
+    }
+
+    void
+    BM_ToDirection(benchmark::State& state) {
+      const auto points = randomVectors<float>(static_cast<std::size_t>(state.range(0)));
+      const Point2f s(1.0f, 2.0f);
+
+      for (auto _ : state) {
+        float xD, yD, dist, total = 0.0f;
+        for (const auto& t : points) {
+          toDirection(s, t, xD, yD, dist);
+          total += xD + yD + dist;
+        }
+        benchmark::DoNotOptimize(total);
+      }
+
+      reportPerElement(state);
+    }
+
+    BENCHMARK_TEMPLATE(BM_Distance, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Distance, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_DistanceSquared, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_DistanceSquared, int)->Apply(batchSizes);
+    BENCHMARK(BM_AngleFromDirection)->Apply(batchSizes);
+    BENCHMARK(BM_IsInCone)->Apply(batchSizes);
+    BENCHMARK(BM_ConeContains)->Apply(batchSizes);
+    BENCHMARK(BM_ConeContainsBatch)->Apply(batchSizes);
+    BENCHMARK(BM_FastAtan2)->Apply(batchSizes);
+    BENCHMARK(BM_ToDirection)->Apply(batchSizes);
+
+  }
+}
@@ -0,0 +1,65 @@
+# include "BenchUtils.hh"
+# include "PrimitiveArrays.hh"
+
+namespace utils {
+  namespace bench {
+
+    void
+    BM_ToTypeBoxesLoop(benchmark::State& state) {
+      const auto boxes = randomBoxes<int>(static_cast<std::size_t>(state.range(0)));
+      std::vector<Boxf> out(boxes.size());
+
+      for (auto _ : state) {
+        for (std::size_t id = 0u ; id < boxes.size() ; ++id) {
+          out[id] = Boxf(
+            static_cast<float>(boxes[id].x()),
+            static_cast<float>(boxes[id].y()),
+            static_cast<float>(boxes[id].w()),
+            static_cast<float>(boxes[id].h())
+          );
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    void
+    BM_ToTypeBoxes(benchmark::State& state) {
+      const auto boxes = randomBoxes<int>(static_cast<std::size_t>(state.range(0)));
+      std::vector<Boxf> out(boxes.size());
+
+      for (auto _ : state) {
+        toType(boxes.data(), boxes.size(), out.data());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    /**
+     * @brief - Inserting at the front of a vector relocates all the elements,
+     *          which is a single `memmove` for trivially copyable types.
+     */
+    void
+    BM_InsertFrontVector3(benchmark::State& state) {
+      std::vector<Vector3f> points(static_cast<std::size_t>(state.range(0)));
+
+      for (auto _ : state) {
+        points.insert(points.begin(), Vector3f(1.0f, 2.0f, 3.0f));
+        points.pop_back();
+        benchmark::DoNotOptimize(points.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    BENCHMARK(BM_ToTypeBoxesLoop)->Apply(batchSizes);
+    BENCHMARK(BM_ToTypeBoxes)->Apply(batchSizes);
+    BENCHMARK(BM_InsertFrontVector3)->Arg(1000)->Arg(100000);
+
+  }
+}
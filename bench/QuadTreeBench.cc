@@ -0,0 +1,68 @@
+
+# include "BenchUtils.hh"
+# include "QuadTree.hh"
+
+namespace utils {
+  namespace bench {
+
+    template <typename CoordinateType>
+    void
+    BM_QuadTreeMove(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const auto offsets = randomVectors<CoordinateType>(boxes.size());
+      const CoordinateType extent = static_cast<CoordinateType>(2.0f * kWorldSize);
+
+      QuadTree<CoordinateType> tree(Box<CoordinateType>(0, 0, extent, extent), 10u);
+      tree.reserve(boxes.size());
+
+      std::vector<typename QuadTree<CoordinateType>::ItemId> ids;
+      for (const auto& box : boxes) {
+        ids.push_back(tree.insert(box));
+      }
+
+      // Alternate small displacements so that entities oscillate around
+      // their initial position as they would in a simulation.
+      CoordinateType sign = 1;
+      for (auto _ : state) {
+        for (std::size_t id = 0u ; id < ids.size() ; ++id) {
+          Box<CoordinateType> box = boxes[id];
+          box.x() += sign * offsets[id].x() / CoordinateType(100);
+          box.y() += sign * offsets[id].y() / CoordinateType(100);
+          tree.move(ids[id], box);
+        }
+        sign = -sign;
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_QuadTreeQuery(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const auto queries = randomBoxes<CoordinateType>(1000u);
+      const CoordinateType extent = static_cast<CoordinateType>(2.0f * kWorldSize);
+
+      QuadTree<CoordinateType> tree(Box<CoordinateType>(0, 0, extent, extent), 10u);
+      for (const auto& box : boxes) {
+        tree.insert(box);
+      }
+
+      for (auto _ : state) {
+        std::size_t hits = 0u;
+        for (const auto& query : queries) {
+          tree.forEachIntersecting(query, [&hits](typename QuadTree<CoordinateType>::ItemId) { ++hits; });
+        }
+        benchmark::DoNotOptimize(hits);
+      }
+
+      state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+    }
+
+    BENCHMARK_TEMPLATE(BM_QuadTreeMove, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_QuadTreeMove, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_QuadTreeQuery, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_QuadTreeQuery, int)->Apply(batchSizes);
+
+  }
+}
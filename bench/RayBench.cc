@@ -0,0 +1,116 @@
+# include "BenchUtils.hh"
+# include "Ray2.hh"
+
+namespace utils {
+  namespace bench {
+
+    /**
+     * @brief - A line of sight crossing the whole world diagonally so that
+     *          the boxes are not trivially rejected.
+     */
+    template <typename CoordinateType>
+    Segment2<CoordinateType>
+    lineOfSight() {
+      const CoordinateType extent = static_cast<CoordinateType>(kWorldSize);
+      return Segment2<CoordinateType>(
+        Vector2<CoordinateType>(-extent, -extent / CoordinateType(2)),
+        Vector2<CoordinateType>(extent, extent / CoordinateType(3))
+      );
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_RayIntersectsLoop(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Ray2<CoordinateType> ray(lineOfSight<CoordinateType>());
+      std::vector<std::uint8_t> mask(boxes.size());
+
+      for (auto _ : state) {
+        for (std::size_t id = 0u ; id < boxes.size() ; ++id) {
+          mask[id] = ray.intersects(boxes[id], 1.0f) ? 1u : 0u;
+        }
+        benchmark::DoNotOptimize(mask.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_RayIntersectsMany(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Ray2<CoordinateType> ray(lineOfSight<CoordinateType>());
+      std::vector<std::uint8_t> mask(boxes.size());
+
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(intersectsMany(ray, boxes.data(), boxes.size(), mask.data(), 1.0f));
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_RayIntersectsManySoA(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const BoxSoA<CoordinateType> soa(boxes);
+      const Ray2<CoordinateType> ray(lineOfSight<CoordinateType>());
+      std::vector<std::uint8_t> mask(boxes.size());
+
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(intersectsMany(ray, soa, mask.data(), 1.0f));
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_SegmentIntersectsBox(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Segment2<CoordinateType> segment = lineOfSight<CoordinateType>();
+      std::vector<std::uint8_t> mask(boxes.size());
+
+      for (auto _ : state) {
+        for (std::size_t id = 0u ; id < boxes.size() ; ++id) {
+          mask[id] = segment.intersects(boxes[id]) ? 1u : 0u;
+        }
+        benchmark::DoNotOptimize(mask.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_SegmentIntersectsSegment(benchmark::State& state) {
+      const auto points = randomVectors<CoordinateType>(2u * static_cast<std::size_t>(state.range(0)));
+      const Segment2<CoordinateType> segment = lineOfSight<CoordinateType>();
+      std::vector<std::uint8_t> mask(points.size() / 2u);
+
+      for (auto _ : state) {
+        for (std::size_t id = 0u ; id < mask.size() ; ++id) {
+          mask[id] = segment.intersects(Segment2<CoordinateType>(points[2u * id], points[2u * id + 1u])) ? 1u : 0u;
+        }
+        benchmark::DoNotOptimize(mask.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    BENCHMARK_TEMPLATE(BM_RayIntersectsLoop, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_RayIntersectsMany, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_RayIntersectsManySoA, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_RayIntersectsMany, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_SegmentIntersectsBox, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_SegmentIntersectsBox, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_SegmentIntersectsSegment, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_SegmentIntersectsSegment, int)->Apply(batchSizes);
+
+  }
+}
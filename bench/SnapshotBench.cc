@@ -0,0 +1,75 @@
+
+# include <cstring>
+# include <sstream>
+# include "BenchUtils.hh"
+# include "Snapshot.hh"
+
+namespace utils {
+  namespace bench {
+
+    template <typename CoordinateType>
+    void
+    BM_SnapshotWrite(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+
+      for (auto _ : state) {
+        std::ostringstream out;
+        const bool ok = writeSnapshot(out, boxes);
+        benchmark::DoNotOptimize(ok);
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_SnapshotRead(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      std::ostringstream out;
+      writeSnapshot(out, boxes);
+      const std::string bytes = out.str();
+
+      std::vector<Box<CoordinateType>> loaded;
+      for (auto _ : state) {
+        std::istringstream in(bytes);
+        const bool ok = readSnapshot(in, loaded);
+        benchmark::DoNotOptimize(ok);
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_SnapshotView(benchmark::State& state) {
+      const auto boxes = randomBoxes<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      std::ostringstream out;
+      writeSnapshot(out, boxes);
+      const std::string bytes = out.str();
+
+      // Mimic a mapped file which is always suitably aligned.
+      std::vector<std::uint64_t> storage((bytes.size() + sizeof(std::uint64_t) - 1u) / sizeof(std::uint64_t));
+      std::memcpy(storage.data(), bytes.data(), bytes.size());
+
+      for (auto _ : state) {
+        const SnapshotView<Box<CoordinateType>> view(storage.data(), bytes.size());
+
+        CoordinateType total = CoordinateType();
+        for (const Box<CoordinateType>& box : view) {
+          total += box.w();
+        }
+        benchmark::DoNotOptimize(total);
+      }
+
+      reportPerElement(state);
+    }
+
+    BENCHMARK_TEMPLATE(BM_SnapshotWrite, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_SnapshotWrite, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_SnapshotRead, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_SnapshotRead, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_SnapshotView, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_SnapshotView, int)->Apply(batchSizes);
+
+  }
+}
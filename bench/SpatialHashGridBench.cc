@@ -0,0 +1,79 @@
+
+# include "BenchUtils.hh"
+# include "SpatialHashGrid.hh"
+
+namespace utils {
+  namespace bench {
+
+    template <typename CoordinateType>
+    void
+    BM_SpatialHashGridRebuild(benchmark::State& state) {
+      const auto points = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const unsigned threads = static_cast<unsigned>(state.range(1));
+      SpatialHashGrid<CoordinateType> grid(10.0f);
+
+      for (auto _ : state) {
+        grid.rebuild(points, threads);
+        benchmark::DoNotOptimize(grid.size());
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_SpatialHashGridRadius(benchmark::State& state) {
+      const auto points = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const auto queries = randomVectors<CoordinateType>(1000u);
+      SpatialHashGrid<CoordinateType> grid(10.0f);
+      grid.rebuild(points);
+
+      for (auto _ : state) {
+        std::size_t hits = 0u;
+        for (const auto& p : queries) {
+          grid.forEachInRadius(p, 10.0f, [&hits](std::size_t) { ++hits; });
+        }
+        benchmark::DoNotOptimize(hits);
+      }
+
+      state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_SpatialHashGridNearest(benchmark::State& state) {
+      const auto points = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const auto queries = randomVectors<CoordinateType>(1000u);
+      SpatialHashGrid<CoordinateType> grid(10.0f);
+      grid.rebuild(points);
+
+      std::vector<std::size_t> out;
+      for (auto _ : state) {
+        for (const auto& p : queries) {
+          grid.nearest(p, 8u, out);
+          benchmark::DoNotOptimize(out.data());
+        }
+      }
+
+      state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+    }
+
+    inline
+    void
+    rebuildArgs(benchmark::internal::Benchmark* b) {
+      for (int64_t size = 1000 ; size <= 10000000 ; size *= 10) {
+        b->Args({size, 1});
+        b->Args({size, 0});
+      }
+      b->ArgNames({"n", "threads"});
+    }
+
+    BENCHMARK_TEMPLATE(BM_SpatialHashGridRebuild, float)->Apply(rebuildArgs)->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_SpatialHashGridRebuild, int)->Apply(rebuildArgs)->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_SpatialHashGridRadius, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_SpatialHashGridRadius, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_SpatialHashGridNearest, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_SpatialHashGridNearest, int)->Apply(batchSizes);
+
+  }
+}
@@ -0,0 +1,119 @@
+# include "BenchUtils.hh"
+# include <cmath>
+# include "SweepAndPrune.hh"
+
+namespace utils {
+  namespace bench {
+
+    /**
+     * @brief - Generates boxes spread over an area growing with their count
+     *          so that each box overlaps a couple of others on average, as
+     *          in a typical scene, whatever the number of boxes.
+     */
+    inline
+    std::vector<Boxf>
+    sceneBoxes(std::size_t count) {
+      std::mt19937 rng(kSeed);
+      const float extent = 4.0f * std::sqrt(static_cast<float>(count));
+
+      std::vector<Boxf> out;
+      out.reserve(count);
+      for (std::size_t id = 0u ; id < count ; ++id) {
+        out.emplace_back(
+          uniform<float>(rng, -extent, extent),
+          uniform<float>(rng, -extent, extent),
+          uniform<float>(rng, 1.0f, 10.0f),
+          uniform<float>(rng, 1.0f, 10.0f)
+        );
+      }
+
+      return out;
+    }
+
+    /**
+     * @brief - Moves each box by a small random offset, as would happen
+     *          between two frames of a simulation.
+     */
+    inline
+    void
+    jitter(std::vector<Boxf>& boxes, std::mt19937& rng) {
+      for (Boxf& box : boxes) {
+        box.x() += uniform<float>(rng, -1.0f, 1.0f);
+        box.y() += uniform<float>(rng, -1.0f, 1.0f);
+      }
+    }
+
+    void
+    BM_BoxPairsNestedLoop(benchmark::State& state) {
+      const auto boxes = sceneBoxes(static_cast<std::size_t>(state.range(0)));
+      std::vector<SweepAndPrunef::Pair> out;
+
+      for (auto _ : state) {
+        out.clear();
+        for (std::size_t id = 0u ; id < boxes.size() ; ++id) {
+          for (std::size_t other = id + 1u ; other < boxes.size() ; ++other) {
+            if (boxes[id].intersects(boxes[other])) {
+              out.push_back(SweepAndPrunef::Pair{static_cast<std::uint32_t>(id), static_cast<std::uint32_t>(other)});
+            }
+          }
+        }
+        benchmark::DoNotOptimize(out.data());
+      }
+
+      reportPerElement(state);
+    }
+
+    void
+    BM_SweepAndPruneFull(benchmark::State& state) {
+      const auto boxes = sceneBoxes(static_cast<std::size_t>(state.range(0)));
+      const unsigned threads = static_cast<unsigned>(state.range(1));
+      std::vector<SweepAndPrunef::Pair> out(boxes.size() * 8u);
+      SweepAndPrunef sap;
+
+      for (auto _ : state) {
+        sap.clear();
+        benchmark::DoNotOptimize(sap.update(boxes.data(), boxes.size(), out.data(), out.size(), threads));
+      }
+
+      reportPerElement(state);
+    }
+
+    void
+    BM_SweepAndPruneIncremental(benchmark::State& state) {
+      auto boxes = sceneBoxes(static_cast<std::size_t>(state.range(0)));
+      const unsigned threads = static_cast<unsigned>(state.range(1));
+      std::vector<SweepAndPrunef::Pair> out(boxes.size() * 8u);
+      SweepAndPrunef sap;
+      std::mt19937 rng(kSeed);
+
+      sap.update(boxes.data(), boxes.size(), out.data(), out.size(), threads);
+
+      for (auto _ : state) {
+        state.PauseTiming();
+        jitter(boxes, rng);
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(sap.update(boxes.data(), boxes.size(), out.data(), out.size(), threads));
+      }
+
+      reportPerElement(state);
+    }
+
+    inline
+    void
+    sweepArgs(benchmark::internal::Benchmark* b) {
+      for (int64_t size = 1000 ; size <= 1000000 ; size *= 10) {
+        b->Args({size, 1});
+        b->Args({size, 0});
+      }
+      b->Args({200000, 1});
+      b->Args({200000, 0});
+      b->ArgNames({"n", "threads"});
+    }
+
+    BENCHMARK(BM_BoxPairsNestedLoop)->RangeMultiplier(10)->Range(1000, 10000);
+    BENCHMARK(BM_SweepAndPruneFull)->Apply(sweepArgs)->UseRealTime();
+    BENCHMARK(BM_SweepAndPruneIncremental)->Apply(sweepArgs)->UseRealTime();
+
+  }
+}
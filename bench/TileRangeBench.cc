@@ -0,0 +1,125 @@
+# include "BenchUtils.hh"
+# include "TileRange.hh"
+
+namespace utils {
+  namespace bench {
+
+    // A view panning over a world made of square tiles, moving by a few
+    // units each frame as a camera following a character would.
+    constexpr int kViewWidth = 1920;
+    constexpr int kViewHeight = 1080;
+    constexpr int kFrames = 256;
+
+    std::vector<Boxi>
+    panningViews() {
+      std::mt19937 rng(kSeed);
+      std::vector<Boxi> views;
+
+      Vector2i center(0, 0);
+      for (int id = 0 ; id < kFrames ; ++id) {
+        center.x() += uniform<int>(rng, -2, 12);
+        center.y() += uniform<int>(rng, -6, 6);
+        views.emplace_back(center.x(), center.y(), kViewWidth, kViewHeight);
+      }
+
+      return views;
+    }
+
+    /**
+     * @brief - Enumerates the tiles with a hand written loop over the tile
+     *          bounds, as a reference for the cost of the iterator.
+     */
+    void
+    BM_TilesCoveringLoop(benchmark::State& state) {
+      const auto views = panningViews();
+      const Sizei tile(static_cast<int>(state.range(0)), static_cast<int>(state.range(0)));
+
+      std::int64_t tiles = 0;
+      for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const Boxi& view : views) {
+          const Boundsi bounds = tilesCovering(view, tile).getTiles();
+          for (int y = bounds.getBottomBound() ; y < bounds.getTopBound() ; ++y) {
+            for (int x = bounds.getLeftBound() ; x < bounds.getRightBound() ; ++x) {
+              sum += x ^ y;
+              ++tiles;
+            }
+          }
+        }
+        benchmark::DoNotOptimize(sum);
+      }
+
+      state.SetItemsProcessed(tiles);
+    }
+
+    void
+    BM_TilesCovering(benchmark::State& state) {
+      const auto views = panningViews();
+      const Sizei tile(static_cast<int>(state.range(0)), static_cast<int>(state.range(0)));
+
+      std::int64_t tiles = 0;
+      for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const Boxi& view : views) {
+          for (const Vector2i& t : tilesCovering(view, tile)) {
+            sum += t.x() ^ t.y();
+            ++tiles;
+          }
+        }
+        benchmark::DoNotOptimize(sum);
+      }
+
+      state.SetItemsProcessed(tiles);
+    }
+
+    /**
+     * @brief - Streaming by visiting every tile of the view each frame and
+     *          checking whether it was already loaded.
+     */
+    void
+    BM_StreamTilesFull(benchmark::State& state) {
+      const auto views = panningViews();
+      const Sizei tile(static_cast<int>(state.range(0)), static_cast<int>(state.range(0)));
+
+      for (auto _ : state) {
+        std::int64_t loads = 0;
+        for (std::size_t id = 1u ; id < views.size() ; ++id) {
+          const TileRange previous = tilesCovering(views[id - 1u], tile);
+          for (const Vector2i& t : tilesCovering(views[id], tile)) {
+            loads += !previous.contains(t);
+          }
+        }
+        benchmark::DoNotOptimize(loads);
+      }
+
+      state.SetItemsProcessed(state.iterations() * (kFrames - 1));
+    }
+
+    void
+    BM_StreamTilesIncremental(benchmark::State& state) {
+      const auto views = panningViews();
+      const Sizei tile(static_cast<int>(state.range(0)), static_cast<int>(state.range(0)));
+
+      for (auto _ : state) {
+        std::int64_t loads = 0;
+        for (std::size_t id = 1u ; id < views.size() ; ++id) {
+          for (const Vector2i& t : tilesEntering(views[id - 1u], views[id], tile)) {
+            loads += t.x() | 1;
+          }
+          for (const Vector2i& t : tilesLeaving(views[id - 1u], views[id], tile)) {
+            loads -= t.y() | 1;
+          }
+        }
+        benchmark::DoNotOptimize(loads);
+      }
+
+      state.SetItemsProcessed(state.iterations() * (kFrames - 1));
+    }
+
+    BENCHMARK(BM_TilesCoveringLoop)->ArgName("tile")->Arg(16)->Arg(64);
+    BENCHMARK(BM_TilesCovering)->ArgName("tile")->Arg(16)->Arg(64);
+    BENCHMARK(BM_StreamTilesFull)->ArgName("tile")->Arg(16)->Arg(64);
+    BENCHMARK(BM_StreamTilesIncremental)->ArgName("tile")->Arg(16)->Arg(64);
+
+  }
+}
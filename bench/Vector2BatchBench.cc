@@ -0,0 +1,101 @@
+
+# include "BenchUtils.hh"
+# include "Vector2Batch.hh"
+
+namespace utils {
+  namespace bench {
+
+    template <typename CoordinateType>
+    void
+    BM_Vector2BatchNormalize(benchmark::State& state) {
+      const Vector2Batch<CoordinateType> source(randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0))));
+      Vector2Batch<CoordinateType> batch = source;
+      AlignedVector<CoordinateType> lengths(batch.size());
+
+      for (auto _ : state) {
+        batch.normalize(lengths.data());
+        benchmark::DoNotOptimize(lengths.data());
+
+        state.PauseTiming();
+        batch = source;
+        state.ResumeTiming();
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_Vector2BatchLength(benchmark::State& state) {
+      const Vector2Batch<CoordinateType> batch(randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0))));
+      AlignedVector<CoordinateType> lengths(batch.size());
+
+      for (auto _ : state) {
+        batch.length(lengths.data());
+        benchmark::DoNotOptimize(lengths.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_Vector2BatchAdd(benchmark::State& state) {
+      const Vector2Batch<CoordinateType> other(randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0))));
+      Vector2Batch<CoordinateType> batch(other.size());
+
+      for (auto _ : state) {
+        batch += other;
+        benchmark::DoNotOptimize(batch.x());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_Vector2BatchDot(benchmark::State& state) {
+      const Vector2Batch<CoordinateType> batch(randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0))));
+      const Vector2Batch<CoordinateType> other(randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0))));
+      AlignedVector<CoordinateType> out(batch.size());
+
+      for (auto _ : state) {
+        batch.dot(other, out.data());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_Vector2BatchCross(benchmark::State& state) {
+      const Vector2Batch<CoordinateType> batch(randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0))));
+      const Vector2Batch<CoordinateType> other(randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0))));
+      AlignedVector<CoordinateType> out(batch.size());
+
+      for (auto _ : state) {
+        batch.cross(other, out.data());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    BENCHMARK_TEMPLATE(BM_Vector2BatchNormalize, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector2BatchNormalize, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector2BatchLength, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector2BatchLength, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector2BatchAdd, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector2BatchAdd, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector2BatchDot, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector2BatchDot, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector2BatchCross, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector2BatchCross, int)->Apply(batchSizes);
+
+  }
+}
@@ -0,0 +1,108 @@
+
+# include "BenchUtils.hh"
+
+namespace utils {
+  namespace bench {
+
+    template <typename CoordinateType>
+    void
+    BM_Vector2Normalize(benchmark::State& state) {
+      const auto source = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      auto vectors = source;
+
+      for (auto _ : state) {
+        CoordinateType total = CoordinateType();
+        for (auto& v : vectors) {
+          total += v.normalize();
+        }
+        benchmark::DoNotOptimize(total);
+
+        // Restore the initial data so that each iteration normalizes
+        // vectors with a non unit length.
+        state.PauseTiming();
+        vectors = source;
+        state.ResumeTiming();
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_Vector2Length(benchmark::State& state) {
+      const auto vectors = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+
+      for (auto _ : state) {
+        CoordinateType total = CoordinateType();
+        for (const auto& v : vectors) {
+          total += v.length();
+        }
+        benchmark::DoNotOptimize(total);
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_Vector2Add(benchmark::State& state) {
+      const auto vectors = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+
+      for (auto _ : state) {
+        Vector2<CoordinateType> acc;
+        for (const auto& v : vectors) {
+          acc = acc + v;
+        }
+        benchmark::DoNotOptimize(acc);
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_Vector2Dot(benchmark::State& state) {
+      const auto vectors = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Vector2<CoordinateType> ref(3, 4);
+
+      for (auto _ : state) {
+        CoordinateType total = CoordinateType();
+        for (const auto& v : vectors) {
+          total += ref * v;
+        }
+        benchmark::DoNotOptimize(total);
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename CoordinateType>
+    void
+    BM_Vector2Cross(benchmark::State& state) {
+      const auto vectors = randomVectors<CoordinateType>(static_cast<std::size_t>(state.range(0)));
+      const Vector2<CoordinateType> ref(3, 4);
+
+      for (auto _ : state) {
+        CoordinateType total = CoordinateType();
+        for (const auto& v : vectors) {
+          total += ref ^ v;
+        }
+        benchmark::DoNotOptimize(total);
+      }
+
+      reportPerElement(state);
+    }
+
+    BENCHMARK_TEMPLATE(BM_Vector2Normalize, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector2Normalize, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector2Length, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector2Length, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector2Add, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector2Add, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector2Dot, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector2Dot, int)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector2Cross, float)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector2Cross, int)->Apply(batchSizes);
+
+  }
+}
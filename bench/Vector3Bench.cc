@@ -0,0 +1,89 @@
+# include "BenchUtils.hh"
+# include "Vector3.hh"
+# include "AlignedVector3.hh"
+
+namespace utils {
+  namespace bench {
+
+    template <typename VectorType>
+    std::vector<VectorType>
+    randomVectors3(std::size_t count) {
+      std::mt19937 rng(kSeed);
+
+      std::vector<VectorType> out;
+      out.reserve(count);
+      for (std::size_t id = 0u ; id < count ; ++id) {
+        out.emplace_back(
+          uniform<float>(rng, -kWorldSize, kWorldSize),
+          uniform<float>(rng, -kWorldSize, kWorldSize),
+          uniform<float>(rng, -kWorldSize, kWorldSize)
+        );
+      }
+
+      return out;
+    }
+
+    /**
+     * @brief - Simulates a simple lighting pass: for each surface element
+     *          described by a position and a normal, computes the diffuse
+     *          and specular terms for a single point light.
+     */
+    template <typename VectorType>
+    void
+    BM_Vector3Lighting(benchmark::State& state) {
+      const std::size_t count = static_cast<std::size_t>(state.range(0));
+      const auto positions = randomVectors3<VectorType>(count);
+      auto normals = randomVectors3<VectorType>(count);
+      for (VectorType& n : normals) {
+        n.normalize();
+      }
+
+      const VectorType light(10.0f, 200.0f, -30.0f);
+      const VectorType eye(0.0f, 0.0f, 500.0f);
+      std::vector<float> out(count);
+
+      for (auto _ : state) {
+        for (std::size_t id = 0u ; id < count ; ++id) {
+          const VectorType toLight = (light - positions[id]).normalized();
+          const VectorType toEye = (eye - positions[id]).normalized();
+          const float diffuse = std::max(normals[id] * toLight, 0.0f);
+
+          VectorType halfway = toLight + toEye;
+          halfway.normalize();
+          const float specular = std::max(normals[id] * halfway, 0.0f);
+
+          out[id] = diffuse + specular * specular;
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    template <typename VectorType>
+    void
+    BM_Vector3Cross(benchmark::State& state) {
+      const std::size_t count = static_cast<std::size_t>(state.range(0));
+      const auto lhs = randomVectors3<VectorType>(count);
+      const auto rhs = randomVectors3<VectorType>(count);
+      std::vector<VectorType> out(count);
+
+      for (auto _ : state) {
+        for (std::size_t id = 0u ; id < count ; ++id) {
+          out[id] = (lhs[id] ^ rhs[id]) * 0.5f + lhs[id];
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    BENCHMARK_TEMPLATE(BM_Vector3Lighting, Vector3f)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector3Lighting, AlignedVector3)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector3Cross, Vector3f)->Apply(batchSizes);
+    BENCHMARK_TEMPLATE(BM_Vector3Cross, AlignedVector3)->Apply(batchSizes);
+
+  }
+}
@@ -0,0 +1,90 @@
+# include "BenchUtils.hh"
+# include "VectorExpression.hh"
+
+namespace utils {
+  namespace bench {
+
+    // One step of an explicit integrator `p = p + v * dt - g * dt`, which
+    // is the typical expression building several temporaries.
+    constexpr float kTimeStep = 0.016f;
+
+    void
+    BM_IntegrateVectorsEager(benchmark::State& state) {
+      auto positions = randomVectors<float>(static_cast<std::size_t>(state.range(0)));
+      const auto velocities = randomVectors<float>(static_cast<std::size_t>(state.range(0)));
+      const Vector2f gravity(0.0f, -9.81f);
+
+      for (auto _ : state) {
+        for (std::size_t id = 0u ; id < positions.size() ; ++id) {
+          positions[id] = positions[id] + velocities[id] * kTimeStep - gravity * kTimeStep;
+        }
+        benchmark::DoNotOptimize(positions.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    void
+    BM_IntegrateVectorsLazy(benchmark::State& state) {
+      auto positions = randomVectors<float>(static_cast<std::size_t>(state.range(0)));
+      const auto velocities = randomVectors<float>(static_cast<std::size_t>(state.range(0)));
+      const Vector2f gravity(0.0f, -9.81f);
+
+      for (auto _ : state) {
+        for (std::size_t id = 0u ; id < positions.size() ; ++id) {
+          positions[id] = evaluate(lazy(positions[id]) + lazy(velocities[id]) * kTimeStep - lazy(gravity) * kTimeStep);
+        }
+        benchmark::DoNotOptimize(positions.data());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    /**
+     * @brief - The same step using the operators of `Vector2Batch`: each of
+     *          them is a pass over the batch and the scaled velocities need
+     *          a temporary batch.
+     */
+    void
+    BM_IntegrateBatchEager(benchmark::State& state) {
+      Vector2fBatch positions(randomVectors<float>(static_cast<std::size_t>(state.range(0))));
+      const Vector2fBatch velocities(randomVectors<float>(static_cast<std::size_t>(state.range(0))));
+      const Vector2fBatch gravity(std::vector<Vector2f>(positions.size(), Vector2f(0.0f, -9.81f)));
+      Vector2fBatch tmp;
+
+      for (auto _ : state) {
+        tmp = velocities;
+        tmp -= gravity;
+        tmp *= kTimeStep;
+        positions += tmp;
+        benchmark::DoNotOptimize(positions.x());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    void
+    BM_IntegrateBatchFused(benchmark::State& state) {
+      Vector2fBatch positions(randomVectors<float>(static_cast<std::size_t>(state.range(0))));
+      const Vector2fBatch velocities(randomVectors<float>(static_cast<std::size_t>(state.range(0))));
+      const Vector2f gravity(0.0f, -9.81f);
+
+      for (auto _ : state) {
+        assign(positions, lazy(positions) + lazy(velocities) * kTimeStep - lazy(gravity) * kTimeStep);
+        benchmark::DoNotOptimize(positions.x());
+        benchmark::ClobberMemory();
+      }
+
+      reportPerElement(state);
+    }
+
+    BENCHMARK(BM_IntegrateVectorsEager)->Apply(batchSizes);
+    BENCHMARK(BM_IntegrateVectorsLazy)->Apply(batchSizes);
+    BENCHMARK(BM_IntegrateBatchEager)->Apply(batchSizes);
+    BENCHMARK(BM_IntegrateBatchFused)->Apply(batchSizes);
+
+  }
+}
@@ -0,0 +1,180 @@
+#ifndef    AFFINE2_HH
+# define   AFFINE2_HH
+
+# include <cstddef>
+# include "Box.hh"
+# include "Vector2.hh"
+# include "Matrix3.hh"
+# include "Vector2Batch.hh"
+
+namespace utils {
+
+  /**
+   * @brief - A 2D affine transform mapping a point `(x, y)` to:
+   *            - `x' = a * x + b * y + tx`
+   *            - `y' = c * x + d * y + ty`
+   *          This is equivalent to a `Matrix3` with a last row of `(0, 0, 1)`
+   *          but only stores and computes what is needed. Composition uses
+   *          the same convention as matrices: `(t1 * t2).transform(p)` is
+   *          the same as `t1.transform(t2.transform(p))`.
+   */
+  template <typename CoordinateType>
+  class Affine2 {
+    public:
+
+      /**
+       * @brief - Creates an identity transform.
+       */
+      constexpr
+      Affine2() noexcept;
+
+      constexpr
+      Affine2(const CoordinateType& a,
+              const CoordinateType& b,
+              const CoordinateType& c,
+              const CoordinateType& d,
+              const CoordinateType& tx,
+              const CoordinateType& ty) noexcept;
+
+      constexpr const CoordinateType&
+      a() const noexcept;
+
+      constexpr const CoordinateType&
+      b() const noexcept;
+
+      constexpr const CoordinateType&
+      c() const noexcept;
+
+      constexpr const CoordinateType&
+      d() const noexcept;
+
+      constexpr const CoordinateType&
+      tx() const noexcept;
+
+      constexpr const CoordinateType&
+      ty() const noexcept;
+
+      constexpr bool
+      operator==(const Affine2<CoordinateType>& other) const noexcept;
+
+      constexpr bool
+      operator!=(const Affine2<CoordinateType>& other) const noexcept;
+
+      /**
+       * @brief - Compares the coefficients of this transform with the ones
+       *          of `other` using the `Comparison` policy, see `ComparisonUtils.hh`.
+       */
+      template <typename Comparison>
+      constexpr bool
+      equals(const Affine2<CoordinateType>& other) const noexcept;
+
+      /**
+       * @brief - Composes `this` transform with `other`: the result applies
+       *          `other` first and then `this`.
+       */
+      constexpr Affine2<CoordinateType>
+      operator*(const Affine2<CoordinateType>& other) const noexcept;
+
+      constexpr Affine2<CoordinateType>&
+      operator*=(const Affine2<CoordinateType>& other) noexcept;
+
+      constexpr CoordinateType
+      determinant() const noexcept;
+
+      /**
+       * @brief - Computes the inverse of this transform. Only meaningful for
+       *          floating point coordinates.
+       * @param out - output argument receiving the inverse. Left unchanged
+       *              if the transform is not invertible.
+       * @return - `true` if the transform could be inverted.
+       */
+      constexpr bool
+      invert(Affine2<CoordinateType>& out) const noexcept;
+
+      constexpr Vector2<CoordinateType>
+      transform(const Vector2<CoordinateType>& point) const noexcept;
+
+      /**
+       * @brief - Similar to `transform` but ignores the translation, which
+       *          is what should be used for directions.
+       */
+      constexpr Vector2<CoordinateType>
+      transformDirection(const Vector2<CoordinateType>& dir) const noexcept;
+
+      /**
+       * @brief - Transforms the input box and returns the smallest axis
+       *          aligned box enclosing the result. When the transform only
+       *          holds scaling and translation the result is exact.
+       */
+      constexpr Box<CoordinateType>
+      transform(const Box<CoordinateType>& box) const noexcept;
+
+      /**
+       * @brief - Batch version of `transform` for points. The `out` array
+       *          can be the same as `in`. Uses SSE or AVX when available for
+       *          `float` coordinates.
+       * @param in - the points to transform.
+       * @param count - the number of points.
+       * @param out - output array with room for at least `count` points.
+       */
+      void
+      transform(const Vector2<CoordinateType>* in,
+                std::size_t count,
+                Vector2<CoordinateType>* out) const noexcept;
+
+      /**
+       * @brief - Batch version of `transform` for boxes. The `out` array can
+       *          be the same as `in`. Also vectorized for `float` coordinates.
+       */
+      void
+      transform(const Box<CoordinateType>* in,
+                std::size_t count,
+                Box<CoordinateType>* out) const noexcept;
+
+      /**
+       * @brief - Transforms in place all the points of the batch.
+       */
+      void
+      transform(Vector2Batch<CoordinateType>& points) const noexcept;
+
+      constexpr Matrix3<CoordinateType>
+      toMatrix3() const noexcept;
+
+      static
+      constexpr Affine2<CoordinateType>
+      identity() noexcept;
+
+      static
+      constexpr Affine2<CoordinateType>
+      translation(const Vector2<CoordinateType>& offset) noexcept;
+
+      static
+      constexpr Affine2<CoordinateType>
+      scaling(const CoordinateType& sx, const CoordinateType& sy) noexcept;
+
+      /**
+       * @brief - Creates a counter-clockwise rotation of `angle` radians
+       *          around the origin.
+       */
+      static
+      Affine2<CoordinateType>
+      rotation(float angle) noexcept;
+
+    private:
+
+      CoordinateType m_a;
+      CoordinateType m_b;
+      CoordinateType m_c;
+      CoordinateType m_d;
+      CoordinateType m_tx;
+      CoordinateType m_ty;
+  };
+
+  using Affine2f = Affine2<float>;
+  using Affine2i = Affine2<int>;
+
+}
+
+# include "Affine2.hxx"
+
+#endif    /* AFFINE2_HH */
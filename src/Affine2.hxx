@@ -0,0 +1,461 @@
+#ifndef    AFFINE2_HXX
+# define   AFFINE2_HXX
+
+# include <cmath>
+# include "Affine2.hh"
+# include "ComparisonUtils.hh"
+# include "SimdUtils.hh"
+
+namespace utils {
+  namespace details {
+
+    template <typename T>
+    inline
+    constexpr T
+    affineAbs(const T& value) noexcept {
+      return (value < T(0) ? -value : value);
+    }
+
+    template <typename T>
+    inline
+    void
+    affinePointsKernel(const Affine2<T>& t,
+                       const Vector2<T>* in,
+                       Vector2<T>* out,
+                       std::size_t start,
+                       std::size_t count) noexcept
+    {
+      for (std::size_t id = start ; id < count ; ++id) {
+        out[id] = t.transform(in[id]);
+      }
+    }
+
+    template <typename T>
+    inline
+    void
+    affineBoxesKernel(const Affine2<T>& t,
+                      const Box<T>* in,
+                      Box<T>* out,
+                      std::size_t start,
+                      std::size_t count) noexcept
+    {
+      for (std::size_t id = start ; id < count ; ++id) {
+        out[id] = t.transform(in[id]);
+      }
+    }
+
+    template <typename T>
+    inline
+    void
+    affineSoAKernel(const Affine2<T>& t,
+                    T* x,
+                    T* y,
+                    std::size_t start,
+                    std::size_t count) noexcept
+    {
+      for (std::size_t id = start ; id < count ; ++id) {
+        const T px = x[id];
+        x[id] = t.a() * px + t.b() * y[id] + t.tx();
+        y[id] = t.c() * px + t.d() * y[id] + t.ty();
+      }
+    }
+
+# if defined(MATHS_UTILS_SIMD)
+
+    // The vector kernel reads and writes the points as a flat array of
+    // interleaved coordinates.
+    static_assert(sizeof(Vector2<float>) == 2u * sizeof(float), "Vector2f should be made of exactly two floats");
+
+    inline
+    void
+    affinePointsKernel(const Affine2<float>& t,
+                       const Vector2<float>* in,
+                       Vector2<float>* out,
+                       std::size_t start,
+                       std::size_t count) noexcept
+    {
+      const simd::FloatPack a = simd::broadcast(t.a());
+      const simd::FloatPack b = simd::broadcast(t.b());
+      const simd::FloatPack c = simd::broadcast(t.c());
+      const simd::FloatPack d = simd::broadcast(t.d());
+      const simd::FloatPack tx = simd::broadcast(t.tx());
+      const simd::FloatPack ty = simd::broadcast(t.ty());
+
+      std::size_t id = start;
+      for ( ; id + simd::kFloatWidth <= count ; id += simd::kFloatWidth) {
+        simd::FloatPack px, py;
+        simd::loadInterleaved(reinterpret_cast<const float*>(in + id), px, py);
+
+        simd::storeInterleaved(
+          reinterpret_cast<float*>(out + id),
+          simd::add(simd::add(simd::mul(a, px), simd::mul(b, py)), tx),
+          simd::add(simd::add(simd::mul(c, px), simd::mul(d, py)), ty)
+        );
+      }
+
+      affinePointsKernel<float>(t, in, out, id, count);
+    }
+
+    static_assert(sizeof(Box<float>) == 4u * sizeof(float), "Boxf should be made of exactly four floats");
+
+    inline
+    void
+    affineBoxesKernel(const Affine2<float>& t,
+                      const Box<float>* in,
+                      Box<float>* out,
+                      std::size_t start,
+                      std::size_t count) noexcept
+    {
+      // A box is stored as the pairs `(x, y)` and `(w, h)`: deinterleaving
+      // yields packs alternating centers and dimensions. The centers are
+      // transformed like points while the dimensions use the absolute value
+      // of the linear part and no translation, so the coefficients are set
+      // per lane to handle both at once.
+      float a[simd::kFloatWidth], b[simd::kFloatWidth], c[simd::kFloatWidth];
+      float d[simd::kFloatWidth], tx[simd::kFloatWidth], ty[simd::kFloatWidth];
+      for (std::size_t lane = 0u ; lane < simd::kFloatWidth ; lane += 2u) {
+        a[lane] = t.a(); a[lane + 1u] = affineAbs(t.a());
+        b[lane] = t.b(); b[lane + 1u] = affineAbs(t.b());
+        c[lane] = t.c(); c[lane + 1u] = affineAbs(t.c());
+        d[lane] = t.d(); d[lane + 1u] = affineAbs(t.d());
+        tx[lane] = t.tx(); tx[lane + 1u] = 0.0f;
+        ty[lane] = t.ty(); ty[lane + 1u] = 0.0f;
+      }
+
+      const simd::FloatPack pa = simd::load(a);
+      const simd::FloatPack pb = simd::load(b);
+      const simd::FloatPack pc = simd::load(c);
+      const simd::FloatPack pd = simd::load(d);
+      const simd::FloatPack ptx = simd::load(tx);
+      const simd::FloatPack pty = simd::load(ty);
+
+      constexpr std::size_t kBoxesPerPack = simd::kFloatWidth / 2u;
+
+      std::size_t id = start;
+      for ( ; id + kBoxesPerPack <= count ; id += kBoxesPerPack) {
+        simd::FloatPack xw, yh;
+        simd::loadInterleaved(reinterpret_cast<const float*>(in + id), xw, yh);
+
+        simd::storeInterleaved(
+          reinterpret_cast<float*>(out + id),
+          simd::add(simd::add(simd::mul(pa, xw), simd::mul(pb, yh)), ptx),
+          simd::add(simd::add(simd::mul(pc, xw), simd::mul(pd, yh)), pty)
+        );
+      }
+
+      affineBoxesKernel<float>(t, in, out, id, count);
+    }
+
+    inline
+    void
+    affineSoAKernel(const Affine2<float>& t,
+                    float* x,
+                    float* y,
+                    std::size_t start,
+                    std::size_t count) noexcept
+    {
+      const simd::FloatPack a = simd::broadcast(t.a());
+      const simd::FloatPack b = simd::broadcast(t.b());
+      const simd::FloatPack c = simd::broadcast(t.c());
+      const simd::FloatPack d = simd::broadcast(t.d());
+      const simd::FloatPack tx = simd::broadcast(t.tx());
+      const simd::FloatPack ty = simd::broadcast(t.ty());
+
+      std::size_t id = start;
+      for ( ; id + simd::kFloatWidth <= count ; id += simd::kFloatWidth) {
+        const simd::FloatPack px = simd::load(x + id);
+        const simd::FloatPack py = simd::load(y + id);
+
+        simd::store(x + id, simd::add(simd::add(simd::mul(a, px), simd::mul(b, py)), tx));
+        simd::store(y + id, simd::add(simd::add(simd::mul(c, px), simd::mul(d, py)), ty));
+      }
+
+      affineSoAKernel<float>(t, x, y, id, count);
+    }
+
+# endif
+
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr
+  Affine2<CoordinateType>::Affine2() noexcept:
+    m_a(CoordinateType(1)),
+    m_b(CoordinateType(0)),
+    m_c(CoordinateType(0)),
+    m_d(CoordinateType(1)),
+    m_tx(CoordinateType(0)),
+    m_ty(CoordinateType(0))
+  {}
+
+  template <typename CoordinateType>
+  inline
+  constexpr
+  Affine2<CoordinateType>::Affine2(const CoordinateType& a,
+                                   const CoordinateType& b,
+                                   const CoordinateType& c,
+                                   const CoordinateType& d,
+                                   const CoordinateType& tx,
+                                   const CoordinateType& ty) noexcept:
+    m_a(a),
+    m_b(b),
+    m_c(c),
+    m_d(d),
+    m_tx(tx),
+    m_ty(ty)
+  {}
+
+  template <typename CoordinateType>
+  inline
+  constexpr const CoordinateType&
+  Affine2<CoordinateType>::a() const noexcept {
+    return m_a;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr const CoordinateType&
+  Affine2<CoordinateType>::b() const noexcept {
+    return m_b;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr const CoordinateType&
+  Affine2<CoordinateType>::c() const noexcept {
+    return m_c;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr const CoordinateType&
+  Affine2<CoordinateType>::d() const noexcept {
+    return m_d;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr const CoordinateType&
+  Affine2<CoordinateType>::tx() const noexcept {
+    return m_tx;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr const CoordinateType&
+  Affine2<CoordinateType>::ty() const noexcept {
+    return m_ty;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr bool
+  Affine2<CoordinateType>::operator==(const Affine2<CoordinateType>& other) const noexcept {
+    return equals<typename DefaultComparison<CoordinateType>::Type>(other);
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr bool
+  Affine2<CoordinateType>::operator!=(const Affine2<CoordinateType>& other) const noexcept {
+    return !operator==(other);
+  }
+
+  template <typename CoordinateType>
+  template <typename Comparison>
+  inline
+  constexpr bool
+  Affine2<CoordinateType>::equals(const Affine2<CoordinateType>& other) const noexcept {
+    return
+      Comparison::equal(m_a, other.m_a) &&
+      Comparison::equal(m_b, other.m_b) &&
+      Comparison::equal(m_c, other.m_c) &&
+      Comparison::equal(m_d, other.m_d) &&
+      Comparison::equal(m_tx, other.m_tx) &&
+      Comparison::equal(m_ty, other.m_ty)
+    ;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Affine2<CoordinateType>
+  Affine2<CoordinateType>::operator*(const Affine2<CoordinateType>& other) const noexcept {
+    return Affine2<CoordinateType>(
+      m_a * other.m_a + m_b * other.m_c,
+      m_a * other.m_b + m_b * other.m_d,
+      m_c * other.m_a + m_d * other.m_c,
+      m_c * other.m_b + m_d * other.m_d,
+      m_a * other.m_tx + m_b * other.m_ty + m_tx,
+      m_c * other.m_tx + m_d * other.m_ty + m_ty
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Affine2<CoordinateType>&
+  Affine2<CoordinateType>::operator*=(const Affine2<CoordinateType>& other) noexcept {
+    *this = *this * other;
+    return *this;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr CoordinateType
+  Affine2<CoordinateType>::determinant() const noexcept {
+    return m_a * m_d - m_b * m_c;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr bool
+  Affine2<CoordinateType>::invert(Affine2<CoordinateType>& out) const noexcept {
+    const CoordinateType det = determinant();
+    if (fuzzyEqual(det, CoordinateType(0))) {
+      return false;
+    }
+
+    const CoordinateType a = m_d / det;
+    const CoordinateType b = -m_b / det;
+    const CoordinateType c = -m_c / det;
+    const CoordinateType d = m_a / det;
+
+    out = Affine2<CoordinateType>(
+      a,
+      b,
+      c,
+      d,
+      -(a * m_tx + b * m_ty),
+      -(c * m_tx + d * m_ty)
+    );
+
+    return true;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Vector2<CoordinateType>
+  Affine2<CoordinateType>::transform(const Vector2<CoordinateType>& point) const noexcept {
+    return Vector2<CoordinateType>(
+      m_a * point.x() + m_b * point.y() + m_tx,
+      m_c * point.x() + m_d * point.y() + m_ty
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Vector2<CoordinateType>
+  Affine2<CoordinateType>::transformDirection(const Vector2<CoordinateType>& dir) const noexcept {
+    return Vector2<CoordinateType>(
+      m_a * dir.x() + m_b * dir.y(),
+      m_c * dir.x() + m_d * dir.y()
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Box<CoordinateType>
+  Affine2<CoordinateType>::transform(const Box<CoordinateType>& box) const noexcept {
+    // The center of the box is mapped to the center of the enclosing box
+    // and each half extent contributes to both axes depending on how much
+    // the transform rotates or shears it.
+    return Box<CoordinateType>(
+      transform(Vector2<CoordinateType>(box.x(), box.y())),
+      details::affineAbs(m_a) * box.w() + details::affineAbs(m_b) * box.h(),
+      details::affineAbs(m_c) * box.w() + details::affineAbs(m_d) * box.h()
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Affine2<CoordinateType>::transform(const Vector2<CoordinateType>* in,
+                                     std::size_t count,
+                                     Vector2<CoordinateType>* out) const noexcept
+  {
+    details::affinePointsKernel(*this, in, out, 0u, count);
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Affine2<CoordinateType>::transform(const Box<CoordinateType>* in,
+                                     std::size_t count,
+                                     Box<CoordinateType>* out) const noexcept
+  {
+    details::affineBoxesKernel(*this, in, out, 0u, count);
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Affine2<CoordinateType>::transform(Vector2Batch<CoordinateType>& points) const noexcept {
+    details::affineSoAKernel(*this, points.x(), points.y(), 0u, points.size());
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Matrix3<CoordinateType>
+  Affine2<CoordinateType>::toMatrix3() const noexcept {
+    return Matrix3<CoordinateType>(
+      m_a, m_b, m_tx,
+      m_c, m_d, m_ty,
+      CoordinateType(0), CoordinateType(0), CoordinateType(1)
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Affine2<CoordinateType>
+  Affine2<CoordinateType>::identity() noexcept {
+    return Affine2<CoordinateType>();
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Affine2<CoordinateType>
+  Affine2<CoordinateType>::translation(const Vector2<CoordinateType>& offset) noexcept {
+    return Affine2<CoordinateType>(
+      CoordinateType(1),
+      CoordinateType(0),
+      CoordinateType(0),
+      CoordinateType(1),
+      offset.x(),
+      offset.y()
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Affine2<CoordinateType>
+  Affine2<CoordinateType>::scaling(const CoordinateType& sx, const CoordinateType& sy) noexcept {
+    return Affine2<CoordinateType>(
+      sx,
+      CoordinateType(0),
+      CoordinateType(0),
+      sy,
+      CoordinateType(0),
+      CoordinateType(0)
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  Affine2<CoordinateType>
+  Affine2<CoordinateType>::rotation(float angle) noexcept {
+    const CoordinateType cosA = static_cast<CoordinateType>(std::cos(angle));
+    const CoordinateType sinA = static_cast<CoordinateType>(std::sin(angle));
+
+    return Affine2<CoordinateType>(
+      cosA,
+      -sinA,
+      sinA,
+      cosA,
+      CoordinateType(0),
+      CoordinateType(0)
+    );
+  }
+
+}
+
+#endif    /* AFFINE2_HXX */
@@ -0,0 +1,74 @@
+#ifndef    ALIGNED_ALLOCATOR_HH
+# define   ALIGNED_ALLOCATOR_HH
+
+# include <cstddef>
+# include <vector>
+
+namespace utils {
+
+  /**
+   * @brief - The default alignment used for batch containers: wide enough
+   *          for a full AVX register so that kernels can use aligned loads.
+   */
+  constexpr std::size_t kDefaultBatchAlignment = 32u;
+
+  /**
+   * @brief - A minimal allocator returning memory aligned on `Alignment`
+   *          bytes. Meant to be used with standard containers to get data
+   *          suited for vectorized processing.
+   */
+  template <typename DataType, std::size_t Alignment = kDefaultBatchAlignment>
+  class AlignedAllocator {
+    public:
+
+      static_assert(Alignment >= alignof(DataType), "Alignment must be at least the natural alignment of the type");
+      static_assert((Alignment & (Alignment - 1u)) == 0u, "Alignment must be a power of two");
+
+      using value_type = DataType;
+
+      template <typename OtherDataType>
+      struct rebind {
+        using other = AlignedAllocator<OtherDataType, Alignment>;
+      };
+
+      AlignedAllocator() noexcept = default;
+
+      template <typename OtherDataType>
+      AlignedAllocator(const AlignedAllocator<OtherDataType, Alignment>& other) noexcept;
+
+      /**
+       * @brief - Allocates enough memory to hold `count` elements. The
+       *          returned pointer is aligned on `Alignment` bytes.
+       *          Throws `std::bad_alloc` in case the allocation fails.
+       * @param count - the number of elements to allocate.
+       * @return - a pointer to the allocated memory.
+       */
+      DataType*
+      allocate(std::size_t count);
+
+      void
+      deallocate(DataType* ptr, std::size_t count) noexcept;
+  };
+
+  template <typename DataType1, typename DataType2, std::size_t Alignment>
+  bool
+  operator==(const AlignedAllocator<DataType1, Alignment>& lhs,
+             const AlignedAllocator<DataType2, Alignment>& rhs) noexcept;
+
+  template <typename DataType1, typename DataType2, std::size_t Alignment>
+  bool
+  operator!=(const AlignedAllocator<DataType1, Alignment>& lhs,
+             const AlignedAllocator<DataType2, Alignment>& rhs) noexcept;
+
+  /**
+   * @brief - Convenience alias for a vector whose storage is aligned for
+   *          vectorized processing.
+   */
+  template <typename DataType>
+  using AlignedVector = std::vector<DataType, AlignedAllocator<DataType>>;
+
+}
+
+# include "AlignedAllocator.hxx"
+
+#endif    /* ALIGNED_ALLOCATOR_HH */
@@ -0,0 +1,62 @@
+#ifndef    ALIGNED_ALLOCATOR_HXX
+# define   ALIGNED_ALLOCATOR_HXX
+
+# include <new>
+# include <cstdlib>
+# include "AlignedAllocator.hh"
+
+namespace utils {
+
+  template <typename DataType, std::size_t Alignment>
+  template <typename OtherDataType>
+  inline
+  AlignedAllocator<DataType, Alignment>::AlignedAllocator(const AlignedAllocator<OtherDataType, Alignment>& /*other*/) noexcept
+  {}
+
+  template <typename DataType, std::size_t Alignment>
+  inline
+  DataType*
+  AlignedAllocator<DataType, Alignment>::allocate(std::size_t count) {
+    if (count == 0u) {
+      return nullptr;
+    }
+
+    // `aligned_alloc` requires the size to be a multiple of the alignment.
+    const std::size_t bytes = ((count * sizeof(DataType) + Alignment - 1u) / Alignment) * Alignment;
+
+    void* ptr = ::aligned_alloc(Alignment, bytes);
+    if (ptr == nullptr) {
+      throw std::bad_alloc();
+    }
+
+    return static_cast<DataType*>(ptr);
+  }
+
+  template <typename DataType, std::size_t Alignment>
+  inline
+  void
+  AlignedAllocator<DataType, Alignment>::deallocate(DataType* ptr, std::size_t /*count*/) noexcept {
+    ::free(ptr);
+  }
+
+  template <typename DataType1, typename DataType2, std::size_t Alignment>
+  inline
+  bool
+  operator==(const AlignedAllocator<DataType1, Alignment>& /*lhs*/,
+             const AlignedAllocator<DataType2, Alignment>& /*rhs*/) noexcept
+  {
+    return true;
+  }
+
+  template <typename DataType1, typename DataType2, std::size_t Alignment>
+  inline
+  bool
+  operator!=(const AlignedAllocator<DataType1, Alignment>& lhs,
+             const AlignedAllocator<DataType2, Alignment>& rhs) noexcept
+  {
+    return !(lhs == rhs);
+  }
+
+}
+
+#endif    /* ALIGNED_ALLOCATOR_HXX */
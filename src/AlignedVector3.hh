@@ -0,0 +1,148 @@
+#ifndef    ALIGNED_VECTOR_3_HH
+# define   ALIGNED_VECTOR_3_HH
+
+# include <string>
+# include <iostream>
+# include "Vector3.hh"
+
+namespace utils {
+
+  /**
+   * @brief - A single precision 3D vector padded with an unused fourth
+   *          coordinate and aligned on 16 bytes so that it fits exactly a
+   *          SSE register. Arithmetic operations are then mapped to single
+   *          instructions instead of three scalar ones, which matters for
+   *          code dominated by vector math (e.g. lighting computations).
+   *          Results are identical to the ones of `Vector3f` and the
+   *          padding lane never takes part in them.
+   *          When no SIMD instruction set is available the operations fall
+   *          back to scalar code.
+   */
+  class alignas(16) AlignedVector3 {
+    public:
+
+      explicit
+      AlignedVector3(float x = 0.0f,
+                     float y = 0.0f,
+                     float z = 0.0f) noexcept;
+
+      explicit
+      AlignedVector3(const Vector3f& vec) noexcept;
+
+      float&
+      x() noexcept;
+
+      const float&
+      x() const noexcept;
+
+      void
+      setX(float x) noexcept;
+
+      float&
+      y() noexcept;
+
+      const float&
+      y() const noexcept;
+
+      void
+      setY(float y) noexcept;
+
+      float&
+      z() noexcept;
+
+      const float&
+      z() const noexcept;
+
+      void
+      setZ(float z) noexcept;
+
+      Vector3f
+      toVector3() const noexcept;
+
+      float
+      length() const noexcept;
+
+      float
+      lengthSquared() const noexcept;
+
+      float
+      normalize() noexcept;
+
+      AlignedVector3&
+      normalized() noexcept;
+
+      float
+      operator*(const AlignedVector3& other) const noexcept;
+
+      bool
+      operator==(const AlignedVector3& other) const noexcept;
+
+      bool
+      operator!=(const AlignedVector3& other) const noexcept;
+
+      /**
+       * @brief - Compares this vector with `other` using the `Comparison`
+       *          policy, see `Vector3::equals`.
+       */
+      template <typename Comparison>
+      bool
+      equals(const AlignedVector3& other) const noexcept;
+
+      AlignedVector3
+      operator+(const AlignedVector3& other) const noexcept;
+
+      AlignedVector3&
+      operator+=(const AlignedVector3& other) noexcept;
+
+      AlignedVector3
+      operator-(const AlignedVector3& other) const noexcept;
+
+      AlignedVector3
+      operator-() const noexcept;
+
+      AlignedVector3&
+      operator-=(const AlignedVector3& other) noexcept;
+
+      AlignedVector3
+      operator*(float scale) const noexcept;
+
+      AlignedVector3&
+      operator*=(float scale) noexcept;
+
+      AlignedVector3
+      operator/(float scale) const noexcept;
+
+      AlignedVector3&
+      operator/=(float scale) noexcept;
+
+      AlignedVector3
+      operator^(const AlignedVector3& other) const noexcept;
+
+      std::string
+      toString() const noexcept;
+
+      std::size_t
+      format(char* buffer, std::size_t size) const noexcept;
+
+    private:
+
+      float m_data[4];
+  };
+
+  static_assert(sizeof(AlignedVector3) == 16u, "AlignedVector3 should fit a 128 bits register");
+  static_assert(alignof(AlignedVector3) == 16u, "AlignedVector3 should be aligned on 16 bytes");
+
+}
+
+std::ostream&
+operator<<(std::ostream& out, const utils::AlignedVector3& vec) noexcept;
+
+std::ostream&
+operator<<(const utils::AlignedVector3& vec, std::ostream& out) noexcept;
+
+utils::AlignedVector3
+operator*(float scale, const utils::AlignedVector3& vector) noexcept;
+
+# include "AlignedVector3.hxx"
+
+#endif    /* ALIGNED_VECTOR_3_HH */
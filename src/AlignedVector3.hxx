@@ -0,0 +1,287 @@
+#ifndef    ALIGNED_VECTOR_3_HXX
+# define   ALIGNED_VECTOR_3_HXX
+
+# include <cmath>
+# include "AlignedVector3.hh"
+# include "ComparisonUtils.hh"
+# include "FormatUtils.hh"
+# include "SimdUtils.hh"
+
+namespace utils {
+
+  inline
+  AlignedVector3::AlignedVector3(float x,
+                                 float y,
+                                 float z) noexcept:
+    m_data{x, y, z, 0.0f}
+  {}
+
+  inline
+  AlignedVector3::AlignedVector3(const Vector3f& vec) noexcept:
+    m_data{vec.x(), vec.y(), vec.z(), 0.0f}
+  {}
+
+  inline
+  float&
+  AlignedVector3::x() noexcept {
+    return m_data[0u];
+  }
+
+  inline
+  const float&
+  AlignedVector3::x() const noexcept {
+    return m_data[0u];
+  }
+
+  inline
+  void
+  AlignedVector3::setX(float x) noexcept {
+    m_data[0u] = x;
+  }
+
+  inline
+  float&
+  AlignedVector3::y() noexcept {
+    return m_data[1u];
+  }
+
+  inline
+  const float&
+  AlignedVector3::y() const noexcept {
+    return m_data[1u];
+  }
+
+  inline
+  void
+  AlignedVector3::setY(float y) noexcept {
+    m_data[1u] = y;
+  }
+
+  inline
+  float&
+  AlignedVector3::z() noexcept {
+    return m_data[2u];
+  }
+
+  inline
+  const float&
+  AlignedVector3::z() const noexcept {
+    return m_data[2u];
+  }
+
+  inline
+  void
+  AlignedVector3::setZ(float z) noexcept {
+    m_data[2u] = z;
+  }
+
+  inline
+  Vector3f
+  AlignedVector3::toVector3() const noexcept {
+    return Vector3f(m_data[0u], m_data[1u], m_data[2u]);
+  }
+
+  inline
+  float
+  AlignedVector3::length() const noexcept {
+    return std::sqrt(lengthSquared());
+  }
+
+  inline
+  float
+  AlignedVector3::lengthSquared() const noexcept {
+    return operator*(*this);
+  }
+
+  inline
+  float
+  AlignedVector3::normalize() noexcept {
+    const float thisLength = length();
+    if (!fuzzyEqual(thisLength, 0.0f)) {
+      operator/=(thisLength);
+    }
+    return thisLength;
+  }
+
+  inline
+  AlignedVector3&
+  AlignedVector3::normalized() noexcept {
+    normalize();
+    return *this;
+  }
+
+  inline
+  float
+  AlignedVector3::operator*(const AlignedVector3& other) const noexcept {
+# if defined(MATHS_UTILS_SIMD)
+    return simd::dot3(simd::load4(m_data), simd::load4(other.m_data));
+# else
+    return m_data[0u] * other.m_data[0u] + m_data[1u] * other.m_data[1u] + m_data[2u] * other.m_data[2u];
+# endif
+  }
+
+  inline
+  bool
+  AlignedVector3::operator==(const AlignedVector3& other) const noexcept {
+    return equals<DefaultComparison<float>::Type>(other);
+  }
+
+  inline
+  bool
+  AlignedVector3::operator!=(const AlignedVector3& other) const noexcept {
+    return !operator==(other);
+  }
+
+  template <typename Comparison>
+  inline
+  bool
+  AlignedVector3::equals(const AlignedVector3& other) const noexcept {
+    return (
+      Comparison::equal(m_data[0u], other.m_data[0u]) &&
+      Comparison::equal(m_data[1u], other.m_data[1u]) &&
+      Comparison::equal(m_data[2u], other.m_data[2u])
+    );
+  }
+
+  inline
+  AlignedVector3
+  AlignedVector3::operator+(const AlignedVector3& other) const noexcept {
+    AlignedVector3 sum(*this);
+    sum += other;
+    return sum;
+  }
+
+  inline
+  AlignedVector3&
+  AlignedVector3::operator+=(const AlignedVector3& other) noexcept {
+# if defined(MATHS_UTILS_SIMD)
+    simd::store4(m_data, simd::add4(simd::load4(m_data), simd::load4(other.m_data)));
+# else
+    m_data[0u] += other.m_data[0u];
+    m_data[1u] += other.m_data[1u];
+    m_data[2u] += other.m_data[2u];
+# endif
+    return *this;
+  }
+
+  inline
+  AlignedVector3
+  AlignedVector3::operator-(const AlignedVector3& other) const noexcept {
+    AlignedVector3 diff(*this);
+    diff -= other;
+    return diff;
+  }
+
+  inline
+  AlignedVector3
+  AlignedVector3::operator-() const noexcept {
+    // Flips the sign of each coordinate like `Vector3` does, which gives
+    // `-0` for null coordinates.
+    return AlignedVector3(-m_data[0u], -m_data[1u], -m_data[2u]);
+  }
+
+  inline
+  AlignedVector3&
+  AlignedVector3::operator-=(const AlignedVector3& other) noexcept {
+# if defined(MATHS_UTILS_SIMD)
+    simd::store4(m_data, simd::sub4(simd::load4(m_data), simd::load4(other.m_data)));
+# else
+    m_data[0u] -= other.m_data[0u];
+    m_data[1u] -= other.m_data[1u];
+    m_data[2u] -= other.m_data[2u];
+# endif
+    return *this;
+  }
+
+  inline
+  AlignedVector3
+  AlignedVector3::operator*(float scale) const noexcept {
+    AlignedVector3 multiply(*this);
+    multiply *= scale;
+    return multiply;
+  }
+
+  inline
+  AlignedVector3&
+  AlignedVector3::operator*=(float scale) noexcept {
+# if defined(MATHS_UTILS_SIMD)
+    simd::store4(m_data, simd::mul4(simd::load4(m_data), simd::broadcast4(scale)));
+# else
+    m_data[0u] *= scale;
+    m_data[1u] *= scale;
+    m_data[2u] *= scale;
+# endif
+    return *this;
+  }
+
+  inline
+  AlignedVector3
+  AlignedVector3::operator/(float scale) const noexcept {
+    AlignedVector3 divide(*this);
+    divide /= scale;
+    return divide;
+  }
+
+  inline
+  AlignedVector3&
+  AlignedVector3::operator/=(float scale) noexcept {
+# if defined(MATHS_UTILS_SIMD)
+    simd::store4(m_data, simd::div4(simd::load4(m_data), simd::broadcast4(scale)));
+# else
+    m_data[0u] /= scale;
+    m_data[1u] /= scale;
+    m_data[2u] /= scale;
+# endif
+    return *this;
+  }
+
+  inline
+  AlignedVector3
+  AlignedVector3::operator^(const AlignedVector3& other) const noexcept {
+    AlignedVector3 cross;
+# if defined(MATHS_UTILS_SIMD)
+    simd::store4(cross.m_data, simd::cross3(simd::load4(m_data), simd::load4(other.m_data)));
+# else
+    cross.m_data[0u] = m_data[1u] * other.m_data[2u] - m_data[2u] * other.m_data[1u];
+    cross.m_data[1u] = other.m_data[0u] * m_data[2u] - m_data[0u] * other.m_data[2u];
+    cross.m_data[2u] = m_data[0u] * other.m_data[1u] - m_data[1u] * other.m_data[0u];
+# endif
+    return cross;
+  }
+
+  inline
+  std::string
+  AlignedVector3::toString() const noexcept {
+    char buffer[formatBufferSize<float>(3u)];
+    return std::string(buffer, format(buffer, sizeof(buffer)));
+  }
+
+  inline
+  std::size_t
+  AlignedVector3::format(char* buffer, std::size_t size) const noexcept {
+    return toVector3().format(buffer, size);
+  }
+
+}
+
+inline
+std::ostream&
+operator<<(std::ostream& out, const utils::AlignedVector3& vec) noexcept {
+  char buffer[utils::formatBufferSize<float>(3u)];
+  out.write(buffer, static_cast<std::streamsize>(vec.format(buffer, sizeof(buffer))));
+  return out;
+}
+
+inline
+std::ostream&
+operator<<(const utils::AlignedVector3& vec, std::ostream& out) noexcept {
+  return operator<<(out, vec);
+}
+
+inline
+utils::AlignedVector3
+operator*(float scale, const utils::AlignedVector3& vector) noexcept {
+  return vector * scale;
+}
+
+#endif    /* ALIGNED_VECTOR_3_HXX */
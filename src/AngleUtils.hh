@@ -21,6 +21,19 @@ namespace utils {
   constexpr float
   radToDeg(float rad) noexcept;
 
+  /**
+   * @brief - Polynomial approximation of `std::atan2` which trades a bit
+   *          of accuracy for speed. The maximum absolute error compared
+   *          to `std::atan2` is about `2e-6` radians over the whole input
+   *          range. Just like `std::atan2` the result is in the interval
+   *          `[-pi; pi]` and `0` is returned when both inputs are `0`.
+   * @param y - the ordinate of the direction.
+   * @param x - the abscissa of the direction.
+   * @return - the angle between the `x` axis and the input direction.
+   */
+  float
+  fastAtan2(float y, float x) noexcept;
+
 }
 
 # include "AngleUtils.hxx"
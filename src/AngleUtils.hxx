@@ -17,6 +17,41 @@ namespace utils {
     return rad * 180.0f / 3.1415926535f;
   }
 
+  inline
+  float
+  fastAtan2(float y, float x) noexcept {
+    const float ax = (x < 0.0f ? -x : x);
+    const float ay = (y < 0.0f ? -y : y);
+
+    const float num = (ax < ay ? ax : ay);
+    const float den = (ax < ay ? ay : ax);
+    if (den == 0.0f) {
+      return 0.0f;
+    }
+
+    // Evaluate the minimax polynomial approximating `atan` in the range
+    // `[0; 1]` and use the symmetries of the function to cover the other
+    // octants.
+    const float a = num / den;
+    const float s = a * a;
+    float r = (((((
+      -0.01172120f * s + 0.05265332f) * s
+      - 0.11643287f) * s + 0.19354346f) * s
+      - 0.33262347f) * s + 0.99997726f) * a;
+
+    if (ay > ax) {
+      r = 1.5707963268f - r;
+    }
+    if (x < 0.0f) {
+      r = 3.1415926535f - r;
+    }
+    if (y < 0.0f) {
+      r = -r;
+    }
+
+    return r;
+  }
+
 }
 
 #endif    /* ANGLE_UTILS_HXX */
@@ -0,0 +1,236 @@
+#ifndef    BOUNDS_HH
+# define   BOUNDS_HH
+
+# include <string>
+# include <cstdint>
+# include "Box.hh"
+# include "Vector2.hh"
+
+namespace utils {
+
+  /**
+   * @brief - An axis aligned box described by its minimum and maximum
+   *          corners rather than by its center and dimensions like `Box`.
+   *          As the bounds are stored directly all the predicates are pure
+   *          comparisons which makes this type suited for hot loops.
+   *          The predicates have the same semantic as their counterpart in
+   *          `Box`: for a box `b` and any `other` box or point we have for
+   *          example `Bounds(b).intersects(Bounds(other)) == b.intersects(other)`.
+   */
+  template <typename CoordinateType>
+  class Bounds {
+    public:
+
+      /**
+       * @brief - Creates the bounds spanning `[minX; maxX]` along the x axis
+       *          and `[minY; maxY]` along the y axis.
+       * @param minX - the left bound.
+       * @param minY - the bottom bound.
+       * @param maxX - the right bound.
+       * @param maxY - the top bound.
+       */
+      explicit
+      Bounds(const CoordinateType& minX = CoordinateType(),
+             const CoordinateType& minY = CoordinateType(),
+             const CoordinateType& maxX = CoordinateType(),
+             const CoordinateType& maxY = CoordinateType()) noexcept;
+
+      /**
+       * @brief - Creates the bounds with the specified bottom left and top
+       *          right corners.
+       * @param min - the bottom left corner.
+       * @param max - the top right corner.
+       */
+      explicit
+      Bounds(const Vector2<CoordinateType>& min,
+             const Vector2<CoordinateType>& max) noexcept;
+
+      /**
+       * @brief - Creates the bounds of the input box. The bounds are the ones
+       *          returned by `getLeftBound`, `getRightBound`, etc. so that the
+       *          predicates of both representations are always consistent.
+       * @param box - the box to convert.
+       */
+      explicit
+      Bounds(const Box<CoordinateType>& box) noexcept;
+
+      bool
+      operator==(const Bounds<CoordinateType>& other) const noexcept;
+
+      bool
+      operator!=(const Bounds<CoordinateType>& other) const noexcept;
+
+      /**
+       * @brief - Compares the corners of these bounds with the ones of
+       *          `other` using the `Comparison` policy, see `Vector2::equals`.
+       */
+      template <typename Comparison>
+      bool
+      equals(const Bounds<CoordinateType>& other) const noexcept;
+
+      bool
+      valid() const noexcept;
+
+      CoordinateType
+      getLeftBound() const noexcept;
+
+      CoordinateType
+      getRightBound() const noexcept;
+
+      CoordinateType
+      getTopBound() const noexcept;
+
+      CoordinateType
+      getBottomBound() const noexcept;
+
+      const Vector2<CoordinateType>&
+      getMin() const noexcept;
+
+      const Vector2<CoordinateType>&
+      getMax() const noexcept;
+
+      CoordinateType
+      w() const noexcept;
+
+      CoordinateType
+      h() const noexcept;
+
+      CoordinateType
+      area() const noexcept;
+
+      Vector2<CoordinateType>
+      getCenter() const noexcept;
+
+      /**
+       * @brief - Checks whether the input bounds are contained inside these
+       *          bounds.
+       * @param other - the other bounds to check for inclusion.
+       * @return - `true` if `other` is contained inside `this`.
+       */
+      bool
+      contains(const Bounds<CoordinateType>& other) const noexcept;
+
+      /**
+       * @brief - Checks whether the input point is contained inside these
+       *          bounds. Points on the border are considered inside.
+       * @param point - the point to check for inclusion.
+       * @return - `true` if the `point` lies inside `this`.
+       */
+      bool
+      contains(const Vector2<CoordinateType>& point) const noexcept;
+
+      /**
+       * @brief - Checks whether `other` intersects `this`. See the method of
+       *          the same name in `Box` for the meaning of `strict`.
+       * @param other - the bounds to check for intersection.
+       * @param strict - `true` if touching bounds should not be reported as
+       *                 intersecting.
+       * @return - `true` if `other` intersects `this`.
+       */
+      bool
+      intersects(const Bounds<CoordinateType>& other,
+                 bool strict = false) const noexcept;
+
+      /**
+       * @brief - Similar to `Box::intersectsBottomLeft`: the test is strict on
+       *          the top and right borders and not strict on the other ones.
+       * @param other - the bounds to check for intersection.
+       * @return - `true` if `other` intersects `this`.
+       */
+      bool
+      intersectsBottomLeft(const Bounds<CoordinateType>& other) const noexcept;
+
+      /**
+       * @brief - Retrieves the nearest point to the input `point` lying inside
+       *          these bounds.
+       * @param point - the point for which the nearest point is computed.
+       * @return - the closest point belonging to `this`.
+       */
+      Vector2<CoordinateType>
+      getNearestPoint(const Vector2<CoordinateType>& point) const noexcept;
+
+      /**
+       * @brief - Computes the overlap of `this` with `other`. When both do
+       *          not overlap along an axis the result is collapsed to the
+       *          midpoint of the centers along this axis, like `Box::intersect`
+       *          does.
+       * @param other - the bounds to intersect with `this`.
+       * @return - the intersection of `other` and `this`.
+       */
+      Bounds<CoordinateType>
+      intersect(const Bounds<CoordinateType>& other) const noexcept;
+
+      /**
+       * @brief - Converts back to a center based box. For `float` boxes the
+       *          round trip through `Bounds` is exact up to rounding errors.
+       *          For integer boxes with odd dimensions the bounds computed by
+       *          `Box` are truncated so the dimensions of the returned box
+       *          are the ones actually used by the predicates of `Box`.
+       * @return - the box corresponding to these bounds.
+       */
+      Box<CoordinateType>
+      toBox() const noexcept;
+
+      std::string
+      toString() const noexcept;
+
+      /**
+       * @brief - Writes the same text as `toString` in `buffer` without any
+       *          allocation. No terminating `\0` is written.
+       * @param buffer - the output buffer, `kFormatBufferSize` bytes are
+       *                 always enough for `float` and `int` coordinates and
+       *                 `formatBufferSize<CoordinateType>(4u)` for any of
+       *                 them.
+       * @param size - the size of `buffer`.
+       * @return - the number of characters written or `0` if `buffer` is
+       *           too small.
+       */
+      std::size_t
+      format(char* buffer, std::size_t size) const noexcept;
+
+      /**
+       * @brief - Compact binary encoding of this bounds for high rate logs: the
+       *          4 coordinates are written in little endian order.
+       * @param buffer - the output buffer.
+       * @param size - the size of `buffer`.
+       * @return - the number of bytes written, i.e. `kEncodedSize`, or `0`
+       *           if `buffer` is too small.
+       */
+      std::size_t
+      encode(std::uint8_t* buffer, std::size_t size) const noexcept;
+
+      /**
+       * @brief - Reads back a bounds written by `encode`.
+       * @param buffer - the encoded bytes.
+       * @param size - the number of bytes available in `buffer`.
+       * @param out - output argument receiving the decoded bounds.
+       * @return - the number of bytes read or `0` if `buffer` is too small.
+       */
+      static
+      std::size_t
+      decode(const std::uint8_t* buffer, std::size_t size, Bounds<CoordinateType>& out) noexcept;
+
+      static constexpr std::size_t kEncodedSize = 4u * sizeof(CoordinateType);
+
+    private:
+
+      Vector2<CoordinateType> m_min;
+      Vector2<CoordinateType> m_max;
+  };
+
+  using Boundsf = Bounds<float>;
+  using Boundsi = Bounds<int>;
+
+}
+
+template <typename CoordinateType>
+std::ostream&
+operator<<(std::ostream& out, const utils::Bounds<CoordinateType>& bounds) noexcept;
+
+template <typename CoordinateType>
+std::ostream&
+operator<<(const utils::Bounds<CoordinateType>& bounds, std::ostream& out) noexcept;
+
+# include "Bounds.hxx"
+
+#endif    /* BOUNDS_HH */
@@ -0,0 +1,316 @@
+#ifndef    BOUNDS_HXX
+# define   BOUNDS_HXX
+
+# include <algorithm>
+# include "Bounds.hh"
+# include "ComparisonUtils.hh"
+# include "FormatUtils.hh"
+
+namespace utils {
+
+  template <typename CoordinateType>
+  inline
+  Bounds<CoordinateType>::Bounds(const CoordinateType& minX,
+                                 const CoordinateType& minY,
+                                 const CoordinateType& maxX,
+                                 const CoordinateType& maxY) noexcept:
+    m_min(minX, minY),
+    m_max(maxX, maxY)
+  {}
+
+  template <typename CoordinateType>
+  inline
+  Bounds<CoordinateType>::Bounds(const Vector2<CoordinateType>& min,
+                                 const Vector2<CoordinateType>& max) noexcept:
+    m_min(min),
+    m_max(max)
+  {}
+
+  template <typename CoordinateType>
+  inline
+  Bounds<CoordinateType>::Bounds(const Box<CoordinateType>& box) noexcept:
+    m_min(box.getLeftBound(), box.getBottomBound()),
+    m_max(box.getRightBound(), box.getTopBound())
+  {}
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Bounds<CoordinateType>::operator==(const Bounds<CoordinateType>& other) const noexcept {
+    return m_min == other.m_min && m_max == other.m_max;
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Bounds<CoordinateType>::operator!=(const Bounds<CoordinateType>& other) const noexcept {
+    return !operator==(other);
+  }
+
+  template <typename CoordinateType>
+  template <typename Comparison>
+  inline
+  bool
+  Bounds<CoordinateType>::equals(const Bounds<CoordinateType>& other) const noexcept {
+    return m_min.template equals<Comparison>(other.m_min) && m_max.template equals<Comparison>(other.m_max);
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Bounds<CoordinateType>::valid() const noexcept {
+    return m_min.x() != m_max.x() && m_min.y() != m_max.y();
+  }
+
+  template <typename CoordinateType>
+  inline
+  CoordinateType
+  Bounds<CoordinateType>::getLeftBound() const noexcept {
+    return m_min.x();
+  }
+
+  template <typename CoordinateType>
+  inline
+  CoordinateType
+  Bounds<CoordinateType>::getRightBound() const noexcept {
+    return m_max.x();
+  }
+
+  template <typename CoordinateType>
+  inline
+  CoordinateType
+  Bounds<CoordinateType>::getTopBound() const noexcept {
+    return m_max.y();
+  }
+
+  template <typename CoordinateType>
+  inline
+  CoordinateType
+  Bounds<CoordinateType>::getBottomBound() const noexcept {
+    return m_min.y();
+  }
+
+  template <typename CoordinateType>
+  inline
+  const Vector2<CoordinateType>&
+  Bounds<CoordinateType>::getMin() const noexcept {
+    return m_min;
+  }
+
+  template <typename CoordinateType>
+  inline
+  const Vector2<CoordinateType>&
+  Bounds<CoordinateType>::getMax() const noexcept {
+    return m_max;
+  }
+
+  template <typename CoordinateType>
+  inline
+  CoordinateType
+  Bounds<CoordinateType>::w() const noexcept {
+    return m_max.x() - m_min.x();
+  }
+
+  template <typename CoordinateType>
+  inline
+  CoordinateType
+  Bounds<CoordinateType>::h() const noexcept {
+    return m_max.y() - m_min.y();
+  }
+
+  template <typename CoordinateType>
+  inline
+  CoordinateType
+  Bounds<CoordinateType>::area() const noexcept {
+    return w() * h();
+  }
+
+  template <typename CoordinateType>
+  inline
+  Vector2<CoordinateType>
+  Bounds<CoordinateType>::getCenter() const noexcept {
+    return Vector2<CoordinateType>(
+      (m_min.x() + m_max.x()) / CoordinateType(2),
+      (m_min.y() + m_max.y()) / CoordinateType(2)
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Bounds<CoordinateType>::contains(const Bounds<CoordinateType>& other) const noexcept {
+    return
+      other.m_min.x() >= m_min.x() &&
+      other.m_max.x() <= m_max.x() &&
+      other.m_max.y() <= m_max.y() &&
+      other.m_min.y() >= m_min.y()
+    ;
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Bounds<CoordinateType>::contains(const Vector2<CoordinateType>& point) const noexcept {
+    return
+      m_min.x() <= point.x() &&
+      m_max.x() >= point.x() &&
+      m_min.y() <= point.y() &&
+      m_max.y() >= point.y()
+    ;
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Bounds<CoordinateType>::intersects(const Bounds<CoordinateType>& other,
+                                     bool strict) const noexcept
+  {
+    if (strict) {
+      return
+        m_min.x() < other.m_max.x() &&
+        m_max.x() > other.m_min.x() &&
+        m_max.y() > other.m_min.y() &&
+        m_min.y() < other.m_max.y()
+      ;
+    }
+
+    return
+      m_min.x() <= other.m_max.x() &&
+      m_max.x() >= other.m_min.x() &&
+      m_max.y() >= other.m_min.y() &&
+      m_min.y() <= other.m_max.y()
+    ;
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Bounds<CoordinateType>::intersectsBottomLeft(const Bounds<CoordinateType>& other) const noexcept {
+    return
+      other.m_min.x() < m_max.x() &&
+      other.m_max.x() >= m_min.x() &&
+      other.m_min.y() < m_max.y() &&
+      other.m_max.y() >= m_min.y()
+    ;
+  }
+
+  template <typename CoordinateType>
+  inline
+  Vector2<CoordinateType>
+  Bounds<CoordinateType>::getNearestPoint(const Vector2<CoordinateType>& point) const noexcept {
+    return Vector2<CoordinateType>(
+      std::min(std::max(point.x(), m_min.x()), m_max.x()),
+      std::min(std::max(point.y(), m_min.y()), m_max.y())
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  Bounds<CoordinateType>
+  Bounds<CoordinateType>::intersect(const Bounds<CoordinateType>& other) const noexcept {
+    CoordinateType minX = std::max(m_min.x(), other.m_min.x());
+    CoordinateType maxX = std::min(m_max.x(), other.m_max.x());
+    CoordinateType minY = std::max(m_min.y(), other.m_min.y());
+    CoordinateType maxY = std::min(m_max.y(), other.m_max.y());
+
+    // In case there's no overlap along an axis we collapse the result
+    // to the midpoint of both centers along this axis.
+    if (maxX < minX) {
+      minX = (m_min.x() + m_max.x() + other.m_min.x() + other.m_max.x()) / CoordinateType(4);
+      maxX = minX;
+    }
+    if (maxY < minY) {
+      minY = (m_min.y() + m_max.y() + other.m_min.y() + other.m_max.y()) / CoordinateType(4);
+      maxY = minY;
+    }
+
+    return Bounds<CoordinateType>(minX, minY, maxX, maxY);
+  }
+
+  template <typename CoordinateType>
+  inline
+  Box<CoordinateType>
+  Bounds<CoordinateType>::toBox() const noexcept {
+    return Box<CoordinateType>(getCenter(), w(), h());
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::string
+  Bounds<CoordinateType>::toString() const noexcept {
+    char buffer[formatBufferSize<CoordinateType>(4u)];
+    return std::string(buffer, format(buffer, sizeof(buffer)));
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  Bounds<CoordinateType>::format(char* buffer, std::size_t size) const noexcept {
+    FormatWriter writer(buffer, size);
+
+    writer.appendText("[Bounds: min: ");
+    writer.appendValue(m_min.x());
+    writer.appendText("x");
+    writer.appendValue(m_min.y());
+    writer.appendText(", max: ");
+    writer.appendValue(m_max.x());
+    writer.appendText("x");
+    writer.appendValue(m_max.y());
+    writer.appendText("]");
+
+    return writer.size();
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  Bounds<CoordinateType>::encode(std::uint8_t* buffer, std::size_t size) const noexcept {
+    if (size < kEncodedSize) {
+      return 0u;
+    }
+
+    encodeLittleEndian(buffer, m_min.x());
+    encodeLittleEndian(buffer + sizeof(CoordinateType), m_min.y());
+    encodeLittleEndian(buffer + 2u * sizeof(CoordinateType), m_max.x());
+    encodeLittleEndian(buffer + 3u * sizeof(CoordinateType), m_max.y());
+
+    return kEncodedSize;
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  Bounds<CoordinateType>::decode(const std::uint8_t* buffer, std::size_t size, Bounds<CoordinateType>& out) noexcept {
+    if (size < kEncodedSize) {
+      return 0u;
+    }
+
+    out = Bounds<CoordinateType>(
+      decodeLittleEndian<CoordinateType>(buffer),
+      decodeLittleEndian<CoordinateType>(buffer + sizeof(CoordinateType)),
+      decodeLittleEndian<CoordinateType>(buffer + 2u * sizeof(CoordinateType)),
+      decodeLittleEndian<CoordinateType>(buffer + 3u * sizeof(CoordinateType))
+    );
+
+    return kEncodedSize;
+  }
+
+}
+
+template <typename CoordinateType>
+inline
+std::ostream&
+operator<<(std::ostream& out, const utils::Bounds<CoordinateType>& bounds) noexcept {
+  char buffer[utils::formatBufferSize<CoordinateType>(4u)];
+  out.write(buffer, static_cast<std::streamsize>(bounds.format(buffer, sizeof(buffer))));
+  return out;
+}
+
+template <typename CoordinateType>
+inline
+std::ostream&
+operator<<(const utils::Bounds<CoordinateType>& bounds, std::ostream& out) noexcept {
+  return operator<<(out, bounds);
+}
+
+#endif    /* BOUNDS_HXX */
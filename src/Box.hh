@@ -1,6 +1,9 @@
 #ifndef    BOX_HH
 # define   BOX_HH
 
+# include <string>
+# include <cstdint>
+# include "PrimitiveLayout.hh"
 # include "Size.hh"
 # include "Vector2.hh"
 
@@ -17,7 +20,7 @@ namespace utils {
        * @param width - the width of the box.
        * @param height - the height of the box.
        */
-      explicit
+      explicit constexpr
       Box(const CoordinateType& x = CoordinateType(),
           const CoordinateType& y = CoordinateType(),
           const CoordinateType& width = CoordinateType(),
@@ -31,7 +34,7 @@ namespace utils {
        * @param height - the height of the box. This height will be distributed equally on both sides of the
        *                 center.
        */
-      explicit
+      explicit constexpr
       Box(const Vector2<CoordinateType>& center,
           const CoordinateType& width = CoordinateType(),
           const CoordinateType& height = CoordinateType()) noexcept;
@@ -42,7 +45,7 @@ namespace utils {
        * @param y - the y coordinate of the center of the box to create.
        * @param dims - a measure of the dimensions of the box to create.
        */
-      explicit
+      explicit constexpr
       Box(const CoordinateType& x,
           const CoordinateType& y,
           const Size<CoordinateType>& dims = Size<CoordinateType>()) noexcept;
@@ -52,74 +55,83 @@ namespace utils {
        * @param center - the center of the box to create.
        * @param dims - a measure of the dimensions of the box to create.
        */
-      explicit
+      explicit constexpr
       Box(const Vector2<CoordinateType>& center,
           const Size<CoordinateType>& dims) noexcept;
 
-      bool
+      constexpr bool
       operator==(const Box<CoordinateType>& other) const noexcept;
 
-      bool
+      constexpr bool
       operator!=(const Box<CoordinateType>& other) const noexcept;
 
-      bool
+      /**
+       * @brief - Compares this box with `other` using the `Comparison`
+       *          policy (see `ComparisonUtils.hh`) for each coordinate.
+       *          `operator==` uses the `DefaultComparison` of the type.
+       */
+      template <typename Comparison>
+      constexpr bool
+      equals(const Box<CoordinateType>& other) const noexcept;
+
+      constexpr bool
       valid() const noexcept;
 
-      CoordinateType&
+      constexpr CoordinateType&
       x() noexcept;
 
-      const CoordinateType&
+      constexpr const CoordinateType&
       x() const noexcept;
 
-      CoordinateType&
+      constexpr CoordinateType&
       y() noexcept;
 
-      const CoordinateType&
+      constexpr const CoordinateType&
       y() const noexcept;
 
-      CoordinateType&
+      constexpr CoordinateType&
       w() noexcept;
 
-      const CoordinateType&
+      constexpr const CoordinateType&
       w() const noexcept;
 
-      CoordinateType&
+      constexpr CoordinateType&
       h() noexcept;
 
-      const CoordinateType&
+      constexpr const CoordinateType&
       h() const noexcept;
 
-      CoordinateType
+      constexpr CoordinateType
       area() const noexcept;
 
-      CoordinateType
+      constexpr CoordinateType
       getLeftBound() const noexcept;
 
-      CoordinateType
+      constexpr CoordinateType
       getRightBound() const noexcept;
 
-      CoordinateType
+      constexpr CoordinateType
       getTopBound() const noexcept;
 
-      CoordinateType
+      constexpr CoordinateType
       getBottomBound() const noexcept;
 
-      Vector2<CoordinateType>
+      constexpr Vector2<CoordinateType>
       getCenter() const noexcept;
 
-      Vector2<CoordinateType>
+      constexpr Vector2<CoordinateType>
       getTopLeftCorner() const noexcept;
 
-      Vector2<CoordinateType>
+      constexpr Vector2<CoordinateType>
       getTopRightCorner() const noexcept;
 
-      Vector2<CoordinateType>
+      constexpr Vector2<CoordinateType>
       getBottomRightCorner() const noexcept;
 
-      Vector2<CoordinateType>
+      constexpr Vector2<CoordinateType>
       getBottomLeftCorner() const noexcept;
 
-      CoordinateType
+      constexpr CoordinateType
       getSurface() const noexcept;
 
       /**
@@ -127,7 +139,7 @@ namespace utils {
        * @param other - the other box to check for inclusion.
        * @return - `true` if the other box is contained inside this box, `false` otherwise.
        */
-      bool
+      constexpr bool
       contains(const Box<CoordinateType>& other) const noexcept;
 
       /**
@@ -135,7 +147,7 @@ namespace utils {
        * @param point - the point which should be checked for inclusion.
        * @return - `true` if the input `point` lies inside `this` box, `false` otherwise.
        */
-      bool
+      constexpr bool
       contains(const Vector2<CoordinateType>& point) const noexcept;
 
       /**
@@ -146,7 +158,7 @@ namespace utils {
        * @param threshold - a value representing the threshold to actually exclude a point.
        * @return - `true` if the input `point` lies inside `this` box, `false` otherwise.
        */
-      bool
+      constexpr bool
       fuzzyContains(const Vector2<CoordinateType>& point,
                     CoordinateType threshold) const noexcept;
 
@@ -160,7 +172,7 @@ namespace utils {
        *                 `false` otherwise.
        * @return - `true` if the `other` box intersects with `this` box, `false` otherwise.
        */
-      bool
+      constexpr bool
       intersects(const Box<CoordinateType>& other,
                  bool strict = false) const noexcept;
 
@@ -171,7 +183,7 @@ namespace utils {
        * @param other - the box to check for intersection.
        * @return - `true` if the `other` box intersects `this` box and `false` otherwise.
        */
-      bool
+      constexpr bool
       intersectsBottomLeft(const Box<CoordinateType>& other) const noexcept;
 
       /**
@@ -179,7 +191,7 @@ namespace utils {
        * @param other - the box into which `this` box should be contained.
        * @return - `true` if the `other` box contains `this` box, `false` otherwise.
        */
-      bool
+      constexpr bool
       includes(const Box<CoordinateType>& other) const noexcept;
 
       /**
@@ -187,13 +199,51 @@ namespace utils {
        * @param point - the point for which a box point should be retrieved.
        * @return - a vector representing the closest point belonging to this box relatively to the input point.
        */
-      Vector2<CoordinateType>
+      constexpr Vector2<CoordinateType>
       getNearestPoint(const Vector2<CoordinateType>& point) const noexcept;
 
       std::string
       toString() const noexcept;
 
-      Size<CoordinateType>
+      /**
+       * @brief - Writes the same text as `toString` in `buffer` without any
+       *          allocation. No terminating `\0` is written.
+       * @param buffer - the output buffer, `kFormatBufferSize` bytes are
+       *                 always enough for `float` and `int` coordinates and
+       *                 `formatBufferSize<CoordinateType>(4u)` for any of
+       *                 them.
+       * @param size - the size of `buffer`.
+       * @return - the number of characters written or `0` if `buffer` is
+       *           too small.
+       */
+      std::size_t
+      format(char* buffer, std::size_t size) const noexcept;
+
+      /**
+       * @brief - Compact binary encoding of this box for high rate logs: the
+       *          4 coordinates are written in little endian order.
+       * @param buffer - the output buffer.
+       * @param size - the size of `buffer`.
+       * @return - the number of bytes written, i.e. `kEncodedSize`, or `0`
+       *           if `buffer` is too small.
+       */
+      std::size_t
+      encode(std::uint8_t* buffer, std::size_t size) const noexcept;
+
+      /**
+       * @brief - Reads back a box written by `encode`.
+       * @param buffer - the encoded bytes.
+       * @param size - the number of bytes available in `buffer`.
+       * @param out - output argument receiving the decoded box.
+       * @return - the number of bytes read or `0` if `buffer` is too small.
+       */
+      static
+      std::size_t
+      decode(const std::uint8_t* buffer, std::size_t size, Box<CoordinateType>& out) noexcept;
+
+      static constexpr std::size_t kEncodedSize = 4u * sizeof(CoordinateType);
+
+      constexpr Size<CoordinateType>
       toSize() const noexcept;
 
       /**
@@ -209,7 +259,7 @@ namespace utils {
        */
       template <typename OtherCoordinateType>
       static
-      Box<CoordinateType>
+      constexpr Box<CoordinateType>
       fromSize(const Size<OtherCoordinateType>& size,
                const bool setToOrigin = false) noexcept;
 
@@ -218,10 +268,10 @@ namespace utils {
        *          the origin (i.e. `[0; 0]`).
        * @return - a box with same dimensions as `this` box but with a center at the origin.
        */
-      Box<CoordinateType>
+      constexpr Box<CoordinateType>
       toOrigin() const noexcept;
 
-      Box<CoordinateType>
+      constexpr Box<CoordinateType>
       scale(float factor) const noexcept;
 
       /**
@@ -232,7 +282,7 @@ namespace utils {
        * @param other - the box to intersect with `this` box.
        * @return - the intersection between the `other` and `this` box.
        */
-      Box<CoordinateType>
+      constexpr Box<CoordinateType>
       intersect(const Box<CoordinateType>& other) const noexcept;
 
     private:
@@ -246,6 +296,9 @@ namespace utils {
   using Boxf = Box<float>;
   using Boxi = Box<int>;
 
+  static_assert(isFlatPrimitive<Boxf, float, 4u>, "Boxf should be made of exactly four floats");
+  static_assert(isFlatPrimitive<Boxi, int, 4u>, "Boxi should be made of exactly four ints");
+
 }
 
 template <typename CoordinateType>
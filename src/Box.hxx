@@ -2,11 +2,14 @@
 # define   BOX_HXX_INCLUDED
 
 # include "Box.hh"
+# include "FormatUtils.hh"
+# include "ComparisonUtils.hh"
 
 namespace utils {
 
   template <typename CoordinateType>
   inline
+  constexpr
   Box<CoordinateType>::Box(const CoordinateType& x,
                            const CoordinateType& y,
                            const CoordinateType& width,
@@ -19,6 +22,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
+  constexpr
   Box<CoordinateType>::Box(const Vector2<CoordinateType>& center,
                            const CoordinateType& width,
                            const CoordinateType& height) noexcept:
@@ -30,6 +34,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
+  constexpr
   Box<CoordinateType>::Box(const CoordinateType& x,
                            const CoordinateType& y,
                            const Size<CoordinateType>& dims) noexcept:
@@ -41,6 +46,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
+  constexpr
   Box<CoordinateType>::Box(const Vector2<CoordinateType>& center,
                            const Size<CoordinateType>& dims) noexcept:
     m_x(center.x()),
@@ -51,166 +57,174 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  bool
+  constexpr bool
   Box<CoordinateType>::operator==(const Box<CoordinateType>& other) const noexcept {
-    return
-      fuzzyEqual(m_x, other.m_x) &&
-      fuzzyEqual(m_y, other.m_y) &&
-      fuzzyEqual(m_w, other.m_w) &&
-      fuzzyEqual(m_h, other.m_h)
-    ;
+    return equals<typename DefaultComparison<CoordinateType>::Type>(other);
   }
 
   template <typename CoordinateType>
   inline
-  bool
+  constexpr bool
   Box<CoordinateType>::operator!=(const Box<CoordinateType>& other) const noexcept {
     return !operator==(other);
   }
 
+  template <typename CoordinateType>
+  template <typename Comparison>
+  inline
+  constexpr bool
+  Box<CoordinateType>::equals(const Box<CoordinateType>& other) const noexcept {
+    return
+      Comparison::equal(m_x, other.m_x) &&
+      Comparison::equal(m_y, other.m_y) &&
+      Comparison::equal(m_w, other.m_w) &&
+      Comparison::equal(m_h, other.m_h)
+    ;
+  }
+
   template <typename CoordinateType>
   inline
-  bool
+  constexpr bool
   Box<CoordinateType>::valid() const noexcept {
     return m_w != CoordinateType() && m_h != CoordinateType();
   }
 
   template <typename CoordinateType>
   inline
-  CoordinateType&
+  constexpr CoordinateType&
   Box<CoordinateType>::x() noexcept {
     return m_x;
   }
 
   template <typename CoordinateType>
   inline
-  const CoordinateType&
+  constexpr const CoordinateType&
   Box<CoordinateType>::x() const noexcept {
     return m_x;
   }
 
   template <typename CoordinateType>
   inline
-  CoordinateType&
+  constexpr CoordinateType&
   Box<CoordinateType>::y() noexcept {
     return m_y;
   }
 
   template <typename CoordinateType>
   inline
-  const CoordinateType&
+  constexpr const CoordinateType&
   Box<CoordinateType>::y() const noexcept {
     return m_y;
   }
 
   template <typename CoordinateType>
   inline
-  CoordinateType&
+  constexpr CoordinateType&
   Box<CoordinateType>::w() noexcept {
     return m_w;
   }
 
   template <typename CoordinateType>
   inline
-  const CoordinateType&
+  constexpr const CoordinateType&
   Box<CoordinateType>::w() const noexcept {
     return m_w;
   }
 
   template <typename CoordinateType>
   inline
-  CoordinateType&
+  constexpr CoordinateType&
   Box<CoordinateType>::h() noexcept {
     return m_h;
   }
 
   template <typename CoordinateType>
   inline
-  const CoordinateType&
+  constexpr const CoordinateType&
   Box<CoordinateType>::h() const noexcept {
     return m_h;
   }
 
   template <typename CoordinateType>
   inline
-  CoordinateType
+  constexpr CoordinateType
   Box<CoordinateType>::area() const noexcept {
     return m_w * m_h;
   }
 
   template <typename CoordinateType>
   inline
-  CoordinateType
+  constexpr CoordinateType
   Box<CoordinateType>::getLeftBound() const noexcept {
     return m_x - m_w / CoordinateType(2.0f);
   }
 
   template <typename CoordinateType>
   inline
-  CoordinateType
+  constexpr CoordinateType
   Box<CoordinateType>::getRightBound() const noexcept {
     return m_x + m_w / CoordinateType(2.0f);
   }
 
   template <typename CoordinateType>
   inline
-  CoordinateType
+  constexpr CoordinateType
   Box<CoordinateType>::getTopBound() const noexcept {
     return m_y + m_h / CoordinateType(2.0f);
   }
 
   template <typename CoordinateType>
   inline
-  CoordinateType
+  constexpr CoordinateType
   Box<CoordinateType>::getBottomBound() const noexcept {
     return m_y - m_h / CoordinateType(2.0f);
   }
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>
+  constexpr Vector2<CoordinateType>
   Box<CoordinateType>::getCenter() const noexcept {
     return Vector2<CoordinateType>(m_x, m_y);
   }
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>
+  constexpr Vector2<CoordinateType>
   Box<CoordinateType>::getTopLeftCorner() const noexcept {
     return Vector2<CoordinateType>(getLeftBound(), getTopBound());
   }
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>
+  constexpr Vector2<CoordinateType>
   Box<CoordinateType>::getTopRightCorner() const noexcept {
     return Vector2<CoordinateType>(getRightBound(), getTopBound());
   }
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>
+  constexpr Vector2<CoordinateType>
   Box<CoordinateType>::getBottomRightCorner() const noexcept {
     return Vector2<CoordinateType>(getRightBound(), getBottomBound());
   }
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>
+  constexpr Vector2<CoordinateType>
   Box<CoordinateType>::getBottomLeftCorner() const noexcept {
     return Vector2<CoordinateType>(getLeftBound(), getBottomBound());
   }
 
   template <typename CoordinateType>
   inline
-  CoordinateType
+  constexpr CoordinateType
   Box<CoordinateType>::getSurface() const noexcept {
     return m_w * m_h;
   }
 
   template <typename CoordinateType>
   inline
-  bool
+  constexpr bool
   Box<CoordinateType>::contains(const Box<CoordinateType>& other) const noexcept {
     return other.getLeftBound() >= getLeftBound() &&
            other.getRightBound() <= getRightBound() &&
@@ -220,7 +234,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  bool
+  constexpr bool
   Box<CoordinateType>::contains(const Vector2<CoordinateType>& point) const noexcept {
     return
       getLeftBound() <= point.x() &&
@@ -232,7 +246,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  bool
+  constexpr bool
   Box<CoordinateType>::fuzzyContains(const Vector2<CoordinateType>& point,
                                      CoordinateType threshold) const noexcept
   {
@@ -246,7 +260,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  bool
+  constexpr bool
   Box<CoordinateType>::intersects(const Box<CoordinateType>& other,
                                   bool strict) const noexcept
   {
@@ -271,7 +285,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  bool
+  constexpr bool
   Box<CoordinateType>::intersectsBottomLeft(const Box<CoordinateType>& other) const noexcept {
     if (other.getLeftBound() >= getRightBound()) {
       return false;
@@ -294,14 +308,14 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  bool
+  constexpr bool
   Box<CoordinateType>::includes(const Box<CoordinateType>& other) const noexcept {
     return other.contains(*this);
   }
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>
+  constexpr Vector2<CoordinateType>
   Box<CoordinateType>::getNearestPoint(const Vector2<CoordinateType>& point) const noexcept {
     return Vector2<CoordinateType>(
       getLeftBound() > point.x() ? getLeftBound() : (getRightBound() < point.x() ? getRightBound() : point.x()),
@@ -313,14 +327,66 @@ namespace utils {
   inline
   std::string
   Box<CoordinateType>::toString() const noexcept {
-    return std::string("[Box: ") +
-           "pos: " + std::to_string(x()) + "x" + std::to_string(y()) + ", " +
-           "dims: " + std::to_string(w()) + "x" + std::to_string(h()) + "]";
+    char buffer[formatBufferSize<CoordinateType>(4u)];
+    return std::string(buffer, format(buffer, sizeof(buffer)));
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  Box<CoordinateType>::format(char* buffer, std::size_t size) const noexcept {
+    FormatWriter writer(buffer, size);
+
+    writer.appendText("[Box: pos: ");
+    writer.appendValue(m_x);
+    writer.appendText("x");
+    writer.appendValue(m_y);
+    writer.appendText(", dims: ");
+    writer.appendValue(m_w);
+    writer.appendText("x");
+    writer.appendValue(m_h);
+    writer.appendText("]");
+
+    return writer.size();
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  Box<CoordinateType>::encode(std::uint8_t* buffer, std::size_t size) const noexcept {
+    if (size < kEncodedSize) {
+      return 0u;
+    }
+
+    encodeLittleEndian(buffer, m_x);
+    encodeLittleEndian(buffer + sizeof(CoordinateType), m_y);
+    encodeLittleEndian(buffer + 2u * sizeof(CoordinateType), m_w);
+    encodeLittleEndian(buffer + 3u * sizeof(CoordinateType), m_h);
+
+    return kEncodedSize;
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  Box<CoordinateType>::decode(const std::uint8_t* buffer, std::size_t size, Box<CoordinateType>& out) noexcept {
+    if (size < kEncodedSize) {
+      return 0u;
+    }
+
+    out = Box<CoordinateType>(
+      decodeLittleEndian<CoordinateType>(buffer),
+      decodeLittleEndian<CoordinateType>(buffer + sizeof(CoordinateType)),
+      decodeLittleEndian<CoordinateType>(buffer + 2u * sizeof(CoordinateType)),
+      decodeLittleEndian<CoordinateType>(buffer + 3u * sizeof(CoordinateType))
+    );
+
+    return kEncodedSize;
   }
 
   template <typename CoordinateType>
   inline
-  Size<CoordinateType>
+  constexpr Size<CoordinateType>
   Box<CoordinateType>::toSize() const noexcept {
     return Size<CoordinateType>(w(), h());
   }
@@ -328,7 +394,7 @@ namespace utils {
   template <typename CoordinateType>
   template <typename OtherCoordinateType>
   inline
-  Box<CoordinateType>
+  constexpr Box<CoordinateType>
   Box<CoordinateType>::fromSize(const Size<OtherCoordinateType>& size,
                                 const bool setToOrigin) noexcept
   {
@@ -342,7 +408,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Box<CoordinateType>
+  constexpr Box<CoordinateType>
   Box<CoordinateType>::toOrigin() const noexcept {
     return Box<CoordinateType>(
       static_cast<CoordinateType>(0),
@@ -353,36 +419,43 @@ namespace utils {
   }
 
   template <typename CoordinateType>
-  Box<CoordinateType>
+  inline
+  constexpr Box<CoordinateType>
   Box<CoordinateType>::scale(float factor) const noexcept {
     return Box<CoordinateType>(
       m_x,
       m_y,
-      m_w * factor,
-      m_h * factor
+      details::scaleDimension(m_w, factor),
+      details::scaleDimension(m_h, factor)
     );
   }
 
   template <typename CoordinateType>
-  Box<CoordinateType>
+  inline
+  constexpr Box<CoordinateType>
   Box<CoordinateType>::intersect(const Box<CoordinateType>& other) const noexcept {
     // Compute the box to intersect from the internal coordinates. First
     // we need to compute the width and height of the intersection if any.
-    const CoordinateType overlappingW = std::min(getRightBound(), other.getRightBound()) - std::max(getLeftBound(), other.getLeftBound());
-    const CoordinateType overlappingH = std::min(getTopBound(), other.getTopBound()) - std::max(getBottomBound(), other.getBottomBound());
+    const CoordinateType left = std::max(getLeftBound(), other.getLeftBound());
+    const CoordinateType right = std::min(getRightBound(), other.getRightBound());
+    const CoordinateType bottom = std::max(getBottomBound(), other.getBottomBound());
+    const CoordinateType top = std::min(getTopBound(), other.getTopBound());
+
+    const CoordinateType overlappingW = right - left;
+    const CoordinateType overlappingH = top - bottom;
 
     // Compute the center of this overlapping width and height. If one of
     // the dimension is negative it means that both boxes are not overlapping
     // along this direction and thus we return the midpoint along this axis.
-    const float x = (
+    const CoordinateType x = (
       overlappingW < CoordinateType(0) ?
       (other.m_x + m_x) / CoordinateType(2) :
-      (std::max(getLeftBound(), other.getLeftBound()) + std::min(getRightBound(), other.getRightBound())) / CoordinateType(2)
+      (left + right) / CoordinateType(2)
     );
-    const float y = (
+    const CoordinateType y = (
       overlappingH < CoordinateType(0) ?
       (other.m_y + m_y) / CoordinateType(2) :
-      (std::max(getBottomBound(), other.getBottomBound()) + std::min(getTopBound(), other.getTopBound())) / CoordinateType(2)
+      (bottom + top) / CoordinateType(2)
     );
 
     // Compute and return the intersection box.
@@ -398,7 +471,8 @@ template <typename CoordinateType>
 inline
 std::ostream&
 operator<<(std::ostream& out, const utils::Box<CoordinateType>& box) noexcept {
-  out << box.toString();
+  char buffer[utils::formatBufferSize<CoordinateType>(4u)];
+  out.write(buffer, static_cast<std::streamsize>(box.format(buffer, sizeof(buffer))));
   return out;
 }
 
@@ -0,0 +1,72 @@
+#ifndef    BOX_REDUCTION_HH
+# define   BOX_REDUCTION_HH
+
+# include <cstddef>
+# include "Box.hh"
+# include "Bounds.hh"
+
+namespace utils {
+
+  /**
+   * @brief - Computes the smallest bounds enclosing all the input boxes.
+   *          The bounds of each box are the ones returned by `getLeftBound`
+   *          and similar methods. Large inputs are split across several
+   *          threads, see `parallelFor`.
+   * @param boxes - the boxes to enclose.
+   * @param count - the number of boxes.
+   * @param out - output argument receiving the enclosing bounds. Left
+   *              unchanged when there are no boxes.
+   * @param threads - the maximum number of threads to use, `0` to use one
+   *                  per hardware thread and `1` to stay on the calling one.
+   * @return - `false` if there are no boxes.
+   */
+  template <typename CoordinateType>
+  bool
+  unionOf(const Box<CoordinateType>* boxes,
+          std::size_t count,
+          Bounds<CoordinateType>& out,
+          unsigned threads = 0u);
+
+  /**
+   * @brief - Computes the area shared by all the input boxes. Just like for
+   *          `Box::intersects` touching boxes are considered to intersect
+   *          and the result can have an empty area.
+   * @param boxes - the boxes to intersect.
+   * @param count - the number of boxes.
+   * @param out - output argument receiving the common bounds. Left unchanged
+   *              when the boxes do not all intersect.
+   * @param threads - the maximum number of threads to use.
+   * @return - `true` if there is at least one box and all of them intersect.
+   */
+  template <typename CoordinateType>
+  bool
+  intersectionOf(const Box<CoordinateType>* boxes,
+                 std::size_t count,
+                 Bounds<CoordinateType>& out,
+                 unsigned threads = 0u);
+
+  /**
+   * @brief - Computes the area covered by the union of the input boxes, i.e.
+   *          areas covered by several boxes are only counted once. Uses a
+   *          sweep line along the x axis which runs in `O(n log(n))`. Large
+   *          inputs are split in vertical strips holding roughly the same
+   *          number of boxes which are swept in parallel.
+   *          The result is computed with double precision as the sum would
+   *          quickly overflow for integer coordinates, its last bits might
+   *          vary with the number of threads used.
+   * @param boxes - the boxes for which the covered area should be computed.
+   * @param count - the number of boxes.
+   * @param threads - the maximum number of threads to use.
+   * @return - the area covered by the boxes.
+   */
+  template <typename CoordinateType>
+  double
+  unionArea(const Box<CoordinateType>* boxes,
+            std::size_t count,
+            unsigned threads = 0u);
+
+}
+
+# include "BoxReduction.hxx"
+
+#endif    /* BOX_REDUCTION_HH */
@@ -0,0 +1,358 @@
+#ifndef    BOX_REDUCTION_HXX
+# define   BOX_REDUCTION_HXX
+
+# include <limits>
+# include <utility>
+# include <vector>
+# include <cstdint>
+# include <algorithm>
+# include "BoxReduction.hh"
+# include "ParallelUtils.hh"
+
+namespace utils {
+  namespace details {
+
+    /**
+     * @brief - The extremal bounds of a range of boxes: the union uses the
+     *          smallest minimum and the largest maximum while the intersection
+     *          uses the opposite.
+     */
+    template <typename T>
+    struct BoundsAccumulator {
+      T left;
+      T bottom;
+      T right;
+      T top;
+    };
+
+    template <bool Union, typename T>
+    inline
+    BoundsAccumulator<T>
+    emptyAccumulator() noexcept {
+      const T lowest = std::numeric_limits<T>::lowest();
+      const T highest = std::numeric_limits<T>::max();
+
+      return (Union ?
+        BoundsAccumulator<T>{highest, highest, lowest, lowest} :
+        BoundsAccumulator<T>{lowest, lowest, highest, highest}
+      );
+    }
+
+    template <bool Union, typename T>
+    inline
+    void
+    accumulate(BoundsAccumulator<T>& acc, T left, T bottom, T right, T top) noexcept {
+      if (Union) {
+        acc.left = std::min(acc.left, left);
+        acc.bottom = std::min(acc.bottom, bottom);
+        acc.right = std::max(acc.right, right);
+        acc.top = std::max(acc.top, top);
+      }
+      else {
+        acc.left = std::max(acc.left, left);
+        acc.bottom = std::max(acc.bottom, bottom);
+        acc.right = std::min(acc.right, right);
+        acc.top = std::min(acc.top, top);
+      }
+    }
+
+    template <bool Union, typename T>
+    inline
+    BoundsAccumulator<T>
+    reduceBounds(const Box<T>* boxes,
+                 std::size_t count,
+                 unsigned threads)
+    {
+      std::vector<BoundsAccumulator<T>> partial(threadsFor(count, threads), emptyAccumulator<Union, T>());
+
+      parallelFor(
+        count,
+        [&](unsigned chunk, std::size_t begin, std::size_t end) {
+          BoundsAccumulator<T> acc = emptyAccumulator<Union, T>();
+          for (std::size_t id = begin ; id < end ; ++id) {
+            accumulate<Union>(
+              acc,
+              boxes[id].getLeftBound(),
+              boxes[id].getBottomBound(),
+              boxes[id].getRightBound(),
+              boxes[id].getTopBound()
+            );
+          }
+
+          partial[chunk] = acc;
+        },
+        threads
+      );
+
+      BoundsAccumulator<T> out = emptyAccumulator<Union, T>();
+      for (const BoundsAccumulator<T>& acc : partial) {
+        accumulate<Union>(out, acc.left, acc.bottom, acc.right, acc.top);
+      }
+
+      return out;
+    }
+
+    /**
+     * @brief - A segment tree over the elementary intervals defined by sorted
+     *          y coordinates, tracking how many boxes cover each of them and
+     *          the total length covered by at least one box.
+     */
+    class CoverageTree {
+      public:
+
+        explicit
+        CoverageTree(const std::vector<double>& ys):
+          m_ys(ys),
+          m_nodes(4u * std::max<std::size_t>(1u, ys.size()), Node{0.0, 0})
+        {}
+
+        /**
+         * @brief - Adds `delta` to the coverage of the intervals between
+         *          `m_ys[from]` and `m_ys[to]`.
+         */
+        void
+        update(std::size_t from, std::size_t to, int delta) noexcept {
+          if (m_ys.size() > 1u) {
+            update(1u, 0u, m_ys.size() - 1u, from, to, delta);
+          }
+        }
+
+        double
+        covered() const noexcept {
+          return m_nodes[1u].covered;
+        }
+
+      private:
+
+        // Both values are used together so they are kept next to each other.
+        struct Node {
+          double covered;
+          int count;
+        };
+
+        void
+        update(std::size_t node,
+               std::size_t lo,
+               std::size_t hi,
+               std::size_t from,
+               std::size_t to,
+               int delta) noexcept
+        {
+          if (from <= lo && hi <= to) {
+            m_nodes[node].count += delta;
+          }
+          else {
+            const std::size_t mid = (lo + hi) / 2u;
+            if (from < mid) {
+              update(2u * node, lo, mid, from, to, delta);
+            }
+            if (mid < to) {
+              update(2u * node + 1u, mid, hi, from, to, delta);
+            }
+          }
+
+          Node& current = m_nodes[node];
+          if (current.count > 0) {
+            current.covered = m_ys[hi] - m_ys[lo];
+          }
+          else if (hi - lo == 1u) {
+            current.covered = 0.0;
+          }
+          else {
+            current.covered = m_nodes[2u * node].covered + m_nodes[2u * node + 1u].covered;
+          }
+        }
+
+        const std::vector<double>& m_ys;
+        std::vector<Node> m_nodes;
+    };
+
+    struct SweepEvent {
+      double x;
+      std::uint32_t from;
+      std::uint32_t to;
+      int delta;
+    };
+
+    /**
+     * @brief - Computes the area covered by the input boxes once clipped to
+     *          the vertical strip `[minX; maxX]`.
+     */
+    template <typename T>
+    inline
+    double
+    sweepArea(const Box<T>* boxes,
+              std::size_t count,
+              double minX,
+              double maxX)
+    {
+      // Each box registers its bottom and top coordinates along with the
+      // index of its events so that they can be replaced by their index in
+      // the list of sorted unique coordinates in a single pass.
+      std::vector<std::pair<double, std::uint32_t>> ys;
+      std::vector<SweepEvent> events;
+
+      for (std::size_t id = 0u ; id < count ; ++id) {
+        const double left = std::max(minX, static_cast<double>(boxes[id].getLeftBound()));
+        const double right = std::min(maxX, static_cast<double>(boxes[id].getRightBound()));
+        const double bottom = static_cast<double>(boxes[id].getBottomBound());
+        const double top = static_cast<double>(boxes[id].getTopBound());
+
+        // Boxes with an empty area (or outside of the strip) do not cover
+        // anything.
+        if (left >= right || bottom >= top) {
+          continue;
+        }
+
+        const std::uint32_t event = static_cast<std::uint32_t>(events.size());
+        ys.emplace_back(bottom, event);
+        ys.emplace_back(top, event + 1u);
+        events.push_back(SweepEvent{left, 0u, 0u, 1});
+        events.push_back(SweepEvent{right, 0u, 0u, -1});
+      }
+
+      if (events.empty()) {
+        return 0.0;
+      }
+
+      std::sort(ys.begin(), ys.end());
+
+      std::vector<double> sorted;
+      sorted.reserve(ys.size());
+      for (const std::pair<double, std::uint32_t>& y : ys) {
+        if (sorted.empty() || sorted.back() != y.first) {
+          sorted.push_back(y.first);
+        }
+
+        // The bottom coordinate was registered with the index of the left
+        // event and the top one with the index of the right event: both
+        // events hold both indices.
+        const std::uint32_t index = static_cast<std::uint32_t>(sorted.size() - 1u);
+        const std::uint32_t event = y.second - y.second % 2u;
+        if (y.second % 2u == 0u) {
+          events[event].from = index;
+          events[event + 1u].from = index;
+        }
+        else {
+          events[event].to = index;
+          events[event + 1u].to = index;
+        }
+      }
+
+      std::sort(
+        events.begin(),
+        events.end(),
+        [](const SweepEvent& lhs, const SweepEvent& rhs) {
+          return lhs.x < rhs.x;
+        }
+      );
+
+      CoverageTree tree(sorted);
+      double area = 0.0;
+      double prevX = events.front().x;
+
+      for (const SweepEvent& event : events) {
+        area += tree.covered() * (event.x - prevX);
+        tree.update(event.from, event.to, event.delta);
+        prevX = event.x;
+      }
+
+      return area;
+    }
+
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  unionOf(const Box<CoordinateType>* boxes,
+          std::size_t count,
+          Bounds<CoordinateType>& out,
+          unsigned threads)
+  {
+    if (count == 0u) {
+      return false;
+    }
+
+    const details::BoundsAccumulator<CoordinateType> acc = details::reduceBounds<true>(boxes, count, threads);
+    out = Bounds<CoordinateType>(acc.left, acc.bottom, acc.right, acc.top);
+
+    return true;
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  intersectionOf(const Box<CoordinateType>* boxes,
+                 std::size_t count,
+                 Bounds<CoordinateType>& out,
+                 unsigned threads)
+  {
+    if (count == 0u) {
+      return false;
+    }
+
+    const details::BoundsAccumulator<CoordinateType> acc = details::reduceBounds<false>(boxes, count, threads);
+    if (acc.right < acc.left || acc.top < acc.bottom) {
+      return false;
+    }
+
+    out = Bounds<CoordinateType>(acc.left, acc.bottom, acc.right, acc.top);
+
+    return true;
+  }
+
+  template <typename CoordinateType>
+  inline
+  double
+  unionArea(const Box<CoordinateType>* boxes,
+            std::size_t count,
+            unsigned threads)
+  {
+    const unsigned strips = threadsFor(count, threads);
+    if (strips <= 1u) {
+      return details::sweepArea(boxes, count, std::numeric_limits<double>::lowest(), std::numeric_limits<double>::max());
+    }
+
+    // Use the quantiles of the left bounds as limits of the strips so that
+    // each one holds a similar number of boxes even for clustered inputs.
+    std::vector<double> lefts(count);
+    for (std::size_t id = 0u ; id < count ; ++id) {
+      lefts[id] = static_cast<double>(boxes[id].getLeftBound());
+    }
+
+    std::vector<double> limits(strips + 1u);
+    limits.front() = std::numeric_limits<double>::lowest();
+    limits.back() = std::numeric_limits<double>::max();
+
+    auto from = lefts.begin();
+    for (unsigned strip = 1u ; strip < strips ; ++strip) {
+      const auto nth = lefts.begin() + static_cast<std::ptrdiff_t>(strip * count / strips);
+      std::nth_element(from, nth, lefts.end());
+      limits[strip] = *nth;
+      from = nth;
+    }
+
+    std::vector<double> areas(strips, 0.0);
+    parallelFor(
+      strips,
+      [&](unsigned /*chunk*/, std::size_t begin, std::size_t end) {
+        for (std::size_t strip = begin ; strip < end ; ++strip) {
+          areas[strip] = details::sweepArea(boxes, count, limits[strip], limits[strip + 1u]);
+        }
+      },
+      strips,
+      1u
+    );
+
+    double area = 0.0;
+    for (double stripArea : areas) {
+      area += stripArea;
+    }
+
+    return area;
+  }
+
+}
+
+#endif    /* BOX_REDUCTION_HXX */
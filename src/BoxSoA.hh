@@ -0,0 +1,118 @@
+#ifndef    BOX_SOA_HH
+# define   BOX_SOA_HH
+
+# include <vector>
+# include <cstdint>
+# include "Box.hh"
+# include "AlignedAllocator.hh"
+
+namespace utils {
+
+  /**
+   * @brief - Stores a collection of boxes as a structure of arrays holding
+   *          the precomputed bounds of each box. The bounds are computed
+   *          with the same arithmetic as `Box::getLeftBound` and similar
+   *          methods so that queries on this container give exactly the
+   *          same results as the corresponding methods of `Box`.
+   *          Note that for integer coordinates a box can't always be built
+   *          back from its bounds (the half dimensions are truncated) so
+   *          this container only exposes the bounds.
+   */
+  template <typename CoordinateType>
+  class BoxSoA {
+    public:
+
+      BoxSoA() = default;
+
+      explicit
+      BoxSoA(const std::vector<Box<CoordinateType>>& boxes);
+
+      std::size_t
+      size() const noexcept;
+
+      bool
+      empty() const noexcept;
+
+      void
+      reserve(std::size_t size);
+
+      void
+      clear() noexcept;
+
+      void
+      push_back(const Box<CoordinateType>& box);
+
+      /**
+       * @brief - Replaces the bounds stored at index `id` with the ones of
+       *          `box`. No bound checking is performed.
+       */
+      void
+      set(std::size_t id, const Box<CoordinateType>& box) noexcept;
+
+      /**
+       * @brief - Replaces the content of this container with the bounds of
+       *          the input boxes, reusing the allocated storage.
+       */
+      void
+      assign(const std::vector<Box<CoordinateType>>& boxes);
+
+      const CoordinateType*
+      left() const noexcept;
+
+      const CoordinateType*
+      right() const noexcept;
+
+      const CoordinateType*
+      bottom() const noexcept;
+
+      const CoordinateType*
+      top() const noexcept;
+
+    private:
+
+      AlignedVector<CoordinateType> m_left;
+      AlignedVector<CoordinateType> m_right;
+      AlignedVector<CoordinateType> m_bottom;
+      AlignedVector<CoordinateType> m_top;
+  };
+
+  using BoxfSoA = BoxSoA<float>;
+  using BoxiSoA = BoxSoA<int>;
+
+  /**
+   * @brief - Tests the `query` box against all the boxes of the input
+   *          container. The result for each box is the same as the one
+   *          of `query.intersects(box, strict)`.
+   *          For `float` and `int` coordinates the test is performed on
+   *          several boxes at once using SSE or AVX2 when available.
+   * @param query - the box to test against all the others.
+   * @param boxes - the boxes to test.
+   * @param outMask - an array of at least `boxes.size()` values which is
+   *                  set to `1` for boxes intersecting `query` and `0` for
+   *                  the others.
+   * @param strict - `true` if touching boxes should not be reported as
+   *                 intersecting.
+   * @return - the number of boxes intersecting `query`.
+   */
+  template <typename CoordinateType>
+  std::size_t
+  intersectsMany(const Box<CoordinateType>& query,
+                 const BoxSoA<CoordinateType>& boxes,
+                 std::uint8_t* outMask,
+                 bool strict = false) noexcept;
+
+  /**
+   * @brief - Similar to `intersectsMany` but each box is tested with the
+   *          semantic of `query.intersectsBottomLeft(box)`.
+   */
+  template <typename CoordinateType>
+  std::size_t
+  intersectsBottomLeftMany(const Box<CoordinateType>& query,
+                           const BoxSoA<CoordinateType>& boxes,
+                           std::uint8_t* outMask) noexcept;
+
+}
+
+# include "BoxSoA.hxx"
+
+#endif    /* BOX_SOA_HH */
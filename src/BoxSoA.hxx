@@ -0,0 +1,282 @@
+#ifndef    BOX_SOA_HXX
+# define   BOX_SOA_HXX
+
+# include <type_traits>
+# include "BoxSoA.hh"
+# include "SimdUtils.hh"
+
+namespace utils {
+  namespace details {
+
+    // Intersection tests are expressed as four comparisons between the
+    // bounds of the query and the bounds of each box:
+    //  - `qL ? R` and `qB ? T` use `<` when `LowStrict` and `<=` otherwise.
+    //  - `L ? qR` and `B ? qT` use `<` when `HighStrict` and `<=` otherwise.
+    // This covers both flavors of `Box::intersects` and the mixed semantic
+    // of `Box::intersectsBottomLeft`.
+
+    template <bool Strict, typename CoordinateType>
+    inline
+    bool
+    boundsCompare(const CoordinateType& lhs, const CoordinateType& rhs) noexcept {
+      return Strict ? lhs < rhs : lhs <= rhs;
+    }
+
+    template <bool LowStrict, bool HighStrict, typename CoordinateType>
+    inline
+    std::size_t
+    intersectsManyScalar(const CoordinateType qL, const CoordinateType qR,
+                         const CoordinateType qB, const CoordinateType qT,
+                         const BoxSoA<CoordinateType>& boxes,
+                         std::uint8_t* outMask,
+                         std::size_t start) noexcept
+    {
+      const CoordinateType* l = boxes.left();
+      const CoordinateType* r = boxes.right();
+      const CoordinateType* b = boxes.bottom();
+      const CoordinateType* t = boxes.top();
+
+      std::size_t count = 0u;
+      for (std::size_t id = start ; id < boxes.size() ; ++id) {
+        const bool hit =
+          boundsCompare<LowStrict>(qL, r[id]) &&
+          boundsCompare<HighStrict>(l[id], qR) &&
+          boundsCompare<LowStrict>(qB, t[id]) &&
+          boundsCompare<HighStrict>(b[id], qT)
+        ;
+
+        outMask[id] = hit ? 1u : 0u;
+        count += (hit ? 1u : 0u);
+      }
+
+      return count;
+    }
+
+    template <bool LowStrict, bool HighStrict, typename CoordinateType>
+    inline
+    std::size_t
+    intersectsManyKernel(const CoordinateType qL, const CoordinateType qR,
+                         const CoordinateType qB, const CoordinateType qT,
+                         const BoxSoA<CoordinateType>& boxes,
+                         std::uint8_t* outMask,
+                         std::false_type /*vectorized*/) noexcept
+    {
+      return intersectsManyScalar<LowStrict, HighStrict>(qL, qR, qB, qT, boxes, outMask, 0u);
+    }
+
+# if defined(MATHS_UTILS_SIMD)
+
+    template <bool Strict, typename PackType>
+    inline
+    PackType
+    boundsComparePack(PackType lhs, PackType rhs) noexcept {
+      return Strict ? simd::lessThan(lhs, rhs) : simd::lessOrEqual(lhs, rhs);
+    }
+
+    template <bool LowStrict, bool HighStrict, typename CoordinateType>
+    inline
+    std::size_t
+    intersectsManyKernel(const CoordinateType qL, const CoordinateType qR,
+                         const CoordinateType qB, const CoordinateType qT,
+                         const BoxSoA<CoordinateType>& boxes,
+                         std::uint8_t* outMask,
+                         std::true_type /*vectorized*/) noexcept
+    {
+      using PackType = typename simd::Pack<CoordinateType>::Type;
+      constexpr std::size_t width = simd::Pack<CoordinateType>::width;
+
+      const PackType vqL = simd::broadcast(qL);
+      const PackType vqR = simd::broadcast(qR);
+      const PackType vqB = simd::broadcast(qB);
+      const PackType vqT = simd::broadcast(qT);
+
+      const CoordinateType* l = boxes.left();
+      const CoordinateType* r = boxes.right();
+      const CoordinateType* b = boxes.bottom();
+      const CoordinateType* t = boxes.top();
+
+      std::size_t count = 0u;
+      std::size_t id = 0u;
+      for ( ; id + width <= boxes.size() ; id += width) {
+        const PackType hits = simd::maskAnd(
+          simd::maskAnd(
+            boundsComparePack<LowStrict>(vqL, simd::load(r + id)),
+            boundsComparePack<HighStrict>(simd::load(l + id), vqR)
+          ),
+          simd::maskAnd(
+            boundsComparePack<LowStrict>(vqB, simd::load(t + id)),
+            boundsComparePack<HighStrict>(simd::load(b + id), vqT)
+          )
+        );
+
+        const int bits = simd::movemask(hits);
+        for (std::size_t lane = 0u ; lane < width ; ++lane) {
+          const std::uint8_t hit = static_cast<std::uint8_t>((bits >> lane) & 1);
+          outMask[id + lane] = hit;
+          count += hit;
+        }
+      }
+
+      return count + intersectsManyScalar<LowStrict, HighStrict>(qL, qR, qB, qT, boxes, outMask, id);
+    }
+
+# endif
+
+    template <bool LowStrict, bool HighStrict, typename CoordinateType>
+    inline
+    std::size_t
+    intersectsMany(const Box<CoordinateType>& query,
+                   const BoxSoA<CoordinateType>& boxes,
+                   std::uint8_t* outMask) noexcept
+    {
+      return intersectsManyKernel<LowStrict, HighStrict>(
+        query.getLeftBound(),
+        query.getRightBound(),
+        query.getBottomBound(),
+        query.getTopBound(),
+        boxes,
+        outMask,
+        std::integral_constant<bool, simd::Pack<CoordinateType>::supported>()
+      );
+    }
+
+  }
+
+  template <typename CoordinateType>
+  inline
+  BoxSoA<CoordinateType>::BoxSoA(const std::vector<Box<CoordinateType>>& boxes):
+    m_left(),
+    m_right(),
+    m_bottom(),
+    m_top()
+  {
+    assign(boxes);
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  BoxSoA<CoordinateType>::size() const noexcept {
+    return m_left.size();
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  BoxSoA<CoordinateType>::empty() const noexcept {
+    return m_left.empty();
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  BoxSoA<CoordinateType>::reserve(std::size_t size) {
+    m_left.reserve(size);
+    m_right.reserve(size);
+    m_bottom.reserve(size);
+    m_top.reserve(size);
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  BoxSoA<CoordinateType>::clear() noexcept {
+    m_left.clear();
+    m_right.clear();
+    m_bottom.clear();
+    m_top.clear();
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  BoxSoA<CoordinateType>::push_back(const Box<CoordinateType>& box) {
+    m_left.push_back(box.getLeftBound());
+    m_right.push_back(box.getRightBound());
+    m_bottom.push_back(box.getBottomBound());
+    m_top.push_back(box.getTopBound());
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  BoxSoA<CoordinateType>::set(std::size_t id, const Box<CoordinateType>& box) noexcept {
+    m_left[id] = box.getLeftBound();
+    m_right[id] = box.getRightBound();
+    m_bottom[id] = box.getBottomBound();
+    m_top[id] = box.getTopBound();
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  BoxSoA<CoordinateType>::assign(const std::vector<Box<CoordinateType>>& boxes) {
+    m_left.resize(boxes.size());
+    m_right.resize(boxes.size());
+    m_bottom.resize(boxes.size());
+    m_top.resize(boxes.size());
+
+    for (std::size_t id = 0u ; id < boxes.size() ; ++id) {
+      set(id, boxes[id]);
+    }
+  }
+
+  template <typename CoordinateType>
+  inline
+  const CoordinateType*
+  BoxSoA<CoordinateType>::left() const noexcept {
+    return m_left.data();
+  }
+
+  template <typename CoordinateType>
+  inline
+  const CoordinateType*
+  BoxSoA<CoordinateType>::right() const noexcept {
+    return m_right.data();
+  }
+
+  template <typename CoordinateType>
+  inline
+  const CoordinateType*
+  BoxSoA<CoordinateType>::bottom() const noexcept {
+    return m_bottom.data();
+  }
+
+  template <typename CoordinateType>
+  inline
+  const CoordinateType*
+  BoxSoA<CoordinateType>::top() const noexcept {
+    return m_top.data();
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  intersectsMany(const Box<CoordinateType>& query,
+                 const BoxSoA<CoordinateType>& boxes,
+                 std::uint8_t* outMask,
+                 bool strict) noexcept
+  {
+    if (strict) {
+      return details::intersectsMany<true, true>(query, boxes, outMask);
+    }
+
+    return details::intersectsMany<false, false>(query, boxes, outMask);
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  intersectsBottomLeftMany(const Box<CoordinateType>& query,
+                           const BoxSoA<CoordinateType>& boxes,
+                           std::uint8_t* outMask) noexcept
+  {
+    // `intersectsBottomLeft` rejects boxes starting at or after the right
+    // and top bounds of the query but accepts boxes ending exactly on its
+    // left and bottom bounds.
+    return details::intersectsMany<false, true>(query, boxes, outMask);
+  }
+
+}
+
+#endif    /* BOX_SOA_HXX */
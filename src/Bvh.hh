@@ -0,0 +1,176 @@
+#ifndef    BVH_HH
+# define   BVH_HH
+
+# include <vector>
+# include <cstdint>
+# include "Box.hh"
+# include "Bounds.hh"
+
+namespace utils {
+
+  /**
+   * @brief - A static bounding volume hierarchy built over a set of boxes.
+   *          The hierarchy is built once with a binned surface area
+   *          heuristic and stored as a flat array of nodes where siblings
+   *          are adjacent, which keeps traversals cache friendly.
+   *          Queries report the index of the boxes in the array used to
+   *          build the hierarchy and have the same semantic as the
+   *          corresponding methods of `Box`.
+   *          The hierarchy does not support updates: it should be built
+   *          again when the boxes change.
+   */
+  template <typename CoordinateType>
+  class Bvh {
+    public:
+
+      Bvh() = default;
+
+      /**
+       * @brief - Builds the hierarchy over the input boxes.
+       * @param boxes - the boxes to index.
+       */
+      explicit
+      Bvh(const std::vector<Box<CoordinateType>>& boxes);
+
+      /**
+       * @brief - Builds the hierarchy over the `count` boxes starting at
+       *          `boxes`. Any previous content is discarded.
+       * @param boxes - a pointer to the first box to index.
+       * @param count - the number of boxes to index.
+       */
+      void
+      build(const Box<CoordinateType>* boxes, std::size_t count);
+
+      std::size_t
+      size() const noexcept;
+
+      bool
+      empty() const noexcept;
+
+      /**
+       * @brief - Calls `callback` with the index of each box `b` for which
+       *          `area.intersects(b, strict)` is `true`.
+       * @param area - the area to query.
+       * @param callback - a callable accepting a `std::size_t`.
+       * @param strict - whether touching boxes are considered intersecting.
+       */
+      template <typename Callback>
+      void
+      forEachIntersecting(const Box<CoordinateType>& area,
+                          Callback&& callback,
+                          bool strict = false) const;
+
+      /**
+       * @brief - Similar to `forEachIntersecting` but appends the indices
+       *          of the intersecting boxes to `out`.
+       */
+      void
+      intersecting(const Box<CoordinateType>& area,
+                   std::vector<std::size_t>& out,
+                   bool strict = false) const;
+
+      /**
+       * @brief - Calls `callback` with the index of each box `b` for which
+       *          `b.contains(point)` is `true`.
+       * @param point - the point to query.
+       * @param callback - a callable accepting a `std::size_t`.
+       */
+      template <typename Callback>
+      void
+      forEachContaining(const Vector2<CoordinateType>& point,
+                        Callback&& callback) const;
+
+      /**
+       * @brief - Similar to `forEachContaining` but appends the indices of
+       *          the boxes containing the point to `out`.
+       */
+      void
+      containing(const Vector2<CoordinateType>& point,
+                 std::vector<std::size_t>& out) const;
+
+      /**
+       * @brief - Finds the box closest to the input point, i.e. the one for
+       *          which the squared distance `d2` between `point` and the
+       *          nearest point of the box is the smallest. A box containing
+       *          the point is at a distance of `0`.
+       * @param point - the point to query.
+       * @param index - output argument receiving the index of the nearest box.
+       * @param dist2 - output argument receiving the squared distance to the
+       *                nearest box.
+       * @return - `true` if a box was found (i.e. the hierarchy is not empty).
+       */
+      bool
+      nearest(const Vector2<CoordinateType>& point,
+              std::size_t& index,
+              float& dist2) const noexcept;
+
+    private:
+
+      /**
+       * @brief - A node of the hierarchy. Internal nodes have a `count` of
+       *          `0` and their children are at indices `first` and `first + 1`
+       *          in the nodes array. Leaves reference `count` elements of the
+       *          items array starting at `first`.
+       */
+      struct Node {
+        Bounds<CoordinateType> bounds;
+        std::uint32_t first;
+        std::uint32_t count;
+      };
+
+      /**
+       * @brief - The maximum number of items in a leaf.
+       */
+      static constexpr std::uint32_t kMaxLeafSize = 4u;
+
+      /**
+       * @brief - The number of bins used to evaluate the split candidates.
+       */
+      static constexpr std::size_t kBinsCount = 16u;
+
+      /**
+       * @brief - Beyond this depth nodes are split at the median so that the
+       *          depth of the hierarchy (and the size of the traversal stack)
+       *          stays bounded whatever the distribution of the boxes.
+       */
+      static constexpr unsigned kMaxSahDepth = 32u;
+
+      /**
+       * @brief - The size of the stack used by traversals: enough for the SAH
+       *          levels and median levels for any number of items.
+       */
+      static constexpr std::size_t kStackSize = kMaxSahDepth + 40u;
+
+      void
+      subdivide(std::uint32_t node,
+                const std::vector<Vector2<CoordinateType>>& centroids,
+                unsigned depth);
+
+      bool
+      findSahSplit(const Node& node,
+                   const std::vector<Vector2<CoordinateType>>& centroids,
+                   std::uint32_t& mid) noexcept;
+
+      void
+      medianSplit(const Node& node,
+                  const std::vector<Vector2<CoordinateType>>& centroids,
+                  std::uint32_t& mid) noexcept;
+
+      void
+      computeBounds(Node& node) const noexcept;
+
+    private:
+
+      std::vector<Node> m_nodes;
+      std::vector<Bounds<CoordinateType>> m_bounds;
+      std::vector<std::uint32_t> m_items;
+  };
+
+  using Bvhf = Bvh<float>;
+  using Bvhi = Bvh<int>;
+
+}
+
+# include "Bvh.hxx"
+
+#endif    /* BVH_HH */
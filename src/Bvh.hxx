@@ -0,0 +1,455 @@
+#ifndef    BVH_HXX
+# define   BVH_HXX
+
+# include <limits>
+# include <algorithm>
+# include "Bvh.hh"
+# include "LocationUtils.hh"
+
+namespace utils {
+  namespace details {
+
+    template <typename CoordinateType>
+    inline
+    Bounds<CoordinateType>
+    emptyBounds() noexcept {
+      return Bounds<CoordinateType>(Vector2<CoordinateType>::max(), Vector2<CoordinateType>::min());
+    }
+
+    template <typename CoordinateType>
+    inline
+    Bounds<CoordinateType>
+    merge(const Bounds<CoordinateType>& lhs, const Bounds<CoordinateType>& rhs) noexcept {
+      return Bounds<CoordinateType>(
+        std::min(lhs.getLeftBound(), rhs.getLeftBound()),
+        std::min(lhs.getBottomBound(), rhs.getBottomBound()),
+        std::max(lhs.getRightBound(), rhs.getRightBound()),
+        std::max(lhs.getTopBound(), rhs.getTopBound())
+      );
+    }
+
+    template <typename CoordinateType>
+    inline
+    float
+    halfPerimeter(const Bounds<CoordinateType>& bounds) noexcept {
+      // For a 2D hierarchy the probability to hit a node is proportional to
+      // its perimeter rather than its area: this also gives a sensible cost
+      // to flat boxes.
+      return static_cast<float>(bounds.w()) + static_cast<float>(bounds.h());
+    }
+
+    template <typename CoordinateType>
+    inline
+    const CoordinateType&
+    axisValue(const Vector2<CoordinateType>& v, unsigned axis) noexcept {
+      return axis == 0u ? v.x() : v.y();
+    }
+
+  }
+
+  template <typename CoordinateType>
+  inline
+  Bvh<CoordinateType>::Bvh(const std::vector<Box<CoordinateType>>& boxes):
+    m_nodes(),
+    m_bounds(),
+    m_items()
+  {
+    build(boxes.data(), boxes.size());
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Bvh<CoordinateType>::build(const Box<CoordinateType>* boxes, std::size_t count) {
+    m_nodes.clear();
+    m_bounds.clear();
+    m_items.clear();
+
+    if (count == 0u) {
+      return;
+    }
+
+    // Centroids are kept doubled (i.e. `min + max`) to avoid a division
+    // which would also truncate integer coordinates.
+    std::vector<Vector2<CoordinateType>> centroids;
+    centroids.reserve(count);
+    m_bounds.reserve(count);
+    m_items.resize(count);
+
+    for (std::size_t id = 0u ; id < count ; ++id) {
+      m_bounds.emplace_back(boxes[id]);
+      centroids.emplace_back(
+        m_bounds.back().getLeftBound() + m_bounds.back().getRightBound(),
+        m_bounds.back().getBottomBound() + m_bounds.back().getTopBound()
+      );
+      m_items[id] = static_cast<std::uint32_t>(id);
+    }
+
+    // A binary tree with at least one item per leaf has at most `2n - 1`
+    // nodes: reserving them upfront keeps references valid while building.
+    m_nodes.reserve(2u * count - 1u);
+    m_nodes.push_back(Node{details::emptyBounds<CoordinateType>(), 0u, static_cast<std::uint32_t>(count)});
+    computeBounds(m_nodes.back());
+
+    subdivide(0u, centroids, 0u);
+
+    // Reorder the bounds of the items to match the order of the leaves so
+    // that traversals read them sequentially.
+    std::vector<Bounds<CoordinateType>> ordered;
+    ordered.reserve(count);
+    for (std::size_t id = 0u ; id < count ; ++id) {
+      ordered.push_back(m_bounds[m_items[id]]);
+    }
+    m_bounds.swap(ordered);
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  Bvh<CoordinateType>::size() const noexcept {
+    return m_items.size();
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Bvh<CoordinateType>::empty() const noexcept {
+    return m_items.empty();
+  }
+
+  template <typename CoordinateType>
+  template <typename Callback>
+  inline
+  void
+  Bvh<CoordinateType>::forEachIntersecting(const Box<CoordinateType>& area,
+                                           Callback&& callback,
+                                           bool strict) const
+  {
+    if (m_nodes.empty()) {
+      return;
+    }
+
+    const Bounds<CoordinateType> query(area);
+
+    std::uint32_t stack[kStackSize];
+    std::size_t top = 0u;
+    stack[top++] = 0u;
+
+    while (top > 0u) {
+      const Node& node = m_nodes[stack[--top]];
+
+      // Nodes are always tested with a non strict comparison: the bounds of
+      // a node can be touching the query while one of its children is not.
+      if (!query.intersects(node.bounds)) {
+        continue;
+      }
+
+      if (node.count == 0u) {
+        stack[top++] = node.first;
+        stack[top++] = node.first + 1u;
+        continue;
+      }
+
+      for (std::uint32_t id = node.first ; id < node.first + node.count ; ++id) {
+        if (query.intersects(m_bounds[id], strict)) {
+          callback(static_cast<std::size_t>(m_items[id]));
+        }
+      }
+    }
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Bvh<CoordinateType>::intersecting(const Box<CoordinateType>& area,
+                                    std::vector<std::size_t>& out,
+                                    bool strict) const
+  {
+    forEachIntersecting(
+      area,
+      [&out](std::size_t id) {
+        out.push_back(id);
+      },
+      strict
+    );
+  }
+
+  template <typename CoordinateType>
+  template <typename Callback>
+  inline
+  void
+  Bvh<CoordinateType>::forEachContaining(const Vector2<CoordinateType>& point,
+                                         Callback&& callback) const
+  {
+    if (m_nodes.empty()) {
+      return;
+    }
+
+    std::uint32_t stack[kStackSize];
+    std::size_t top = 0u;
+    stack[top++] = 0u;
+
+    while (top > 0u) {
+      const Node& node = m_nodes[stack[--top]];
+
+      if (!node.bounds.contains(point)) {
+        continue;
+      }
+
+      if (node.count == 0u) {
+        stack[top++] = node.first;
+        stack[top++] = node.first + 1u;
+        continue;
+      }
+
+      for (std::uint32_t id = node.first ; id < node.first + node.count ; ++id) {
+        if (m_bounds[id].contains(point)) {
+          callback(static_cast<std::size_t>(m_items[id]));
+        }
+      }
+    }
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Bvh<CoordinateType>::containing(const Vector2<CoordinateType>& point,
+                                  std::vector<std::size_t>& out) const
+  {
+    forEachContaining(
+      point,
+      [&out](std::size_t id) {
+        out.push_back(id);
+      }
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Bvh<CoordinateType>::nearest(const Vector2<CoordinateType>& point,
+                               std::size_t& index,
+                               float& dist2) const noexcept
+  {
+    if (m_nodes.empty()) {
+      return false;
+    }
+
+    struct Entry {
+      std::uint32_t node;
+      float dist2;
+    };
+
+    Entry stack[kStackSize];
+    std::size_t top = 0u;
+    stack[top++] = Entry{0u, d2(point, m_nodes[0u].bounds.getNearestPoint(point))};
+
+    float best = std::numeric_limits<float>::max();
+    std::uint32_t bestItem = 0u;
+
+    while (top > 0u) {
+      const Entry entry = stack[--top];
+      if (entry.dist2 >= best) {
+        continue;
+      }
+
+      const Node& node = m_nodes[entry.node];
+
+      if (node.count > 0u) {
+        for (std::uint32_t id = node.first ; id < node.first + node.count ; ++id) {
+          const float d = d2(point, m_bounds[id].getNearestPoint(point));
+          if (d < best) {
+            best = d;
+            bestItem = m_items[id];
+          }
+        }
+
+        continue;
+      }
+
+      // Push the farthest child first so that the closest one is visited
+      // first: this helps pruning the other one.
+      const Entry left{node.first, d2(point, m_nodes[node.first].bounds.getNearestPoint(point))};
+      const Entry right{node.first + 1u, d2(point, m_nodes[node.first + 1u].bounds.getNearestPoint(point))};
+
+      if (left.dist2 < right.dist2) {
+        stack[top++] = right;
+        stack[top++] = left;
+      }
+      else {
+        stack[top++] = left;
+        stack[top++] = right;
+      }
+    }
+
+    index = bestItem;
+    dist2 = best;
+
+    return true;
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Bvh<CoordinateType>::subdivide(std::uint32_t node,
+                                 const std::vector<Vector2<CoordinateType>>& centroids,
+                                 unsigned depth)
+  {
+    if (m_nodes[node].count <= kMaxLeafSize) {
+      return;
+    }
+
+    std::uint32_t mid = 0u;
+    if (depth >= kMaxSahDepth || !findSahSplit(m_nodes[node], centroids, mid)) {
+      medianSplit(m_nodes[node], centroids, mid);
+    }
+
+    const std::uint32_t first = m_nodes[node].first;
+    const std::uint32_t end = first + m_nodes[node].count;
+    const std::uint32_t left = static_cast<std::uint32_t>(m_nodes.size());
+
+    m_nodes.push_back(Node{details::emptyBounds<CoordinateType>(), first, mid - first});
+    computeBounds(m_nodes.back());
+    m_nodes.push_back(Node{details::emptyBounds<CoordinateType>(), mid, end - mid});
+    computeBounds(m_nodes.back());
+
+    m_nodes[node].first = left;
+    m_nodes[node].count = 0u;
+
+    subdivide(left, centroids, depth + 1u);
+    subdivide(left + 1u, centroids, depth + 1u);
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Bvh<CoordinateType>::findSahSplit(const Node& node,
+                                    const std::vector<Vector2<CoordinateType>>& centroids,
+                                    std::uint32_t& mid) noexcept
+  {
+    const std::uint32_t first = node.first;
+    const std::uint32_t end = node.first + node.count;
+
+    Vector2<CoordinateType> cMin = Vector2<CoordinateType>::max();
+    Vector2<CoordinateType> cMax = Vector2<CoordinateType>::min();
+    for (std::uint32_t id = first ; id < end ; ++id) {
+      const Vector2<CoordinateType>& c = centroids[m_items[id]];
+      cMin = Vector2<CoordinateType>(std::min(cMin.x(), c.x()), std::min(cMin.y(), c.y()));
+      cMax = Vector2<CoordinateType>(std::max(cMax.x(), c.x()), std::max(cMax.y(), c.y()));
+    }
+
+    float bestCost = std::numeric_limits<float>::max();
+    unsigned bestAxis = 0u;
+    std::size_t bestPlane = 0u;
+
+    for (unsigned axis = 0u ; axis < 2u ; ++axis) {
+      const CoordinateType low = details::axisValue(cMin, axis);
+      const float extent = static_cast<float>(details::axisValue(cMax, axis) - low);
+      if (extent <= 0.0f) {
+        continue;
+      }
+
+      std::uint32_t counts[kBinsCount] = {};
+      Bounds<CoordinateType> bins[kBinsCount];
+      std::fill(bins, bins + kBinsCount, details::emptyBounds<CoordinateType>());
+
+      const float scale = static_cast<float>(kBinsCount) / extent;
+      for (std::uint32_t id = first ; id < end ; ++id) {
+        const std::uint32_t item = m_items[id];
+        const float rel = static_cast<float>(details::axisValue(centroids[item], axis) - low) * scale;
+        const std::size_t bin = std::min(static_cast<std::size_t>(rel), kBinsCount - 1u);
+
+        ++counts[bin];
+        bins[bin] = details::merge(bins[bin], m_bounds[item]);
+      }
+
+      // Sweep from the right to compute the cost of the right side of
+      // each plane and then from the left to evaluate the full cost.
+      float rightCosts[kBinsCount] = {};
+      Bounds<CoordinateType> acc = details::emptyBounds<CoordinateType>();
+      std::uint32_t count = 0u;
+      for (std::size_t bin = kBinsCount - 1u ; bin > 0u ; --bin) {
+        acc = details::merge(acc, bins[bin]);
+        count += counts[bin];
+        rightCosts[bin - 1u] = (count > 0u ? count * details::halfPerimeter(acc) : 0.0f);
+      }
+
+      acc = details::emptyBounds<CoordinateType>();
+      count = 0u;
+      for (std::size_t plane = 0u ; plane < kBinsCount - 1u ; ++plane) {
+        acc = details::merge(acc, bins[plane]);
+        count += counts[plane];
+
+        if (count == 0u || count == node.count) {
+          continue;
+        }
+
+        const float cost = count * details::halfPerimeter(acc) + rightCosts[plane];
+        if (cost < bestCost) {
+          bestCost = cost;
+          bestAxis = axis;
+          bestPlane = plane;
+        }
+      }
+    }
+
+    if (bestCost == std::numeric_limits<float>::max()) {
+      return false;
+    }
+
+    const CoordinateType low = details::axisValue(cMin, bestAxis);
+    const float scale = static_cast<float>(kBinsCount) / static_cast<float>(details::axisValue(cMax, bestAxis) - low);
+
+    std::uint32_t* split = std::partition(
+      m_items.data() + first,
+      m_items.data() + end,
+      [&](std::uint32_t item) {
+        const float rel = static_cast<float>(details::axisValue(centroids[item], bestAxis) - low) * scale;
+        return std::min(static_cast<std::size_t>(rel), kBinsCount - 1u) <= bestPlane;
+      }
+    );
+
+    mid = static_cast<std::uint32_t>(split - m_items.data());
+    return mid != first && mid != end;
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Bvh<CoordinateType>::medianSplit(const Node& node,
+                                   const std::vector<Vector2<CoordinateType>>& centroids,
+                                   std::uint32_t& mid) noexcept
+  {
+    const unsigned axis = (node.bounds.w() >= node.bounds.h() ? 0u : 1u);
+
+    std::uint32_t* first = m_items.data() + node.first;
+    std::uint32_t* end = first + node.count;
+    std::uint32_t* median = first + node.count / 2u;
+
+    std::nth_element(
+      first,
+      median,
+      end,
+      [&](std::uint32_t lhs, std::uint32_t rhs) {
+        return details::axisValue(centroids[lhs], axis) < details::axisValue(centroids[rhs], axis);
+      }
+    );
+
+    mid = static_cast<std::uint32_t>(median - m_items.data());
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Bvh<CoordinateType>::computeBounds(Node& node) const noexcept {
+    Bounds<CoordinateType> bounds = details::emptyBounds<CoordinateType>();
+    for (std::uint32_t id = node.first ; id < node.first + node.count ; ++id) {
+      bounds = details::merge(bounds, m_bounds[m_items[id]]);
+    }
+
+    node.bounds = bounds;
+  }
+
+}
+
+#endif    /* BVH_HXX */
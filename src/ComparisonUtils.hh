@@ -2,21 +2,124 @@
 # define   COMPARISONUTILS_HH
 
 # include <limits>
+# include <type_traits>
 
 namespace utils {
 
+  /**
+   * @brief - Compares `value1` and `value2` within `epsilon`: both values
+   *          are equal if their difference is strictly smaller than the
+   *          tolerance. The default tolerance only absorbs denormals which
+   *          in practice compares floating point values exactly. Integers
+   *          follow the same rule: the default (negative) tolerance makes
+   *          them compared exactly.
+   */
   template <typename DataType>
-  bool
+  constexpr bool
   fuzzyEqual(const DataType& value1,
              const DataType& value2,
              const DataType& epsilon = std::numeric_limits<DataType>::min());
 
   template <typename DataType>
-  DataType
+  constexpr DataType
   clamp(const DataType& val,
         const DataType& min,
         const DataType& max);
 
+  /**
+   * @brief - Tolerances used by the comparison policies below. A tolerance
+   *          is a type exposing a `value<DataType>()` static function so
+   *          that it can be passed as a template parameter: custom ones can
+   *          be defined the same way.
+   *          `SmallestNormalTolerance` is the default tolerance of the
+   *          `fuzzyEqual` function while `MachineEpsilonTolerance` is the
+   *          relative precision of the type. Both are `0` for integers.
+   */
+  struct SmallestNormalTolerance {
+    template <typename DataType>
+    static constexpr DataType
+    value() noexcept;
+  };
+
+  struct MachineEpsilonTolerance {
+    template <typename DataType>
+    static constexpr DataType
+    value() noexcept;
+  };
+
+  /**
+   * @brief - Compares values with `==`. This is the cheapest comparison and
+   *          the one used for integers by all the other policies.
+   *          A comparison policy exposes an `equal(value1, value2)` static
+   *          function and is used to select at compile time how coordinates
+   *          of primitives are compared, see `DefaultComparison`.
+   */
+  struct ExactComparison {
+    template <typename DataType>
+    static constexpr bool
+    equal(const DataType& value1, const DataType& value2) noexcept;
+  };
+
+  /**
+   * @brief - Values are equal if their difference is strictly smaller than
+   *          the tolerance. With the default tolerance this is exactly what
+   *          `fuzzyEqual` does.
+   */
+  template <typename Tolerance = SmallestNormalTolerance>
+  struct AbsoluteComparison {
+    template <typename DataType>
+    static constexpr bool
+    equal(const DataType& value1, const DataType& value2) noexcept;
+  };
+
+  /**
+   * @brief - Values are equal if their difference is not larger than the
+   *          tolerance scaled by the largest magnitude of both values. This
+   *          is better suited than an absolute tolerance for values which
+   *          span several orders of magnitude, but values close to `0` are
+   *          then only equal to `0` itself.
+   */
+  template <typename Tolerance = MachineEpsilonTolerance>
+  struct RelativeComparison {
+    template <typename DataType>
+    static constexpr bool
+    equal(const DataType& value1, const DataType& value2) noexcept;
+  };
+
+  /**
+   * @brief - Values are equal if there are at most `MaxUlps` representable
+   *          floating point values between them: the tolerance scales with
+   *          the magnitude of the values without requiring a division. `-0`
+   *          and `0` are equal while `NaN` is not equal to anything.
+   *          This comparison inspects the binary representation of values
+   *          and can't be evaluated at compile time.
+   */
+  template <unsigned MaxUlps = 4u>
+  struct UlpComparison {
+    template <typename DataType>
+    static bool
+    equal(const DataType& value1, const DataType& value2) noexcept;
+  };
+
+  /**
+   * @brief - The comparison policy used by the `operator==` of primitives
+   *          with coordinates of type `DataType`: integers are compared
+   *          exactly and other types with `AbsoluteComparison<>`, which
+   *          matches `fuzzyEqual`.
+   *          This trait can be specialized to change the policy for a given
+   *          coordinate type: the specialization should be visible wherever
+   *          primitives using it are compared. A policy can also be picked
+   *          for a single comparison through the `equals` method.
+   */
+  template <typename DataType>
+  struct DefaultComparison {
+    using Type = typename std::conditional<
+      std::is_integral<DataType>::value,
+      ExactComparison,
+      AbsoluteComparison<>
+    >::type;
+  };
+
 }
 
 # include "ComparisonUtils.hxx"
@@ -1,33 +1,44 @@
 #ifndef    COMPARISONUTILS_HXX
 # define   COMPARISONUTILS_HXX
 
+# include <cstdint>
+# include <cstring>
+# include <algorithm>
 # include "ComparisonUtils.hh"
 
 namespace utils {
 
   template <typename DataType>
   inline
-  bool
+  constexpr bool
   fuzzyEqual(const DataType& value1,
              const DataType& value2,
              const DataType& epsilon)
   {
-    return std::abs(value1 - value2) < epsilon;
+    // `std::abs` is not usable in constant expressions.
+    return (value1 < value2 ? value2 - value1 : value1 - value2) < epsilon;
   }
 
   template <>
   inline
-  bool
+  constexpr bool
   fuzzyEqual(const int& value1,
              const int& value2,
              const int& epsilon)
   {
-    return value1 == value2;
+    // Handled separately to avoid overflowing when computing the difference
+    // of values with opposite signs.
+    if (value1 == value2) {
+      return true;
+    }
+
+    const std::int64_t diff = static_cast<std::int64_t>(value1) - static_cast<std::int64_t>(value2);
+    return (diff < 0 ? -diff : diff) < static_cast<std::int64_t>(epsilon);
   }
 
   template <typename DataType>
   inline
-  DataType
+  constexpr DataType
   clamp(const DataType& val,
         const DataType& min,
         const DataType& max)
@@ -35,6 +46,112 @@ namespace utils {
     return std::min(std::max(val, min), max);
   }
 
+  template <typename DataType>
+  inline
+  constexpr DataType
+  SmallestNormalTolerance::value() noexcept {
+    return (std::is_integral<DataType>::value ? DataType() : std::numeric_limits<DataType>::min());
+  }
+
+  template <typename DataType>
+  inline
+  constexpr DataType
+  MachineEpsilonTolerance::value() noexcept {
+    return std::numeric_limits<DataType>::epsilon();
+  }
+
+  template <typename DataType>
+  inline
+  constexpr bool
+  ExactComparison::equal(const DataType& value1, const DataType& value2) noexcept {
+    return value1 == value2;
+  }
+
+  template <typename Tolerance>
+  template <typename DataType>
+  inline
+  constexpr bool
+  AbsoluteComparison<Tolerance>::equal(const DataType& value1, const DataType& value2) noexcept {
+    if constexpr (std::is_integral<DataType>::value) {
+      return value1 == value2;
+    }
+    else {
+      return (value1 < value2 ? value2 - value1 : value1 - value2) < Tolerance::template value<DataType>();
+    }
+  }
+
+  template <typename Tolerance>
+  template <typename DataType>
+  inline
+  constexpr bool
+  RelativeComparison<Tolerance>::equal(const DataType& value1, const DataType& value2) noexcept {
+    if constexpr (std::is_integral<DataType>::value) {
+      return value1 == value2;
+    }
+    else {
+      const DataType diff = (value1 < value2 ? value2 - value1 : value1 - value2);
+      const DataType abs1 = (value1 < DataType() ? -value1 : value1);
+      const DataType abs2 = (value2 < DataType() ? -value2 : value2);
+
+      // The equality check handles infinite values.
+      return value1 == value2 || diff <= Tolerance::template value<DataType>() * std::max(abs1, abs2);
+    }
+  }
+
+  namespace details {
+
+    /**
+     * @brief - Unsigned integer type with the same size as `DataType` used
+     *          to inspect the binary representation of floating point values.
+     */
+    template <typename DataType>
+    using FloatBits = typename std::conditional<sizeof(DataType) == 4u, std::uint32_t, std::uint64_t>::type;
+
+  }
+
+  template <unsigned MaxUlps>
+  template <typename DataType>
+  inline
+  bool
+  UlpComparison<MaxUlps>::equal(const DataType& value1, const DataType& value2) noexcept {
+    if constexpr (std::is_integral<DataType>::value) {
+      return value1 == value2;
+    }
+    else {
+      static_assert(std::numeric_limits<DataType>::is_iec559, "UlpComparison requires IEEE 754 values");
+      static_assert(sizeof(DataType) == 4u || sizeof(DataType) == 8u, "UlpComparison requires single or double precision values");
+
+      using Bits = details::FloatBits<DataType>;
+
+      // `NaN` compare different from everything, including themselves.
+      if (value1 != value1 || value2 != value2) {
+        return false;
+      }
+
+      Bits bits1, bits2;
+      std::memcpy(&bits1, &value1, sizeof(Bits));
+      std::memcpy(&bits2, &value2, sizeof(Bits));
+
+      // Floating point values are stored as sign and magnitude and the
+      // magnitude of consecutive values differ by one: the distance is
+      // the difference of magnitudes for values with the same sign and
+      // the sum otherwise.
+      constexpr Bits sign = Bits(1u) << (8u * sizeof(Bits) - 1u);
+      const Bits mag1 = bits1 & ~sign;
+      const Bits mag2 = bits2 & ~sign;
+
+      Bits distance;
+      if ((bits1 & sign) != (bits2 & sign)) {
+        distance = mag1 + mag2;
+      }
+      else {
+        distance = (mag1 < mag2 ? mag2 - mag1 : mag1 - mag2);
+      }
+
+      return distance <= Bits(MaxUlps);
+    }
+  }
+
 }
 
 #endif    /* COMPARISONUTILS_HXX */
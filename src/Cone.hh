@@ -0,0 +1,91 @@
+#ifndef    CONE_HH
+# define   CONE_HH
+
+# include <cstddef>
+# include <cstdint>
+# include "Point2.hh"
+
+namespace utils {
+
+  class Cone {
+    public:
+
+      /**
+       * @brief - Creates a cone with its tip at `o`, principal direction
+       *          `(xDir, yDir)` and angle `theta`. The angle is assumed to
+       *          be distributed equally on both sides of the principal dir.
+       *          Everything needed to test points against the cone is
+       *          computed here so that the cone can be reused for many
+       *          points without evaluating any trigonometric function.
+       *          In case the length of the direction is close to `0` the
+       *          cone is aligned with the `x` axis.
+       * @param o - the tip of the cone.
+       * @param xDir - the abscissa of the principal direction of the cone.
+       * @param yDir - the ordinate of the principal direction of the cone.
+       * @param theta - the span of the cone in radians.
+       */
+      Cone(const Point2f& o,
+           float xDir,
+           float yDir,
+           float theta) noexcept;
+
+      const Point2f&
+      getTip() const noexcept;
+
+      /**
+       * @brief - Returns the normalized principal direction of the cone.
+       */
+      const Point2f&
+      getDirection() const noexcept;
+
+      float
+      getTheta() const noexcept;
+
+      /**
+       * @brief - Used to determine whether the point `p` lies inside the
+       *          cone, i.e. whether the angle between the principal dir
+       *          and the direction from the tip to `p` is smaller than half
+       *          of the span of the cone. Unlike comparing angles this does
+       *          not suffer from the wrap-around at `0` and `2pi`. The tip
+       *          itself is never considered inside.
+       * @param p - the point whose inclusion in the cone should be checked.
+       * @return - `true` if the point lies inside the cone.
+       */
+      bool
+      contains(const Point2f& p) const noexcept;
+
+      /**
+       * @brief - Batch version of `contains`: tests the `count` points and
+       *          stores `1` at the corresponding index in `outMask` for the
+       *          points lying inside the cone and `0` otherwise.
+       * @param points - the points to test.
+       * @param count - the number of points.
+       * @param outMask - output array with room for at least `count` values.
+       * @return - the number of points inside the cone.
+       */
+      std::size_t
+      contains(const Point2f* points,
+               std::size_t count,
+               std::uint8_t* outMask) const noexcept;
+
+    private:
+
+      Point2f m_tip;
+      Point2f m_dir;
+      float m_theta;
+
+      /**
+       * @brief - The signed square of the cosine of half the span of the
+       *          cone, i.e. `cos * |cos|`. Comparing `dot * |dot|` against
+       *          this value scaled by the squared distance to the tip is
+       *          equivalent to comparing the cosine of the angle with the
+       *          cosine of half the span but does not need a square root.
+       */
+      float m_cosSquared;
+  };
+
+}
+
+# include "Cone.hxx"
+
+#endif    /* CONE_HH */
@@ -0,0 +1,87 @@
+#ifndef    CONE_HXX
+# define   CONE_HXX
+
+# include <cmath>
+# include "Cone.hh"
+
+namespace utils {
+
+  inline
+  Cone::Cone(const Point2f& o,
+             float xDir,
+             float yDir,
+             float theta) noexcept:
+    m_tip(o),
+    m_dir(1.0f, 0.0f),
+    m_theta(theta),
+    m_cosSquared(1.0f)
+  {
+    const float l = std::sqrt(xDir * xDir + yDir * yDir);
+    if (l >= 0.0001f) {
+      m_dir = Point2f(xDir / l, yDir / l);
+    }
+
+    // A cone spanning the whole plane contains all points but its tip:
+    // any value smaller than `-1` achieves this.
+    const float halfTheta = theta / 2.0f;
+    if (halfTheta >= 3.1415926535f) {
+      m_cosSquared = -2.0f;
+    }
+    else if (halfTheta > 0.0f) {
+      const float c = std::cos(halfTheta);
+      m_cosSquared = c * std::abs(c);
+    }
+  }
+
+  inline
+  const Point2f&
+  Cone::getTip() const noexcept {
+    return m_tip;
+  }
+
+  inline
+  const Point2f&
+  Cone::getDirection() const noexcept {
+    return m_dir;
+  }
+
+  inline
+  float
+  Cone::getTheta() const noexcept {
+    return m_theta;
+  }
+
+  inline
+  bool
+  Cone::contains(const Point2f& p) const noexcept {
+    const float vx = p.x() - m_tip.x();
+    const float vy = p.y() - m_tip.y();
+
+    const float dot = vx * m_dir.x() + vy * m_dir.y();
+    const float l2 = vx * vx + vy * vy;
+
+    return dot * std::abs(dot) > l2 * m_cosSquared;
+  }
+
+  inline
+  std::size_t
+  Cone::contains(const Point2f* points,
+                 std::size_t count,
+                 std::uint8_t* outMask) const noexcept
+  {
+    // The test is branchless and made of a handful of products so this
+    // loop is vectorized by the compiler: doing it by hand with packs is
+    // actually slower as the mask has to be written lane by lane.
+    std::size_t inside = 0u;
+    for (std::size_t id = 0u ; id < count ; ++id) {
+      const std::uint8_t hit = (contains(points[id]) ? 1u : 0u);
+      outMask[id] = hit;
+      inside += hit;
+    }
+
+    return inside;
+  }
+
+}
+
+#endif    /* CONE_HXX */
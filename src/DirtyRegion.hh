@@ -0,0 +1,112 @@
+#ifndef    DIRTY_REGION_HH
+# define   DIRTY_REGION_HH
+
+# include <vector>
+# include <cstddef>
+# include <cstdint>
+# include "Box.hh"
+# include "Bounds.hh"
+
+namespace utils {
+
+  /**
+   * @brief - Accumulates the areas invalidated between two repaints and
+   *          keeps them as a small set of rectangles. Each invalidation is
+   *          merged with the rectangles already registered:
+   *            - areas already covered are dropped.
+   *            - rectangles covered by the new area are removed.
+   *            - overlapping or adjacent rectangles whose union does not
+   *              cover any extra pixel are coalesced.
+   *          When the number of rectangles exceeds the configured maximum
+   *          the pair whose union adds the least repainted area is merged
+   *          until the limit is met: this trades a bit of overdraw for fewer
+   *          draw calls.
+   *          An integer box is considered to cover `w` columns of pixels
+   *          starting at its left bound and `h` rows starting at its bottom
+   *          bound, so that boxes with odd dimensions are not truncated.
+   */
+  class DirtyRegion {
+    public:
+
+      /**
+       * @brief - Creates an empty region.
+       * @param maxRects - the maximum number of rectangles to keep, at least
+       *                   `1`.
+       */
+      explicit
+      DirtyRegion(std::size_t maxRects = 16u) noexcept;
+
+      /**
+       * @brief - Registers `area` as needing a repaint. Boxes with an empty
+       *          area are ignored.
+       * @param area - the invalidated area.
+       */
+      void
+      invalidate(const Boxi& area);
+
+      void
+      clear() noexcept;
+
+      bool
+      empty() const noexcept;
+
+      std::size_t
+      size() const noexcept;
+
+      std::size_t
+      getMaxRects() const noexcept;
+
+      /**
+       * @brief - The rectangles to repaint as bounds, the maximum being
+       *          excluded. They do not overlap with each other.
+       */
+      const std::vector<Bounds<int>>&
+      bounds() const noexcept;
+
+      /**
+       * @brief - The rectangles to repaint as boxes, with the same
+       *          convention as the invalidated boxes.
+       */
+      std::vector<Boxi>
+      rects() const;
+
+      /**
+       * @brief - The number of pixels to repaint.
+       */
+      std::int64_t
+      area() const noexcept;
+
+      /**
+       * @brief - Whether `area` shares at least one pixel with the region to
+       *          repaint.
+       */
+      bool
+      intersects(const Boxi& area) const noexcept;
+
+    private:
+
+      /**
+       * @brief - Inserts `rect`, merging it with the existing rectangles. The
+       *          rectangle is assumed to be non-empty.
+       */
+      void
+      insert(Bounds<int> rect);
+
+      /**
+       * @brief - Merges pairs of rectangles until at most `m_maxRects` are
+       *          left.
+       */
+      void
+      enforceLimit();
+
+    private:
+
+      std::size_t m_maxRects;
+      std::vector<Bounds<int>> m_rects;
+  };
+
+}
+
+# include "DirtyRegion.hxx"
+
+#endif    /* DIRTY_REGION_HH */
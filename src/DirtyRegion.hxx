@@ -0,0 +1,261 @@
+#ifndef    DIRTY_REGION_HXX
+# define   DIRTY_REGION_HXX
+
+# include <limits>
+# include <algorithm>
+# include "DirtyRegion.hh"
+
+namespace utils {
+  namespace details {
+
+    /**
+     * @brief - The pixels covered by an integer box: `w` columns starting at
+     *          its left bound and `h` rows starting at its bottom bound.
+     */
+    inline
+    Bounds<int>
+    pixelBounds(const Boxi& box) noexcept {
+      return Bounds<int>(
+        box.getLeftBound(),
+        box.getBottomBound(),
+        box.getLeftBound() + box.w(),
+        box.getBottomBound() + box.h()
+      );
+    }
+
+    inline
+    std::int64_t
+    pixels(const Bounds<int>& rect) noexcept {
+      return static_cast<std::int64_t>(rect.w()) * static_cast<std::int64_t>(rect.h());
+    }
+
+    inline
+    Bounds<int>
+    enclosing(const Bounds<int>& lhs, const Bounds<int>& rhs) noexcept {
+      return Bounds<int>(
+        std::min(lhs.getLeftBound(), rhs.getLeftBound()),
+        std::min(lhs.getBottomBound(), rhs.getBottomBound()),
+        std::max(lhs.getRightBound(), rhs.getRightBound()),
+        std::max(lhs.getTopBound(), rhs.getTopBound())
+      );
+    }
+
+    /**
+     * @brief - The number of pixels shared by both rectangles.
+     */
+    inline
+    std::int64_t
+    overlap(const Bounds<int>& lhs, const Bounds<int>& rhs) noexcept {
+      if (!lhs.intersects(rhs, true)) {
+        return 0;
+      }
+
+      return pixels(lhs.intersect(rhs));
+    }
+
+  }
+
+  inline
+  DirtyRegion::DirtyRegion(std::size_t maxRects) noexcept:
+    m_maxRects(std::max<std::size_t>(1u, maxRects)),
+    m_rects()
+  {}
+
+  inline
+  void
+  DirtyRegion::invalidate(const Boxi& area) {
+    if (area.w() <= 0 || area.h() <= 0) {
+      return;
+    }
+
+    const Bounds<int> rect = details::pixelBounds(area);
+
+    insert(rect);
+    enforceLimit();
+  }
+
+  inline
+  void
+  DirtyRegion::clear() noexcept {
+    m_rects.clear();
+  }
+
+  inline
+  bool
+  DirtyRegion::empty() const noexcept {
+    return m_rects.empty();
+  }
+
+  inline
+  std::size_t
+  DirtyRegion::size() const noexcept {
+    return m_rects.size();
+  }
+
+  inline
+  std::size_t
+  DirtyRegion::getMaxRects() const noexcept {
+    return m_maxRects;
+  }
+
+  inline
+  const std::vector<Bounds<int>>&
+  DirtyRegion::bounds() const noexcept {
+    return m_rects;
+  }
+
+  inline
+  std::vector<Boxi>
+  DirtyRegion::rects() const {
+    std::vector<Boxi> out;
+    out.reserve(m_rects.size());
+
+    for (const Bounds<int>& rect : m_rects) {
+      out.emplace_back(
+        rect.getLeftBound() + rect.w() / 2,
+        rect.getBottomBound() + rect.h() / 2,
+        rect.w(),
+        rect.h()
+      );
+    }
+
+    return out;
+  }
+
+  inline
+  std::int64_t
+  DirtyRegion::area() const noexcept {
+    std::int64_t total = 0;
+    for (const Bounds<int>& rect : m_rects) {
+      total += details::pixels(rect);
+    }
+
+    return total;
+  }
+
+  inline
+  bool
+  DirtyRegion::intersects(const Boxi& area) const noexcept {
+    const Bounds<int> rect = details::pixelBounds(area);
+
+    return std::any_of(
+      m_rects.cbegin(),
+      m_rects.cend(),
+      [&rect](const Bounds<int>& dirty) {
+        return dirty.intersects(rect, true);
+      }
+    );
+  }
+
+  inline
+  void
+  DirtyRegion::insert(Bounds<int> rect) {
+    for (std::size_t id = 0u ; id < m_rects.size() ; ++id) {
+      // Copy the rectangle as the recursive calls below modify the list.
+      const Bounds<int> dirty = m_rects[id];
+
+      if (dirty.contains(rect)) {
+        return;
+      }
+
+      // Touching rectangles can be coalesced when their union does not cover
+      // any pixel which is not already dirty: the union is then inserted in
+      // place of both as it might be mergeable with other rectangles.
+      const bool contained = rect.contains(dirty);
+      const bool free = (
+        dirty.intersects(rect) &&
+        details::pixels(details::enclosing(dirty, rect)) == details::pixels(dirty) + details::pixels(rect) - details::overlap(dirty, rect)
+      );
+
+      if (contained || free) {
+        const Bounds<int> merged = details::enclosing(dirty, rect);
+        m_rects[id] = m_rects.back();
+        m_rects.pop_back();
+
+        insert(merged);
+        return;
+      }
+
+      if (!dirty.intersects(rect, true)) {
+        continue;
+      }
+
+      // The rectangles overlap: only keep the parts of the new rectangle
+      // which are not yet dirty, which is at most four rectangles around
+      // the dirty one.
+      const int left = std::max(rect.getLeftBound(), dirty.getLeftBound());
+      const int right = std::min(rect.getRightBound(), dirty.getRightBound());
+
+      if (rect.getLeftBound() < dirty.getLeftBound()) {
+        insert(Bounds<int>(rect.getLeftBound(), rect.getBottomBound(), dirty.getLeftBound(), rect.getTopBound()));
+      }
+      if (dirty.getRightBound() < rect.getRightBound()) {
+        insert(Bounds<int>(dirty.getRightBound(), rect.getBottomBound(), rect.getRightBound(), rect.getTopBound()));
+      }
+      if (rect.getBottomBound() < dirty.getBottomBound()) {
+        insert(Bounds<int>(left, rect.getBottomBound(), right, dirty.getBottomBound()));
+      }
+      if (dirty.getTopBound() < rect.getTopBound()) {
+        insert(Bounds<int>(left, dirty.getTopBound(), right, rect.getTopBound()));
+      }
+
+      return;
+    }
+
+    m_rects.push_back(rect);
+  }
+
+  inline
+  void
+  DirtyRegion::enforceLimit() {
+    while (m_rects.size() > m_maxRects) {
+      // Find the pair of rectangles which adds the least pixels to repaint
+      // when replaced by its enclosing rectangle.
+      std::size_t bestI = 0u;
+      std::size_t bestJ = 1u;
+      std::int64_t bestCost = std::numeric_limits<std::int64_t>::max();
+
+      for (std::size_t i = 0u ; i < m_rects.size() ; ++i) {
+        for (std::size_t j = i + 1u ; j < m_rects.size() ; ++j) {
+          const std::int64_t cost =
+            details::pixels(details::enclosing(m_rects[i], m_rects[j])) -
+            details::pixels(m_rects[i]) -
+            details::pixels(m_rects[j])
+          ;
+
+          if (cost < bestCost) {
+            bestCost = cost;
+            bestI = i;
+            bestJ = j;
+          }
+        }
+      }
+
+      Bounds<int> merged = details::enclosing(m_rects[bestI], m_rects[bestJ]);
+      m_rects.erase(m_rects.begin() + static_cast<std::ptrdiff_t>(bestJ));
+      m_rects.erase(m_rects.begin() + static_cast<std::ptrdiff_t>(bestI));
+
+      // The enclosing rectangle might overlap other ones: absorb them so
+      // that rectangles never overlap, which can only reduce their count.
+      bool absorbed = true;
+      while (absorbed) {
+        absorbed = false;
+
+        for (std::size_t id = 0u ; id < m_rects.size() ; ++id) {
+          if (m_rects[id].intersects(merged, true)) {
+            merged = details::enclosing(merged, m_rects[id]);
+            m_rects[id] = m_rects.back();
+            m_rects.pop_back();
+            absorbed = true;
+            break;
+          }
+        }
+      }
+
+      m_rects.push_back(merged);
+    }
+  }
+
+}
+
+#endif    /* DIRTY_REGION_HXX */
@@ -0,0 +1,224 @@
+#ifndef    FIXED_HH
+# define   FIXED_HH
+
+# include <limits>
+# include <cstdint>
+# include "ComparisonUtils.hh"
+
+namespace utils {
+
+  /**
+   * @brief - A signed fixed point number with `IntBits` bits for the integer
+   *          part (including the sign) and `FracBits` bits for the fractional
+   *          part, stored in a 32 bits integer. All operations are performed
+   *          with integer arithmetic so that results are the same whatever
+   *          the compiler, flags or platform, which is not the case with
+   *          floating point values.
+   *          This type can be used as the coordinate type of primitives such
+   *          as `Vector2`, `Box` or `Size`. Conversions from and to other
+   *          arithmetic types are explicit so that no floating point value
+   *          is silently introduced in a computation.
+   *          Just like for integers, overflowing the 32 bits of storage wraps
+   *          around and dividing by `0` is undefined.
+   */
+  template <int IntBits, int FracBits>
+  class Fixed {
+    public:
+
+      static_assert(IntBits > 0 && FracBits >= 0, "Fixed requires a positive number of bits");
+      static_assert(IntBits + FracBits <= 32, "Fixed values are stored on at most 32 bits");
+      static_assert(FracBits < 31, "Fixed values should be able to represent 1");
+
+      using RawType = std::int32_t;
+
+      static constexpr int kIntBits = IntBits;
+      static constexpr int kFracBits = FracBits;
+
+      /**
+       * @brief - The raw value representing `1`.
+       */
+      static constexpr RawType kOne = static_cast<RawType>(std::int64_t(1) << FracBits);
+
+      /**
+       * @brief - Just like for integers the value is only set to `0` when
+       *          value-initialized (e.g. `Fixed()`): this keeps the type
+       *          trivial.
+       */
+      Fixed() noexcept = default;
+
+      explicit constexpr
+      Fixed(int value) noexcept;
+
+      /**
+       * @brief - Converts a floating point value to the closest fixed point
+       *          value. Values out of the range of this type are undefined.
+       */
+      explicit constexpr
+      Fixed(float value) noexcept;
+
+      explicit constexpr
+      Fixed(double value) noexcept;
+
+      /**
+       * @brief - Creates a fixed point value from its internal representation,
+       *          i.e. `raw / 2^FracBits`.
+       */
+      static
+      constexpr Fixed
+      fromRaw(RawType raw) noexcept;
+
+      constexpr RawType
+      raw() const noexcept;
+
+      /**
+       * @brief - Converts to an integer by truncating the fractional part,
+       *          just like converting a floating point value would.
+       */
+      explicit constexpr
+      operator int() const noexcept;
+
+      explicit constexpr
+      operator float() const noexcept;
+
+      explicit constexpr
+      operator double() const noexcept;
+
+      constexpr Fixed
+      operator-() const noexcept;
+
+      constexpr Fixed
+      operator+(const Fixed& rhs) const noexcept;
+
+      constexpr Fixed&
+      operator+=(const Fixed& rhs) noexcept;
+
+      constexpr Fixed
+      operator-(const Fixed& rhs) const noexcept;
+
+      constexpr Fixed&
+      operator-=(const Fixed& rhs) noexcept;
+
+      /**
+       * @brief - Multiplies on 64 bits and rounds the result to the closest
+       *          fixed point value (halfway cases are rounded up).
+       */
+      constexpr Fixed
+      operator*(const Fixed& rhs) const noexcept;
+
+      constexpr Fixed&
+      operator*=(const Fixed& rhs) noexcept;
+
+      /**
+       * @brief - Divides on 64 bits, truncating the result towards `0`.
+       */
+      constexpr Fixed
+      operator/(const Fixed& rhs) const noexcept;
+
+      constexpr Fixed&
+      operator/=(const Fixed& rhs) noexcept;
+
+      constexpr bool
+      operator==(const Fixed& rhs) const noexcept;
+
+      constexpr bool
+      operator!=(const Fixed& rhs) const noexcept;
+
+      constexpr bool
+      operator<(const Fixed& rhs) const noexcept;
+
+      constexpr bool
+      operator<=(const Fixed& rhs) const noexcept;
+
+      constexpr bool
+      operator>(const Fixed& rhs) const noexcept;
+
+      constexpr bool
+      operator>=(const Fixed& rhs) const noexcept;
+
+    private:
+
+      struct RawTag {};
+
+      constexpr
+      Fixed(RawType raw, RawTag) noexcept;
+
+      RawType m_raw;
+  };
+
+  /**
+   * @brief - Computes the square root of `value` rounded down to the closest
+   *          fixed point value, `0` for negative values. The result is exact
+   *          and does not depend on the platform. Found through argument
+   *          dependent lookup so that generic code can call `sqrt` on any
+   *          coordinate type after `using std::sqrt`.
+   */
+  template <int IntBits, int FracBits>
+  Fixed<IntBits, FracBits>
+  sqrt(const Fixed<IntBits, FracBits>& value) noexcept;
+
+  template <int IntBits, int FracBits>
+  constexpr Fixed<IntBits, FracBits>
+  abs(const Fixed<IntBits, FracBits>& value) noexcept;
+
+  /**
+   * @brief - Fixed point values are exact so primitives using them are
+   *          compared exactly.
+   */
+  template <int IntBits, int FracBits>
+  struct DefaultComparison<Fixed<IntBits, FracBits>> {
+    using Type = ExactComparison;
+  };
+
+  using Fixed16 = Fixed<16, 16>;
+
+}
+
+namespace std {
+
+  template <int IntBits, int FracBits>
+  struct numeric_limits<utils::Fixed<IntBits, FracBits>> {
+    using Type = utils::Fixed<IntBits, FracBits>;
+
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = true;
+    static constexpr bool has_infinity = false;
+    static constexpr bool has_quiet_NaN = false;
+    static constexpr bool has_signaling_NaN = false;
+    static constexpr bool is_iec559 = false;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = false;
+    static constexpr int digits = IntBits + FracBits - 1;
+    static constexpr int radix = 2;
+
+    /**
+     * @brief - Just like for floating point types this is the smallest
+     *          positive value, which makes `fuzzyEqual` exact by default.
+     */
+    static constexpr Type
+    min() noexcept {
+      return Type::fromRaw(1);
+    }
+
+    static constexpr Type
+    max() noexcept {
+      return Type::fromRaw(static_cast<typename Type::RawType>((std::int64_t(1) << digits) - 1));
+    }
+
+    static constexpr Type
+    lowest() noexcept {
+      return Type::fromRaw(static_cast<typename Type::RawType>(-(std::int64_t(1) << digits)));
+    }
+
+    static constexpr Type
+    epsilon() noexcept {
+      return Type::fromRaw(1);
+    }
+  };
+
+}
+
+# include "Fixed.hxx"
+
+#endif    /* FIXED_HH */
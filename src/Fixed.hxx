@@ -0,0 +1,262 @@
+#ifndef    FIXED_HXX
+# define   FIXED_HXX
+
+# include <cmath>
+# include "Fixed.hh"
+
+namespace utils {
+  namespace details {
+
+    /**
+     * @brief - Converts a 64 bits intermediate result to the 32 bits storage
+     *          of fixed point values. Out of range values wrap around which
+     *          is well defined for unsigned integers, unlike signed overflows.
+     */
+    inline
+    constexpr std::int32_t
+    wrapFixed(std::int64_t value) noexcept {
+      return static_cast<std::int32_t>(static_cast<std::uint32_t>(static_cast<std::uint64_t>(value)));
+    }
+
+    /**
+     * @brief - Computes the integer square root of `value`, rounded down.
+     *          The floating point estimate is only used as a starting point:
+     *          the corrections make the result exact. Values are expected to
+     *          be smaller than `2^62` so that squares do not overflow.
+     */
+    inline
+    std::uint64_t
+    isqrt(std::uint64_t value) noexcept {
+      std::uint64_t root = static_cast<std::uint64_t>(std::sqrt(static_cast<double>(value)));
+
+      while (root * root > value) {
+        --root;
+      }
+      while ((root + 1u) * (root + 1u) <= value) {
+        ++root;
+      }
+
+      return root;
+    }
+
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr
+  Fixed<IntBits, FracBits>::Fixed(RawType raw, RawTag) noexcept:
+    m_raw(raw)
+  {}
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr
+  Fixed<IntBits, FracBits>::Fixed(int value) noexcept:
+    m_raw(details::wrapFixed(std::int64_t(value) * kOne))
+  {}
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr
+  Fixed<IntBits, FracBits>::Fixed(float value) noexcept:
+    Fixed(static_cast<double>(value))
+  {}
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr
+  Fixed<IntBits, FracBits>::Fixed(double value) noexcept:
+    // Rounds to the closest value, halfway cases away from `0`.
+    m_raw(static_cast<RawType>(value * kOne + (value < 0.0 ? -0.5 : 0.5)))
+  {}
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr Fixed<IntBits, FracBits>
+  Fixed<IntBits, FracBits>::fromRaw(RawType raw) noexcept {
+    return Fixed(raw, RawTag());
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr typename Fixed<IntBits, FracBits>::RawType
+  Fixed<IntBits, FracBits>::raw() const noexcept {
+    return m_raw;
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr
+  Fixed<IntBits, FracBits>::operator int() const noexcept {
+    return static_cast<int>(m_raw / kOne);
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr
+  Fixed<IntBits, FracBits>::operator float() const noexcept {
+    return static_cast<float>(static_cast<double>(*this));
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr
+  Fixed<IntBits, FracBits>::operator double() const noexcept {
+    return static_cast<double>(m_raw) / kOne;
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr Fixed<IntBits, FracBits>
+  Fixed<IntBits, FracBits>::operator-() const noexcept {
+    return fromRaw(details::wrapFixed(-std::int64_t(m_raw)));
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr Fixed<IntBits, FracBits>
+  Fixed<IntBits, FracBits>::operator+(const Fixed& rhs) const noexcept {
+    return fromRaw(details::wrapFixed(std::int64_t(m_raw) + rhs.m_raw));
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr Fixed<IntBits, FracBits>&
+  Fixed<IntBits, FracBits>::operator+=(const Fixed& rhs) noexcept {
+    *this = *this + rhs;
+    return *this;
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr Fixed<IntBits, FracBits>
+  Fixed<IntBits, FracBits>::operator-(const Fixed& rhs) const noexcept {
+    return fromRaw(details::wrapFixed(std::int64_t(m_raw) - rhs.m_raw));
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr Fixed<IntBits, FracBits>&
+  Fixed<IntBits, FracBits>::operator-=(const Fixed& rhs) noexcept {
+    *this = *this - rhs;
+    return *this;
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr Fixed<IntBits, FracBits>
+  Fixed<IntBits, FracBits>::operator*(const Fixed& rhs) const noexcept {
+    const std::int64_t product = std::int64_t(m_raw) * rhs.m_raw;
+
+    if constexpr (FracBits == 0) {
+      return fromRaw(details::wrapFixed(product));
+    }
+    else {
+      // The shift rounds towards negative infinity: adding half of the
+      // unit first rounds to the closest value.
+      return fromRaw(details::wrapFixed((product + (std::int64_t(1) << (FracBits - 1))) >> FracBits));
+    }
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr Fixed<IntBits, FracBits>&
+  Fixed<IntBits, FracBits>::operator*=(const Fixed& rhs) noexcept {
+    *this = *this * rhs;
+    return *this;
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr Fixed<IntBits, FracBits>
+  Fixed<IntBits, FracBits>::operator/(const Fixed& rhs) const noexcept {
+    const std::int64_t dividend = std::int64_t(m_raw) * kOne;
+
+    if constexpr (FracBits + 32 <= 53) {
+      // The dividend is exactly represented by a double and is smaller
+      // than `2^53`: the correctly rounded quotient is then never rounded
+      // across an integer and truncating it gives the same result as an
+      // integer division, which is much slower on most processors.
+      const double quotient = static_cast<double>(dividend) / static_cast<double>(rhs.m_raw);
+      return fromRaw(details::wrapFixed(static_cast<std::int64_t>(quotient)));
+    }
+    else {
+      return fromRaw(details::wrapFixed(dividend / rhs.m_raw));
+    }
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr Fixed<IntBits, FracBits>&
+  Fixed<IntBits, FracBits>::operator/=(const Fixed& rhs) noexcept {
+    *this = *this / rhs;
+    return *this;
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr bool
+  Fixed<IntBits, FracBits>::operator==(const Fixed& rhs) const noexcept {
+    return m_raw == rhs.m_raw;
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr bool
+  Fixed<IntBits, FracBits>::operator!=(const Fixed& rhs) const noexcept {
+    return m_raw != rhs.m_raw;
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr bool
+  Fixed<IntBits, FracBits>::operator<(const Fixed& rhs) const noexcept {
+    return m_raw < rhs.m_raw;
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr bool
+  Fixed<IntBits, FracBits>::operator<=(const Fixed& rhs) const noexcept {
+    return m_raw <= rhs.m_raw;
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr bool
+  Fixed<IntBits, FracBits>::operator>(const Fixed& rhs) const noexcept {
+    return m_raw > rhs.m_raw;
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr bool
+  Fixed<IntBits, FracBits>::operator>=(const Fixed& rhs) const noexcept {
+    return m_raw >= rhs.m_raw;
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  Fixed<IntBits, FracBits>
+  sqrt(const Fixed<IntBits, FracBits>& value) noexcept {
+    using Type = Fixed<IntBits, FracBits>;
+
+    if (value.raw() <= 0) {
+      return Type();
+    }
+
+    // `sqrt(raw / 2^F) * 2^F = sqrt(raw * 2^F)`.
+    const std::uint64_t scaled = static_cast<std::uint64_t>(value.raw()) << FracBits;
+    return Type::fromRaw(static_cast<typename Type::RawType>(details::isqrt(scaled)));
+  }
+
+  template <int IntBits, int FracBits>
+  inline
+  constexpr Fixed<IntBits, FracBits>
+  abs(const Fixed<IntBits, FracBits>& value) noexcept {
+    return (value.raw() < 0 ? -value : value);
+  }
+
+}
+
+#endif    /* FIXED_HXX */
@@ -0,0 +1,87 @@
+#ifndef    FORMAT_UTILS_HH
+# define   FORMAT_UTILS_HH
+
+# include <cstddef>
+# include <cstdint>
+
+namespace utils {
+
+  /**
+   * @brief - A buffer size large enough to hold the text produced by the
+   *          `format` method of any of the `float` or `int` primitives.
+   */
+  constexpr std::size_t kFormatBufferSize = 256u;
+
+  /**
+   * @brief - A buffer size large enough to hold the text produced by the
+   *          `format` method of a primitive with `count` values of type
+   *          `ValueType`, whatever their magnitude: fixed notation needs
+   *          more than 300 digits for large `double` values.
+   * @param count - the number of values of the primitive.
+   * @return - the size of the buffer.
+   */
+  template <typename ValueType>
+  constexpr std::size_t
+  formatBufferSize(std::size_t count) noexcept;
+
+  /**
+   * @brief - Appends text and numbers to a caller provided buffer without
+   *          any allocation. Numbers are written with the same format as
+   *          `std::to_string`. Once something does not fit in the buffer
+   *          the writer stops and reports a size of `0`.
+   */
+  class FormatWriter {
+    public:
+
+      FormatWriter(char* buffer, std::size_t size) noexcept;
+
+      void
+      appendText(const char* text) noexcept;
+
+      template <typename ValueType>
+      void
+      appendValue(ValueType value) noexcept;
+
+      /**
+       * @brief - Returns the number of characters written so far or `0` in
+       *          case the buffer was too small. No terminating `\0` is ever
+       *          written.
+       */
+      std::size_t
+      size() const noexcept;
+
+      bool
+      overflowed() const noexcept;
+
+    private:
+
+      char* m_begin;
+      char* m_cursor;
+      char* m_end;
+      bool m_overflowed;
+  };
+
+  /**
+   * @brief - Writes the bytes of `value` in `dst` in little endian order
+   *          whatever the endianness of the host.
+   * @param dst - the destination, must have room for `sizeof(value)` bytes.
+   * @param value - the value to encode.
+   */
+  template <typename ValueType>
+  void
+  encodeLittleEndian(std::uint8_t* dst, ValueType value) noexcept;
+
+  /**
+   * @brief - The reverse operation of `encodeLittleEndian`.
+   * @param src - the bytes to decode.
+   * @return - the decoded value.
+   */
+  template <typename ValueType>
+  ValueType
+  decodeLittleEndian(const std::uint8_t* src) noexcept;
+
+}
+
+# include "FormatUtils.hxx"
+
+#endif    /* FORMAT_UTILS_HH */
@@ -0,0 +1,175 @@
+#ifndef    FORMAT_UTILS_HXX
+# define   FORMAT_UTILS_HXX
+
+# include <limits>
+# include <cstring>
+# include <charconv>
+# include <type_traits>
+# include "FormatUtils.hh"
+
+namespace utils {
+  namespace details {
+
+    template <std::size_t Size>
+    struct UnsignedOfSize;
+
+    template <>
+    struct UnsignedOfSize<1u> {
+      using Type = std::uint8_t;
+    };
+
+    template <>
+    struct UnsignedOfSize<2u> {
+      using Type = std::uint16_t;
+    };
+
+    template <>
+    struct UnsignedOfSize<4u> {
+      using Type = std::uint32_t;
+    };
+
+    template <>
+    struct UnsignedOfSize<8u> {
+      using Type = std::uint64_t;
+    };
+
+    /**
+     * @brief - The maximum number of characters written by `appendValue`
+     *          for a single value.
+     */
+    template <typename ValueType>
+    constexpr
+    std::size_t
+    formatValueSize() noexcept {
+      if constexpr (!std::is_arithmetic<ValueType>::value) {
+        return formatValueSize<double>();
+      }
+      else if constexpr (std::is_floating_point<ValueType>::value) {
+        // Sign, integral digits, decimal point and 6 decimals.
+        return static_cast<std::size_t>(std::numeric_limits<ValueType>::max_exponent10) + 9u;
+      }
+      else {
+        // Sign and digits.
+        return static_cast<std::size_t>(std::numeric_limits<ValueType>::digits10) + 2u;
+      }
+    }
+
+    /**
+     * @brief - Room for the text surrounding the values in `format`.
+     */
+    constexpr std::size_t kFormatTextSize = 64u;
+
+  }
+
+  template <typename ValueType>
+  constexpr
+  std::size_t
+  formatBufferSize(std::size_t count) noexcept {
+    return details::kFormatTextSize + count * details::formatValueSize<ValueType>();
+  }
+
+  inline
+  FormatWriter::FormatWriter(char* buffer, std::size_t size) noexcept:
+    m_begin(buffer),
+    m_cursor(buffer),
+    m_end(buffer + size),
+    m_overflowed(false)
+  {}
+
+  inline
+  void
+  FormatWriter::appendText(const char* text) noexcept {
+    const std::size_t length = std::strlen(text);
+    if (m_overflowed || static_cast<std::size_t>(m_end - m_cursor) < length) {
+      m_overflowed = true;
+      return;
+    }
+
+    std::memcpy(m_cursor, text, length);
+    m_cursor += length;
+  }
+
+  template <typename ValueType>
+  inline
+  void
+  FormatWriter::appendValue(ValueType value) noexcept {
+    static_assert(
+      std::is_arithmetic<ValueType>::value || std::is_constructible<double, ValueType>::value,
+      "Only arithmetic values or values convertible to double can be formatted"
+    );
+
+    if (m_overflowed) {
+      return;
+    }
+
+    // `std::to_string` uses `%f` for floating point values, i.e. fixed
+    // notation with 6 decimals. Other types, such as fixed point values,
+    // are formatted as doubles.
+    std::to_chars_result res;
+    if constexpr (!std::is_arithmetic<ValueType>::value) {
+      res = std::to_chars(m_cursor, m_end, static_cast<double>(value), std::chars_format::fixed, 6);
+    }
+    else if constexpr (std::is_floating_point<ValueType>::value) {
+      res = std::to_chars(m_cursor, m_end, value, std::chars_format::fixed, 6);
+    }
+    else {
+      res = std::to_chars(m_cursor, m_end, value);
+    }
+
+    if (res.ec != std::errc()) {
+      m_overflowed = true;
+      return;
+    }
+
+    m_cursor = res.ptr;
+  }
+
+  inline
+  std::size_t
+  FormatWriter::size() const noexcept {
+    return (m_overflowed ? 0u : static_cast<std::size_t>(m_cursor - m_begin));
+  }
+
+  inline
+  bool
+  FormatWriter::overflowed() const noexcept {
+    return m_overflowed;
+  }
+
+  template <typename ValueType>
+  inline
+  void
+  encodeLittleEndian(std::uint8_t* dst, ValueType value) noexcept {
+    using Bits = typename details::UnsignedOfSize<sizeof(ValueType)>::Type;
+    static_assert(std::is_trivially_copyable<ValueType>::value, "Only trivially copyable values can be encoded");
+
+    Bits bits;
+    std::memcpy(&bits, &value, sizeof(ValueType));
+
+    for (std::size_t id = 0u ; id < sizeof(ValueType) ; ++id) {
+      dst[id] = static_cast<std::uint8_t>(bits >> (8u * id));
+    }
+  }
+
+  template <typename ValueType>
+  inline
+  ValueType
+  decodeLittleEndian(const std::uint8_t* src) noexcept {
+    using Bits = typename details::UnsignedOfSize<sizeof(ValueType)>::Type;
+    static_assert(std::is_trivially_copyable<ValueType>::value, "Only trivially copyable values can be decoded");
+
+    Bits bits = 0u;
+    for (std::size_t id = 0u ; id < sizeof(ValueType) ; ++id) {
+      bits |= static_cast<Bits>(static_cast<Bits>(src[id]) << (8u * id));
+    }
+
+    // The cast is needed for trivially copyable classes with private
+    // members such as `Fixed`.
+    ValueType value;
+    std::memcpy(static_cast<void*>(&value), &bits, sizeof(ValueType));
+    return value;
+  }
+
+}
+
+#endif    /* FORMAT_UTILS_HXX */
@@ -0,0 +1,128 @@
+#ifndef    FUZZY_HASH_HH
+# define   FUZZY_HASH_HH
+
+# include <limits>
+# include <cstddef>
+# include "Box.hh"
+# include "Vector2.hh"
+# include "Vector3.hh"
+
+namespace utils {
+
+  /**
+   * @brief - Hashes primitives consistently with `fuzzyEqual`: coordinates
+   *          are snapped to a grid whose cells are twice as large as the
+   *          tolerance and the hash is the one of the cell. Two values equal
+   *          within the tolerance are then either in the same cell or in
+   *          neighbouring ones, which is why the hash alone is not enough to
+   *          find all the equal values: lookups should probe all the cells
+   *          returned by `probe`.
+   *          Boxes are hashed on their center only (but compared on all
+   *          their coordinates) to keep the number of probes low.
+   *          A coordinate whose closest values are further away than the
+   *          tolerance can only be equal to itself: it is hashed as is and a
+   *          single cell is probed along its axis. With the default tolerance
+   *          this is the case of all the coordinates except the ones close to
+   *          zero (below `2^-100` or so).
+   */
+  template <typename CoordinateType>
+  class FuzzyHash {
+    public:
+
+      /**
+       * @brief - The maximum number of cells returned by `probe`. Usually
+       *          only two cells per axis are probed: three are needed for
+       *          coordinates close to the middle of a cell.
+       */
+      static constexpr std::size_t kMaxProbes = 27u;
+
+      /**
+       * @brief - Creates a hasher for the specified tolerance. The default
+       *          one is the tolerance used by the `operator==` of primitives.
+       * @param epsilon - the tolerance under which coordinates are equal.
+       */
+      explicit
+      FuzzyHash(CoordinateType epsilon = std::numeric_limits<CoordinateType>::min()) noexcept;
+
+      const CoordinateType&
+      getEpsilon() const noexcept;
+
+      std::size_t
+      operator()(const Vector2<CoordinateType>& vec) const noexcept;
+
+      std::size_t
+      operator()(const Vector3<CoordinateType>& vec) const noexcept;
+
+      std::size_t
+      operator()(const Box<CoordinateType>& box) const noexcept;
+
+      /**
+       * @brief - Computes the hashes of all the cells which can hold a value
+       *          equal to the input one within the tolerance. The first hash
+       *          is always the one of the value itself.
+       * @param vec - the value for which cells should be probed.
+       * @param hashes - output array with room for at least `kMaxProbes`
+       *                 values receiving the hashes.
+       * @return - the number of hashes written to `hashes`.
+       */
+      std::size_t
+      probe(const Vector2<CoordinateType>& vec, std::size_t* hashes) const noexcept;
+
+      std::size_t
+      probe(const Vector3<CoordinateType>& vec, std::size_t* hashes) const noexcept;
+
+      std::size_t
+      probe(const Box<CoordinateType>& box, std::size_t* hashes) const noexcept;
+
+      /**
+       * @brief - Compares both values with the tolerance of this hasher.
+       */
+      bool
+      equal(const Vector2<CoordinateType>& lhs, const Vector2<CoordinateType>& rhs) const noexcept;
+
+      bool
+      equal(const Vector3<CoordinateType>& lhs, const Vector3<CoordinateType>& rhs) const noexcept;
+
+      bool
+      equal(const Box<CoordinateType>& lhs, const Box<CoordinateType>& rhs) const noexcept;
+
+    private:
+
+      CoordinateType m_epsilon;
+  };
+
+  /**
+   * @brief - Removes from the input array the values equal within `epsilon`
+   *          to a value appearing before them. The order of the values kept
+   *          is preserved and they are moved to the front of the array, just
+   *          like `std::unique` does. Runs in `O(n)` expected time.
+   *          Note that the fuzzy equality is not transitive so the result
+   *          depends on the order of the input values.
+   * @param values - the values to deduplicate.
+   * @param count - the number of values.
+   * @param epsilon - the tolerance under which coordinates are equal.
+   * @return - the number of values kept.
+   */
+  template <typename CoordinateType>
+  std::size_t
+  dedupe(Vector2<CoordinateType>* values,
+         std::size_t count,
+         CoordinateType epsilon = std::numeric_limits<CoordinateType>::min());
+
+  template <typename CoordinateType>
+  std::size_t
+  dedupe(Vector3<CoordinateType>* values,
+         std::size_t count,
+         CoordinateType epsilon = std::numeric_limits<CoordinateType>::min());
+
+  template <typename CoordinateType>
+  std::size_t
+  dedupe(Box<CoordinateType>* values,
+         std::size_t count,
+         CoordinateType epsilon = std::numeric_limits<CoordinateType>::min());
+
+}
+
+# include "FuzzyHash.hxx"
+
+#endif    /* FUZZY_HASH_HH */
@@ -0,0 +1,378 @@
+#ifndef    FUZZY_HASH_HXX
+# define   FUZZY_HASH_HXX
+
+# include <cmath>
+# include <vector>
+# include <cstdint>
+# include <cstring>
+# include <algorithm>
+# include <type_traits>
+# include "FuzzyHash.hh"
+# include "ComparisonUtils.hh"
+
+namespace utils {
+  namespace details {
+
+    inline
+    std::uint64_t
+    mixHash(std::uint64_t value) noexcept {
+      // Finalizer of `splitmix64`: spreads the bits of the input so that
+      // neighbouring cells end up in unrelated buckets.
+      value ^= value >> 30u;
+      value *= 0xbf58476d1ce4e5b9ull;
+      value ^= value >> 27u;
+      value *= 0x94d049bb133111ebull;
+      value ^= value >> 31u;
+
+      return value;
+    }
+
+    inline
+    std::size_t
+    combineHash(std::size_t seed, std::uint64_t value) noexcept {
+      return static_cast<std::size_t>(mixHash(seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6u) + (seed >> 2u))));
+    }
+
+    /**
+     * @brief - The cells of the grid along a single axis which can hold a
+     *          value equal to the input one: the first one is the cell of
+     *          the value itself.
+     */
+    struct AxisCells {
+      std::uint64_t cells[3];
+      std::size_t count;
+    };
+
+    inline
+    std::uint64_t
+    cellBits(double cell) noexcept {
+      // Adding `0` turns `-0` into `0` so that both hash to the same cell.
+      const double normalized = cell + 0.0;
+
+      std::uint64_t bits;
+      std::memcpy(&bits, &normalized, sizeof(bits));
+
+      return bits;
+    }
+
+    /**
+     * @brief - The smallest distance between `value` and another value of
+     *          the same type, `0` when it is not known.
+     */
+    template <typename T>
+    inline
+    double
+    valueSpacing(T value) noexcept {
+      if constexpr (std::is_integral<T>::value) {
+        return 1.0;
+      }
+      else if constexpr (std::is_floating_point<T>::value) {
+        // The closest value towards zero is the closest one at powers of 2.
+        return static_cast<double>(std::fabs(value - std::nextafter(value, T(0))));
+      }
+      else {
+        return 0.0;
+      }
+    }
+
+    template <typename T>
+    inline
+    AxisCells
+    axisCells(T value, T epsilon) noexcept {
+      AxisCells out{{0u, 0u, 0u}, 1u};
+
+      // No value is equal to another one without a positive tolerance, or
+      // when the tolerance is smaller than the gap to the closest values
+      // (which is the case for the default tolerance and coordinates away
+      // from zero): the value itself is hashed.
+      const double tolerance = static_cast<double>(epsilon);
+      const double scaled = static_cast<double>(value) / (2.0 * tolerance);
+
+      if (!(tolerance > 0.0) || !(valueSpacing(value) < tolerance) || !std::isfinite(scaled)) {
+        out.cells[0u] = cellBits(static_cast<double>(value));
+        return out;
+      }
+
+      // Cells are twice as large as the tolerance: values equal to `value`
+      // lie within half a cell of it so only the closest neighbour needs to
+      // be probed. Both are probed when the value is close to the middle of
+      // its cell to account for rounding errors.
+      const double cell = std::floor(scaled);
+      const double frac = scaled - cell;
+      const double margin = 1e-9 * std::max(1.0, std::fabs(scaled));
+
+      out.cells[0u] = cellBits(cell);
+      if (frac < 0.5 + margin) {
+        out.cells[out.count++] = cellBits(cell - 1.0);
+      }
+      if (frac > 0.5 - margin) {
+        out.cells[out.count++] = cellBits(cell + 1.0);
+      }
+
+      return out;
+    }
+
+    inline
+    std::size_t
+    probeCells(const AxisCells* axes,
+               std::size_t dims,
+               std::size_t* hashes) noexcept
+    {
+      // Enumerate all the combinations of cells along each axis, the first
+      // combination being the cell of the value itself.
+      std::size_t indices[3] = {0u, 0u, 0u};
+      std::size_t written = 0u;
+
+      while (true) {
+        std::size_t hash = 0u;
+        for (std::size_t axis = 0u ; axis < dims ; ++axis) {
+          hash = combineHash(hash, axes[axis].cells[indices[axis]]);
+        }
+        hashes[written++] = hash;
+
+        std::size_t axis = 0u;
+        while (axis < dims && ++indices[axis] == axes[axis].count) {
+          indices[axis] = 0u;
+          ++axis;
+        }
+        if (axis == dims) {
+          return written;
+        }
+      }
+    }
+
+    /**
+     * @brief - A minimal open addressing hash table used to deduplicate
+     *          values: it stores indices of values along with their hash.
+     */
+    class IndexTable {
+      public:
+
+        explicit
+        IndexTable(std::size_t count):
+          m_mask(0u),
+          m_slots()
+        {
+          std::size_t capacity = 16u;
+          while (capacity < 2u * count) {
+            capacity *= 2u;
+          }
+
+          m_mask = capacity - 1u;
+          m_slots.resize(capacity, Slot{0u, kEmpty});
+        }
+
+        void
+        insert(std::size_t hash, std::size_t index) noexcept {
+          std::size_t pos = hash & m_mask;
+          while (m_slots[pos].index != kEmpty) {
+            pos = (pos + 1u) & m_mask;
+          }
+
+          m_slots[pos] = Slot{hash, index};
+        }
+
+        /**
+         * @brief - Calls `pred` with the index of each value registered with
+         *          `hash` until it returns `true`.
+         * @return - `true` if `pred` returned `true` for one of the values.
+         */
+        template <typename Predicate>
+        bool
+        any(std::size_t hash, Predicate&& pred) const noexcept {
+          std::size_t pos = hash & m_mask;
+          while (m_slots[pos].index != kEmpty) {
+            if (m_slots[pos].hash == hash && pred(m_slots[pos].index)) {
+              return true;
+            }
+            pos = (pos + 1u) & m_mask;
+          }
+
+          return false;
+        }
+
+      private:
+
+        static constexpr std::size_t kEmpty = static_cast<std::size_t>(-1);
+
+        struct Slot {
+          std::size_t hash;
+          std::size_t index;
+        };
+
+        std::size_t m_mask;
+        std::vector<Slot> m_slots;
+    };
+
+    template <typename Primitive, typename T>
+    inline
+    std::size_t
+    dedupe(Primitive* values,
+           std::size_t count,
+           const FuzzyHash<T>& hasher)
+    {
+      IndexTable table(count);
+      std::size_t hashes[FuzzyHash<T>::kMaxProbes];
+      std::size_t kept = 0u;
+
+      for (std::size_t id = 0u ; id < count ; ++id) {
+        const Primitive& value = values[id];
+        const std::size_t probes = hasher.probe(value, hashes);
+
+        bool duplicate = false;
+        for (std::size_t probe = 0u ; probe < probes && !duplicate ; ++probe) {
+          duplicate = table.any(
+            hashes[probe],
+            [&](std::size_t index) {
+              return hasher.equal(values[index], value);
+            }
+          );
+        }
+
+        if (!duplicate) {
+          values[kept] = value;
+          table.insert(hashes[0u], kept);
+          ++kept;
+        }
+      }
+
+      return kept;
+    }
+
+  }
+
+  template <typename CoordinateType>
+  inline
+  FuzzyHash<CoordinateType>::FuzzyHash(CoordinateType epsilon) noexcept:
+    m_epsilon(epsilon)
+  {}
+
+  template <typename CoordinateType>
+  inline
+  const CoordinateType&
+  FuzzyHash<CoordinateType>::getEpsilon() const noexcept {
+    return m_epsilon;
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  FuzzyHash<CoordinateType>::operator()(const Vector2<CoordinateType>& vec) const noexcept {
+    std::size_t hash = details::combineHash(0u, details::axisCells(vec.x(), m_epsilon).cells[0u]);
+    return details::combineHash(hash, details::axisCells(vec.y(), m_epsilon).cells[0u]);
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  FuzzyHash<CoordinateType>::operator()(const Vector3<CoordinateType>& vec) const noexcept {
+    std::size_t hash = details::combineHash(0u, details::axisCells(vec.x(), m_epsilon).cells[0u]);
+    hash = details::combineHash(hash, details::axisCells(vec.y(), m_epsilon).cells[0u]);
+    return details::combineHash(hash, details::axisCells(vec.z(), m_epsilon).cells[0u]);
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  FuzzyHash<CoordinateType>::operator()(const Box<CoordinateType>& box) const noexcept {
+    return operator()(Vector2<CoordinateType>(box.x(), box.y()));
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  FuzzyHash<CoordinateType>::probe(const Vector2<CoordinateType>& vec, std::size_t* hashes) const noexcept {
+    const details::AxisCells axes[2] = {
+      details::axisCells(vec.x(), m_epsilon),
+      details::axisCells(vec.y(), m_epsilon)
+    };
+
+    return details::probeCells(axes, 2u, hashes);
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  FuzzyHash<CoordinateType>::probe(const Vector3<CoordinateType>& vec, std::size_t* hashes) const noexcept {
+    const details::AxisCells axes[3] = {
+      details::axisCells(vec.x(), m_epsilon),
+      details::axisCells(vec.y(), m_epsilon),
+      details::axisCells(vec.z(), m_epsilon)
+    };
+
+    return details::probeCells(axes, 3u, hashes);
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  FuzzyHash<CoordinateType>::probe(const Box<CoordinateType>& box, std::size_t* hashes) const noexcept {
+    return probe(Vector2<CoordinateType>(box.x(), box.y()), hashes);
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  FuzzyHash<CoordinateType>::equal(const Vector2<CoordinateType>& lhs, const Vector2<CoordinateType>& rhs) const noexcept {
+    return
+      fuzzyEqual(lhs.x(), rhs.x(), m_epsilon) &&
+      fuzzyEqual(lhs.y(), rhs.y(), m_epsilon)
+    ;
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  FuzzyHash<CoordinateType>::equal(const Vector3<CoordinateType>& lhs, const Vector3<CoordinateType>& rhs) const noexcept {
+    return
+      fuzzyEqual(lhs.x(), rhs.x(), m_epsilon) &&
+      fuzzyEqual(lhs.y(), rhs.y(), m_epsilon) &&
+      fuzzyEqual(lhs.z(), rhs.z(), m_epsilon)
+    ;
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  FuzzyHash<CoordinateType>::equal(const Box<CoordinateType>& lhs, const Box<CoordinateType>& rhs) const noexcept {
+    return
+      fuzzyEqual(lhs.x(), rhs.x(), m_epsilon) &&
+      fuzzyEqual(lhs.y(), rhs.y(), m_epsilon) &&
+      fuzzyEqual(lhs.w(), rhs.w(), m_epsilon) &&
+      fuzzyEqual(lhs.h(), rhs.h(), m_epsilon)
+    ;
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  dedupe(Vector2<CoordinateType>* values,
+         std::size_t count,
+         CoordinateType epsilon)
+  {
+    return details::dedupe(values, count, FuzzyHash<CoordinateType>(epsilon));
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  dedupe(Vector3<CoordinateType>* values,
+         std::size_t count,
+         CoordinateType epsilon)
+  {
+    return details::dedupe(values, count, FuzzyHash<CoordinateType>(epsilon));
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  dedupe(Box<CoordinateType>* values,
+         std::size_t count,
+         CoordinateType epsilon)
+  {
+    return details::dedupe(values, count, FuzzyHash<CoordinateType>(epsilon));
+  }
+
+}
+
+#endif    /* FUZZY_HASH_HXX */
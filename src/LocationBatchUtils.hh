@@ -0,0 +1,92 @@
+#ifndef    LOCATION_BATCH_UTILS_HH
+# define   LOCATION_BATCH_UTILS_HH
+
+# include <cstddef>
+# include "Point2.hh"
+
+namespace utils {
+
+  /**
+   * @brief - Batch version of `d2`: computes the squared distance between
+   *          each of the `count` input points and `ref` and stores it at
+   *          the same index in `out`. Large inputs are split across several
+   *          threads, see `parallelFor`.
+   * @param points - the points for which the distance should be computed.
+   * @param count - the number of points.
+   * @param ref - the reference point.
+   * @param out - output array with room for at least `count` values.
+   * @param threads - the maximum number of threads to use, `0` to use one
+   *                  per hardware thread and `1` to stay on the calling one.
+   */
+  template <typename T>
+  void
+  d2Batch(const Vector2<T>* points,
+          std::size_t count,
+          const Vector2<T>& ref,
+          float* out,
+          unsigned threads = 0u);
+
+  /**
+   * @brief - Similar to `d2Batch` but computes the distance rather than
+   *          the squared distance.
+   * @param points - the points for which the distance should be computed.
+   * @param count - the number of points.
+   * @param ref - the reference point.
+   * @param out - output array with room for at least `count` values.
+   * @param threads - the maximum number of threads to use.
+   */
+  template <typename T>
+  void
+  dBatch(const Vector2<T>* points,
+         std::size_t count,
+         const Vector2<T>& ref,
+         float* out,
+         unsigned threads = 0u);
+
+  /**
+   * @brief - Batch version of `toDirection`: converts the `count` segments
+   *          going from `starts[i]` to `targets[i]` into a direction and a
+   *          length. Just like `toDirection` the direction is left as is
+   *          (i.e. not normalized) for segments whose length is not larger
+   *          than `threshold`.
+   * @param starts - the starting positions of the segments.
+   * @param targets - the end positions of the segments.
+   * @param count - the number of segments.
+   * @param dirs - output array receiving the direction of each segment.
+   * @param dists - output array receiving the length of each segment.
+   * @param threshold - the threshold to consider a segment to have `0`
+   *                    length.
+   * @param threads - the maximum number of threads to use.
+   * @return - the number of segments which do not have a `0` length.
+   */
+  std::size_t
+  toDirectionBatch(const Point2f* starts,
+                   const Point2f* targets,
+                   std::size_t count,
+                   Point2f* dirs,
+                   float* dists,
+                   float threshold = 0.0001f,
+                   unsigned threads = 0u);
+
+  /**
+   * @brief - Batch version of `angleFromDirection`. There is no vector
+   *          version of `atan2` so this only saves the per-call overhead
+   *          and splits large inputs across threads.
+   * @param dirs - the directions to convert.
+   * @param count - the number of directions.
+   * @param out - output array receiving the angle of each direction.
+   * @param threshold - a threshold to consider a direction to be `null`.
+   * @param threads - the maximum number of threads to use.
+   */
+  void
+  angleFromDirectionBatch(const Point2f* dirs,
+                          std::size_t count,
+                          float* out,
+                          float threshold = 0.0001f,
+                          unsigned threads = 0u);
+
+}
+
+# include "LocationBatchUtils.hxx"
+
+#endif    /* LOCATION_BATCH_UTILS_HH */
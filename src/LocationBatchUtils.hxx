@@ -0,0 +1,205 @@
+#ifndef    LOCATION_BATCH_UTILS_HXX
+# define   LOCATION_BATCH_UTILS_HXX
+
+# include <cmath>
+# include <atomic>
+# include "LocationBatchUtils.hh"
+# include "LocationUtils.hh"
+# include "ParallelUtils.hh"
+# include "SimdUtils.hh"
+
+namespace utils {
+  namespace details {
+
+    // The vector kernels read and write the points as a flat array of
+    // interleaved coordinates.
+    static_assert(sizeof(Point2f) == 2u * sizeof(float), "Point2f should be made of exactly two floats");
+
+    template <bool Root, typename T>
+    inline
+    void
+    distanceKernel(const Vector2<T>* points,
+                   const Vector2<T>& ref,
+                   float* out,
+                   std::size_t start,
+                   std::size_t count) noexcept
+    {
+      for (std::size_t id = start ; id < count ; ++id) {
+        out[id] = (Root ? d(points[id], ref) : d2(points[id], ref));
+      }
+    }
+
+    inline
+    bool
+    toDirectionKernel(const Point2f* starts,
+                      const Point2f* targets,
+                      Point2f* dirs,
+                      float* dists,
+                      float threshold,
+                      std::size_t id) noexcept
+    {
+      return toDirection(starts[id], targets[id], dirs[id].x(), dirs[id].y(), dists[id], threshold);
+    }
+
+# if defined(MATHS_UTILS_SIMD)
+
+    template <bool Root>
+    inline
+    void
+    distanceKernel(const Point2f* points,
+                   const Point2f& ref,
+                   float* out,
+                   std::size_t start,
+                   std::size_t count) noexcept
+    {
+      const simd::FloatPack rx = simd::broadcast(ref.x());
+      const simd::FloatPack ry = simd::broadcast(ref.y());
+
+      std::size_t id = start;
+      for ( ; id + simd::kFloatWidth <= count ; id += simd::kFloatWidth) {
+        simd::FloatPack px, py;
+        simd::loadInterleaved(reinterpret_cast<const float*>(points + id), px, py);
+
+        const simd::FloatPack dx = simd::sub(px, rx);
+        const simd::FloatPack dy = simd::sub(py, ry);
+        const simd::FloatPack dist2 = simd::add(simd::mul(dx, dx), simd::mul(dy, dy));
+
+        simd::store(out + id, Root ? simd::sqrt(dist2) : dist2);
+      }
+
+      distanceKernel<Root, float>(points, ref, out, id, count);
+    }
+
+# endif
+
+    inline
+    std::size_t
+    toDirectionKernel(const Point2f* starts,
+                      const Point2f* targets,
+                      Point2f* dirs,
+                      float* dists,
+                      float threshold,
+                      std::size_t start,
+                      std::size_t count) noexcept
+    {
+      std::size_t valid = 0u;
+      std::size_t id = start;
+
+# if defined(MATHS_UTILS_SIMD)
+      const simd::FloatPack thr = simd::broadcast(threshold);
+
+      for ( ; id + simd::kFloatWidth <= count ; id += simd::kFloatWidth) {
+        simd::FloatPack sx, sy, tx, ty;
+        simd::loadInterleaved(reinterpret_cast<const float*>(starts + id), sx, sy);
+        simd::loadInterleaved(reinterpret_cast<const float*>(targets + id), tx, ty);
+
+        const simd::FloatPack xD = simd::sub(tx, sx);
+        const simd::FloatPack yD = simd::sub(ty, sy);
+        const simd::FloatPack dist = simd::sqrt(simd::add(simd::mul(xD, xD), simd::mul(yD, yD)));
+        const simd::FloatPack notZeroLength = simd::lessThan(thr, dist);
+
+        simd::storeInterleaved(
+          reinterpret_cast<float*>(dirs + id),
+          simd::select(notZeroLength, simd::div(xD, dist), xD),
+          simd::select(notZeroLength, simd::div(yD, dist), yD)
+        );
+        simd::store(dists + id, dist);
+
+        const int bits = simd::movemask(notZeroLength);
+        for (std::size_t lane = 0u ; lane < simd::kFloatWidth ; ++lane) {
+          valid += static_cast<std::size_t>((bits >> lane) & 1);
+        }
+      }
+# endif
+
+      for ( ; id < count ; ++id) {
+        valid += (toDirectionKernel(starts, targets, dirs, dists, threshold, id) ? 1u : 0u);
+      }
+
+      return valid;
+    }
+
+  }
+
+  template <typename T>
+  inline
+  void
+  d2Batch(const Vector2<T>* points,
+          std::size_t count,
+          const Vector2<T>& ref,
+          float* out,
+          unsigned threads)
+  {
+    parallelFor(
+      count,
+      [&](unsigned /*chunk*/, std::size_t begin, std::size_t end) {
+        details::distanceKernel<false>(points, ref, out, begin, end);
+      },
+      threads
+    );
+  }
+
+  template <typename T>
+  inline
+  void
+  dBatch(const Vector2<T>* points,
+         std::size_t count,
+         const Vector2<T>& ref,
+         float* out,
+         unsigned threads)
+  {
+    parallelFor(
+      count,
+      [&](unsigned /*chunk*/, std::size_t begin, std::size_t end) {
+        details::distanceKernel<true>(points, ref, out, begin, end);
+      },
+      threads
+    );
+  }
+
+  inline
+  std::size_t
+  toDirectionBatch(const Point2f* starts,
+                   const Point2f* targets,
+                   std::size_t count,
+                   Point2f* dirs,
+                   float* dists,
+                   float threshold,
+                   unsigned threads)
+  {
+    std::atomic<std::size_t> valid(0u);
+
+    parallelFor(
+      count,
+      [&](unsigned /*chunk*/, std::size_t begin, std::size_t end) {
+        const std::size_t local = details::toDirectionKernel(starts, targets, dirs, dists, threshold, begin, end);
+        valid.fetch_add(local, std::memory_order_relaxed);
+      },
+      threads
+    );
+
+    return valid.load();
+  }
+
+  inline
+  void
+  angleFromDirectionBatch(const Point2f* dirs,
+                          std::size_t count,
+                          float* out,
+                          float threshold,
+                          unsigned threads)
+  {
+    parallelFor(
+      count,
+      [&](unsigned /*chunk*/, std::size_t begin, std::size_t end) {
+        for (std::size_t id = begin ; id < end ; ++id) {
+          out[id] = angleFromDirection(dirs[id].x(), dirs[id].y(), threshold);
+        }
+      },
+      threads
+    );
+  }
+
+}
+
+#endif    /* LOCATION_BATCH_UTILS_HXX */
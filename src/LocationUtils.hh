@@ -93,6 +93,8 @@ namespace utils {
    *          `xDir, yDir` and angle `theta`. The angle is
    *          assumed to be distributed equally on both
    *          sides of the principal direction.
+   *          When testing many points against the same
+   *          cone prefer building a `Cone` once.
    * @param - the tip of the cone.
    * @param xDir - the abscissa of the principal direction
    *               of the cone.
@@ -3,6 +3,7 @@
 
 # include <cmath>
 # include "LocationUtils.hh"
+# include "Cone.hh"
 
 namespace utils {
 
@@ -29,7 +30,8 @@ namespace utils {
   inline
   float
   d2(const Vector2<T>& p1, const Vector2<T>& p2) noexcept {
-    return d2(p1.x(), p1.y(), p2.x(), p2.y());
+    // Explicit conversions allow coordinate types such as `Fixed`.
+    return d2(static_cast<float>(p1.x()), static_cast<float>(p1.y()), static_cast<float>(p2.x()), static_cast<float>(p2.y()));
   }
 
   inline
@@ -71,17 +73,7 @@ namespace utils {
            float theta,
            const Point2f& p) noexcept
   {
-    // Compute the angle between the point and the
-    // origin of the cone.
-    float angle = angleFromDirection(o, p);
-
-    // Compute the angle directing the cone.
-    float coneAngle = angleFromDirection(xDir, yDir);
-
-    // In order for the point to lie in the cone we
-    // should have the angle within `theta / 2` of
-    // the cone supporting angle.
-    return std::abs(angle - coneAngle) < theta / 2.0f;
+    return Cone(o, xDir, yDir, theta).contains(p);
   }
 
   inline
@@ -0,0 +1,93 @@
+#ifndef    MATRIX3_HH
+# define   MATRIX3_HH
+
+# include <cstddef>
+# include "Vector3.hh"
+
+namespace utils {
+
+  /**
+   * @brief - A 3x3 matrix stored in row major order. Vectors are considered
+   *          to be column vectors, i.e. `m * v` transforms `v` by `m` and
+   *          `(m1 * m2) * v == m1 * (m2 * v)`.
+   */
+  template <typename CoordinateType>
+  class Matrix3 {
+    public:
+
+      /**
+       * @brief - Creates an identity matrix.
+       */
+      constexpr
+      Matrix3() noexcept;
+
+      /**
+       * @brief - Creates a matrix from its coefficients given row by row.
+       */
+      constexpr
+      Matrix3(const CoordinateType& m00, const CoordinateType& m01, const CoordinateType& m02,
+              const CoordinateType& m10, const CoordinateType& m11, const CoordinateType& m12,
+              const CoordinateType& m20, const CoordinateType& m21, const CoordinateType& m22) noexcept;
+
+      constexpr CoordinateType&
+      operator()(std::size_t row, std::size_t col) noexcept;
+
+      constexpr const CoordinateType&
+      operator()(std::size_t row, std::size_t col) const noexcept;
+
+      constexpr bool
+      operator==(const Matrix3<CoordinateType>& other) const noexcept;
+
+      constexpr bool
+      operator!=(const Matrix3<CoordinateType>& other) const noexcept;
+
+      /**
+       * @brief - Compares the coefficients of this matrix with the ones of
+       *          `other` using the `Comparison` policy, see `ComparisonUtils.hh`.
+       */
+      template <typename Comparison>
+      constexpr bool
+      equals(const Matrix3<CoordinateType>& other) const noexcept;
+
+      constexpr Matrix3<CoordinateType>
+      operator*(const Matrix3<CoordinateType>& other) const noexcept;
+
+      constexpr Matrix3<CoordinateType>&
+      operator*=(const Matrix3<CoordinateType>& other) noexcept;
+
+      constexpr Vector3<CoordinateType>
+      operator*(const Vector3<CoordinateType>& vec) const noexcept;
+
+      constexpr Matrix3<CoordinateType>
+      transposed() const noexcept;
+
+      constexpr CoordinateType
+      determinant() const noexcept;
+
+      /**
+       * @brief - Computes the inverse of this matrix. Only meaningful for
+       *          floating point coordinates.
+       * @param out - output argument receiving the inverse. Left unchanged
+       *              if the matrix is singular.
+       * @return - `true` if the matrix could be inverted.
+       */
+      constexpr bool
+      invert(Matrix3<CoordinateType>& out) const noexcept;
+
+      static
+      constexpr Matrix3<CoordinateType>
+      identity() noexcept;
+
+    private:
+
+      CoordinateType m_data[9];
+  };
+
+  using Matrix3f = Matrix3<float>;
+  using Matrix3i = Matrix3<int>;
+
+}
+
+# include "Matrix3.hxx"
+
+#endif    /* MATRIX3_HH */
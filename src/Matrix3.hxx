@@ -0,0 +1,171 @@
+#ifndef    MATRIX3_HXX
+# define   MATRIX3_HXX
+
+# include "Matrix3.hh"
+# include "ComparisonUtils.hh"
+
+namespace utils {
+
+  template <typename CoordinateType>
+  inline
+  constexpr
+  Matrix3<CoordinateType>::Matrix3() noexcept:
+    m_data{
+      CoordinateType(1), CoordinateType(0), CoordinateType(0),
+      CoordinateType(0), CoordinateType(1), CoordinateType(0),
+      CoordinateType(0), CoordinateType(0), CoordinateType(1)
+    }
+  {}
+
+  template <typename CoordinateType>
+  inline
+  constexpr
+  Matrix3<CoordinateType>::Matrix3(const CoordinateType& m00, const CoordinateType& m01, const CoordinateType& m02,
+                                   const CoordinateType& m10, const CoordinateType& m11, const CoordinateType& m12,
+                                   const CoordinateType& m20, const CoordinateType& m21, const CoordinateType& m22) noexcept:
+    m_data{
+      m00, m01, m02,
+      m10, m11, m12,
+      m20, m21, m22
+    }
+  {}
+
+  template <typename CoordinateType>
+  inline
+  constexpr CoordinateType&
+  Matrix3<CoordinateType>::operator()(std::size_t row, std::size_t col) noexcept {
+    return m_data[3u * row + col];
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr const CoordinateType&
+  Matrix3<CoordinateType>::operator()(std::size_t row, std::size_t col) const noexcept {
+    return m_data[3u * row + col];
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr bool
+  Matrix3<CoordinateType>::operator==(const Matrix3<CoordinateType>& other) const noexcept {
+    return equals<typename DefaultComparison<CoordinateType>::Type>(other);
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr bool
+  Matrix3<CoordinateType>::operator!=(const Matrix3<CoordinateType>& other) const noexcept {
+    return !operator==(other);
+  }
+
+  template <typename CoordinateType>
+  template <typename Comparison>
+  inline
+  constexpr bool
+  Matrix3<CoordinateType>::equals(const Matrix3<CoordinateType>& other) const noexcept {
+    for (std::size_t id = 0u ; id < 9u ; ++id) {
+      if (!Comparison::equal(m_data[id], other.m_data[id])) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Matrix3<CoordinateType>
+  Matrix3<CoordinateType>::operator*(const Matrix3<CoordinateType>& other) const noexcept {
+    Matrix3<CoordinateType> out;
+
+    for (std::size_t row = 0u ; row < 3u ; ++row) {
+      for (std::size_t col = 0u ; col < 3u ; ++col) {
+        out(row, col) =
+          (*this)(row, 0u) * other(0u, col) +
+          (*this)(row, 1u) * other(1u, col) +
+          (*this)(row, 2u) * other(2u, col);
+      }
+    }
+
+    return out;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Matrix3<CoordinateType>&
+  Matrix3<CoordinateType>::operator*=(const Matrix3<CoordinateType>& other) noexcept {
+    *this = *this * other;
+    return *this;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Vector3<CoordinateType>
+  Matrix3<CoordinateType>::operator*(const Vector3<CoordinateType>& vec) const noexcept {
+    return Vector3<CoordinateType>(
+      m_data[0u] * vec.x() + m_data[1u] * vec.y() + m_data[2u] * vec.z(),
+      m_data[3u] * vec.x() + m_data[4u] * vec.y() + m_data[5u] * vec.z(),
+      m_data[6u] * vec.x() + m_data[7u] * vec.y() + m_data[8u] * vec.z()
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Matrix3<CoordinateType>
+  Matrix3<CoordinateType>::transposed() const noexcept {
+    return Matrix3<CoordinateType>(
+      m_data[0u], m_data[3u], m_data[6u],
+      m_data[1u], m_data[4u], m_data[7u],
+      m_data[2u], m_data[5u], m_data[8u]
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr CoordinateType
+  Matrix3<CoordinateType>::determinant() const noexcept {
+    return
+      m_data[0u] * (m_data[4u] * m_data[8u] - m_data[5u] * m_data[7u]) -
+      m_data[1u] * (m_data[3u] * m_data[8u] - m_data[5u] * m_data[6u]) +
+      m_data[2u] * (m_data[3u] * m_data[7u] - m_data[4u] * m_data[6u])
+    ;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr bool
+  Matrix3<CoordinateType>::invert(Matrix3<CoordinateType>& out) const noexcept {
+    const CoordinateType det = determinant();
+    if (fuzzyEqual(det, CoordinateType(0))) {
+      return false;
+    }
+
+    // The inverse is the transposed matrix of cofactors divided by the
+    // determinant.
+    out = Matrix3<CoordinateType>(
+      (m_data[4u] * m_data[8u] - m_data[5u] * m_data[7u]) / det,
+      (m_data[2u] * m_data[7u] - m_data[1u] * m_data[8u]) / det,
+      (m_data[1u] * m_data[5u] - m_data[2u] * m_data[4u]) / det,
+
+      (m_data[5u] * m_data[6u] - m_data[3u] * m_data[8u]) / det,
+      (m_data[0u] * m_data[8u] - m_data[2u] * m_data[6u]) / det,
+      (m_data[2u] * m_data[3u] - m_data[0u] * m_data[5u]) / det,
+
+      (m_data[3u] * m_data[7u] - m_data[4u] * m_data[6u]) / det,
+      (m_data[1u] * m_data[6u] - m_data[0u] * m_data[7u]) / det,
+      (m_data[0u] * m_data[4u] - m_data[1u] * m_data[3u]) / det
+    );
+
+    return true;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Matrix3<CoordinateType>
+  Matrix3<CoordinateType>::identity() noexcept {
+    return Matrix3<CoordinateType>();
+  }
+
+}
+
+#endif    /* MATRIX3_HXX */
@@ -0,0 +1,123 @@
+#ifndef    MATRIX4_HH
+# define   MATRIX4_HH
+
+# include <cstddef>
+# include "Vector3.hh"
+
+namespace utils {
+
+  /**
+   * @brief - A 4x4 matrix stored in row major order, mostly used to hold 3D
+   *          affine transforms in homogeneous coordinates. Just like for the
+   *          `Matrix3` vectors are considered to be column vectors.
+   */
+  template <typename CoordinateType>
+  class Matrix4 {
+    public:
+
+      /**
+       * @brief - Creates an identity matrix.
+       */
+      constexpr
+      Matrix4() noexcept;
+
+      /**
+       * @brief - Creates a matrix from its coefficients given row by row.
+       */
+      constexpr
+      Matrix4(const CoordinateType& m00, const CoordinateType& m01, const CoordinateType& m02, const CoordinateType& m03,
+              const CoordinateType& m10, const CoordinateType& m11, const CoordinateType& m12, const CoordinateType& m13,
+              const CoordinateType& m20, const CoordinateType& m21, const CoordinateType& m22, const CoordinateType& m23,
+              const CoordinateType& m30, const CoordinateType& m31, const CoordinateType& m32, const CoordinateType& m33) noexcept;
+
+      constexpr CoordinateType&
+      operator()(std::size_t row, std::size_t col) noexcept;
+
+      constexpr const CoordinateType&
+      operator()(std::size_t row, std::size_t col) const noexcept;
+
+      constexpr bool
+      operator==(const Matrix4<CoordinateType>& other) const noexcept;
+
+      constexpr bool
+      operator!=(const Matrix4<CoordinateType>& other) const noexcept;
+
+      /**
+       * @brief - Compares the coefficients of this matrix with the ones of
+       *          `other` using the `Comparison` policy, see `ComparisonUtils.hh`.
+       */
+      template <typename Comparison>
+      constexpr bool
+      equals(const Matrix4<CoordinateType>& other) const noexcept;
+
+      constexpr Matrix4<CoordinateType>
+      operator*(const Matrix4<CoordinateType>& other) const noexcept;
+
+      constexpr Matrix4<CoordinateType>&
+      operator*=(const Matrix4<CoordinateType>& other) noexcept;
+
+      constexpr Matrix4<CoordinateType>
+      transposed() const noexcept;
+
+      constexpr CoordinateType
+      determinant() const noexcept;
+
+      /**
+       * @brief - Computes the inverse of this matrix. Only meaningful for
+       *          floating point coordinates.
+       * @param out - output argument receiving the inverse. Left unchanged
+       *              if the matrix is singular.
+       * @return - `true` if the matrix could be inverted.
+       */
+      constexpr bool
+      invert(Matrix4<CoordinateType>& out) const noexcept;
+
+      /**
+       * @brief - Transforms the input point, considering that its homogeneous
+       *          coordinate is `1`. The last row of the matrix is ignored so
+       *          no perspective division happens.
+       */
+      constexpr Vector3<CoordinateType>
+      transformPoint(const Vector3<CoordinateType>& point) const noexcept;
+
+      /**
+       * @brief - Transforms the input direction: similar to `transformPoint`
+       *          but the translation part of the matrix is ignored.
+       */
+      constexpr Vector3<CoordinateType>
+      transformDirection(const Vector3<CoordinateType>& dir) const noexcept;
+
+      /**
+       * @brief - Batch version of `transformPoint`. The `out` array can be
+       *          the same as `in`.
+       */
+      void
+      transformPoints(const Vector3<CoordinateType>* in,
+                      std::size_t count,
+                      Vector3<CoordinateType>* out) const noexcept;
+
+      static
+      constexpr Matrix4<CoordinateType>
+      identity() noexcept;
+
+      static
+      constexpr Matrix4<CoordinateType>
+      translation(const Vector3<CoordinateType>& offset) noexcept;
+
+      static
+      constexpr Matrix4<CoordinateType>
+      scaling(const Vector3<CoordinateType>& factors) noexcept;
+
+    private:
+
+      CoordinateType m_data[16];
+  };
+
+  using Matrix4f = Matrix4<float>;
+  using Matrix4i = Matrix4<int>;
+
+}
+
+# include "Matrix4.hxx"
+
+#endif    /* MATRIX4_HH */
@@ -0,0 +1,262 @@
+#ifndef    MATRIX4_HXX
+# define   MATRIX4_HXX
+
+# include "Matrix4.hh"
+# include "ComparisonUtils.hh"
+
+namespace utils {
+
+  template <typename CoordinateType>
+  inline
+  constexpr
+  Matrix4<CoordinateType>::Matrix4() noexcept:
+    m_data{
+      CoordinateType(1), CoordinateType(0), CoordinateType(0), CoordinateType(0),
+      CoordinateType(0), CoordinateType(1), CoordinateType(0), CoordinateType(0),
+      CoordinateType(0), CoordinateType(0), CoordinateType(1), CoordinateType(0),
+      CoordinateType(0), CoordinateType(0), CoordinateType(0), CoordinateType(1)
+    }
+  {}
+
+  template <typename CoordinateType>
+  inline
+  constexpr
+  Matrix4<CoordinateType>::Matrix4(const CoordinateType& m00, const CoordinateType& m01, const CoordinateType& m02, const CoordinateType& m03,
+                                   const CoordinateType& m10, const CoordinateType& m11, const CoordinateType& m12, const CoordinateType& m13,
+                                   const CoordinateType& m20, const CoordinateType& m21, const CoordinateType& m22, const CoordinateType& m23,
+                                   const CoordinateType& m30, const CoordinateType& m31, const CoordinateType& m32, const CoordinateType& m33) noexcept:
+    m_data{
+      m00, m01, m02, m03,
+      m10, m11, m12, m13,
+      m20, m21, m22, m23,
+      m30, m31, m32, m33
+    }
+  {}
+
+  template <typename CoordinateType>
+  inline
+  constexpr CoordinateType&
+  Matrix4<CoordinateType>::operator()(std::size_t row, std::size_t col) noexcept {
+    return m_data[4u * row + col];
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr const CoordinateType&
+  Matrix4<CoordinateType>::operator()(std::size_t row, std::size_t col) const noexcept {
+    return m_data[4u * row + col];
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr bool
+  Matrix4<CoordinateType>::operator==(const Matrix4<CoordinateType>& other) const noexcept {
+    return equals<typename DefaultComparison<CoordinateType>::Type>(other);
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr bool
+  Matrix4<CoordinateType>::operator!=(const Matrix4<CoordinateType>& other) const noexcept {
+    return !operator==(other);
+  }
+
+  template <typename CoordinateType>
+  template <typename Comparison>
+  inline
+  constexpr bool
+  Matrix4<CoordinateType>::equals(const Matrix4<CoordinateType>& other) const noexcept {
+    for (std::size_t id = 0u ; id < 16u ; ++id) {
+      if (!Comparison::equal(m_data[id], other.m_data[id])) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Matrix4<CoordinateType>
+  Matrix4<CoordinateType>::operator*(const Matrix4<CoordinateType>& other) const noexcept {
+    Matrix4<CoordinateType> out;
+
+    for (std::size_t row = 0u ; row < 4u ; ++row) {
+      for (std::size_t col = 0u ; col < 4u ; ++col) {
+        out(row, col) =
+          (*this)(row, 0u) * other(0u, col) +
+          (*this)(row, 1u) * other(1u, col) +
+          (*this)(row, 2u) * other(2u, col) +
+          (*this)(row, 3u) * other(3u, col);
+      }
+    }
+
+    return out;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Matrix4<CoordinateType>&
+  Matrix4<CoordinateType>::operator*=(const Matrix4<CoordinateType>& other) noexcept {
+    *this = *this * other;
+    return *this;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Matrix4<CoordinateType>
+  Matrix4<CoordinateType>::transposed() const noexcept {
+    Matrix4<CoordinateType> out;
+
+    for (std::size_t row = 0u ; row < 4u ; ++row) {
+      for (std::size_t col = 0u ; col < 4u ; ++col) {
+        out(col, row) = (*this)(row, col);
+      }
+    }
+
+    return out;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr CoordinateType
+  Matrix4<CoordinateType>::determinant() const noexcept {
+    const CoordinateType* m = m_data;
+
+    // Expand along the first row using the 2x2 minors of the last two rows.
+    const CoordinateType s0 = m[10] * m[15] - m[11] * m[14];
+    const CoordinateType s1 = m[9] * m[15] - m[11] * m[13];
+    const CoordinateType s2 = m[9] * m[14] - m[10] * m[13];
+    const CoordinateType s3 = m[8] * m[15] - m[11] * m[12];
+    const CoordinateType s4 = m[8] * m[14] - m[10] * m[12];
+    const CoordinateType s5 = m[8] * m[13] - m[9] * m[12];
+
+    return
+      m[0] * (m[5] * s0 - m[6] * s1 + m[7] * s2) -
+      m[1] * (m[4] * s0 - m[6] * s3 + m[7] * s4) +
+      m[2] * (m[4] * s1 - m[5] * s3 + m[7] * s5) -
+      m[3] * (m[4] * s2 - m[5] * s4 + m[6] * s5)
+    ;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr bool
+  Matrix4<CoordinateType>::invert(Matrix4<CoordinateType>& out) const noexcept {
+    const CoordinateType* m = m_data;
+
+    // Compute the 2x2 minors of the first two rows and of the last two rows:
+    // the cofactors of the matrix can be expressed with them, which is the
+    // usual way to invert a 4x4 matrix with few operations.
+    const CoordinateType a0 = m[0] * m[5] - m[1] * m[4];
+    const CoordinateType a1 = m[0] * m[6] - m[2] * m[4];
+    const CoordinateType a2 = m[0] * m[7] - m[3] * m[4];
+    const CoordinateType a3 = m[1] * m[6] - m[2] * m[5];
+    const CoordinateType a4 = m[1] * m[7] - m[3] * m[5];
+    const CoordinateType a5 = m[2] * m[7] - m[3] * m[6];
+
+    const CoordinateType b0 = m[8] * m[13] - m[9] * m[12];
+    const CoordinateType b1 = m[8] * m[14] - m[10] * m[12];
+    const CoordinateType b2 = m[8] * m[15] - m[11] * m[12];
+    const CoordinateType b3 = m[9] * m[14] - m[10] * m[13];
+    const CoordinateType b4 = m[9] * m[15] - m[11] * m[13];
+    const CoordinateType b5 = m[10] * m[15] - m[11] * m[14];
+
+    const CoordinateType det = a0 * b5 - a1 * b4 + a2 * b3 + a3 * b2 - a4 * b1 + a5 * b0;
+    if (fuzzyEqual(det, CoordinateType(0))) {
+      return false;
+    }
+
+    out = Matrix4<CoordinateType>(
+      ( m[5] * b5 - m[6] * b4 + m[7] * b3) / det,
+      (-m[1] * b5 + m[2] * b4 - m[3] * b3) / det,
+      ( m[13] * a5 - m[14] * a4 + m[15] * a3) / det,
+      (-m[9] * a5 + m[10] * a4 - m[11] * a3) / det,
+
+      (-m[4] * b5 + m[6] * b2 - m[7] * b1) / det,
+      ( m[0] * b5 - m[2] * b2 + m[3] * b1) / det,
+      (-m[12] * a5 + m[14] * a2 - m[15] * a1) / det,
+      ( m[8] * a5 - m[10] * a2 + m[11] * a1) / det,
+
+      ( m[4] * b4 - m[5] * b2 + m[7] * b0) / det,
+      (-m[0] * b4 + m[1] * b2 - m[3] * b0) / det,
+      ( m[12] * a4 - m[13] * a2 + m[15] * a0) / det,
+      (-m[8] * a4 + m[9] * a2 - m[11] * a0) / det,
+
+      (-m[4] * b3 + m[5] * b1 - m[6] * b0) / det,
+      ( m[0] * b3 - m[1] * b1 + m[2] * b0) / det,
+      (-m[12] * a3 + m[13] * a1 - m[14] * a0) / det,
+      ( m[8] * a3 - m[9] * a1 + m[10] * a0) / det
+    );
+
+    return true;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Vector3<CoordinateType>
+  Matrix4<CoordinateType>::transformPoint(const Vector3<CoordinateType>& point) const noexcept {
+    return Vector3<CoordinateType>(
+      m_data[0u] * point.x() + m_data[1u] * point.y() + m_data[2u] * point.z() + m_data[3u],
+      m_data[4u] * point.x() + m_data[5u] * point.y() + m_data[6u] * point.z() + m_data[7u],
+      m_data[8u] * point.x() + m_data[9u] * point.y() + m_data[10u] * point.z() + m_data[11u]
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Vector3<CoordinateType>
+  Matrix4<CoordinateType>::transformDirection(const Vector3<CoordinateType>& dir) const noexcept {
+    return Vector3<CoordinateType>(
+      m_data[0u] * dir.x() + m_data[1u] * dir.y() + m_data[2u] * dir.z(),
+      m_data[4u] * dir.x() + m_data[5u] * dir.y() + m_data[6u] * dir.z(),
+      m_data[8u] * dir.x() + m_data[9u] * dir.y() + m_data[10u] * dir.z()
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Matrix4<CoordinateType>::transformPoints(const Vector3<CoordinateType>* in,
+                                           std::size_t count,
+                                           Vector3<CoordinateType>* out) const noexcept
+  {
+    for (std::size_t id = 0u ; id < count ; ++id) {
+      out[id] = transformPoint(in[id]);
+    }
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Matrix4<CoordinateType>
+  Matrix4<CoordinateType>::identity() noexcept {
+    return Matrix4<CoordinateType>();
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Matrix4<CoordinateType>
+  Matrix4<CoordinateType>::translation(const Vector3<CoordinateType>& offset) noexcept {
+    Matrix4<CoordinateType> out;
+    out(0u, 3u) = offset.x();
+    out(1u, 3u) = offset.y();
+    out(2u, 3u) = offset.z();
+
+    return out;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Matrix4<CoordinateType>
+  Matrix4<CoordinateType>::scaling(const Vector3<CoordinateType>& factors) noexcept {
+    Matrix4<CoordinateType> out;
+    out(0u, 0u) = factors.x();
+    out(1u, 1u) = factors.y();
+    out(2u, 2u) = factors.z();
+
+    return out;
+  }
+
+}
+
+#endif    /* MATRIX4_HXX */
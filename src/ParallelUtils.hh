@@ -0,0 +1,52 @@
+#ifndef    PARALLEL_UTILS_HH
+# define   PARALLEL_UTILS_HH
+
+# include <cstddef>
+
+namespace utils {
+
+  /**
+   * @brief - The minimum number of elements processed by a single thread in
+   *          `parallelFor`: below this spawning threads costs more than it
+   *          saves.
+   */
+  constexpr std::size_t kDefaultParallelChunk = 16384u;
+
+  /**
+   * @brief - Used to determine how many threads should process `count`
+   *          elements given the requested number of threads (`0` meaning
+   *          one per hardware thread) and the minimum chunk size.
+   * @param count - the number of elements to process.
+   * @param threads - the requested number of threads.
+   * @param minChunk - the minimum number of elements per thread.
+   * @return - the number of threads to use, at least `1`.
+   */
+  unsigned
+  threadsFor(std::size_t count,
+             unsigned threads = 0u,
+             std::size_t minChunk = kDefaultParallelChunk) noexcept;
+
+  /**
+   * @brief - Splits the range `[0; count[` into contiguous chunks and calls
+   *          `func(chunk, begin, end)` for each of them, each chunk being
+   *          processed by its own thread. The calling thread processes the
+   *          first chunk and the function returns once all chunks are done.
+   *          Chunks are numbered from `0` to `threadsFor(...) - 1`.
+   * @param count - the number of elements to process.
+   * @param func - a callable accepting `(unsigned, std::size_t, std::size_t)`.
+   * @param threads - the requested number of threads, `0` to use one per
+   *                  hardware thread.
+   * @param minChunk - the minimum number of elements per thread.
+   */
+  template <typename Function>
+  void
+  parallelFor(std::size_t count,
+              Function&& func,
+              unsigned threads = 0u,
+              std::size_t minChunk = kDefaultParallelChunk);
+
+}
+
+# include "ParallelUtils.hxx"
+
+#endif    /* PARALLEL_UTILS_HH */
@@ -0,0 +1,66 @@
+#ifndef    PARALLEL_UTILS_HXX
+# define   PARALLEL_UTILS_HXX
+
+# include <thread>
+# include <vector>
+# include <algorithm>
+# include "ParallelUtils.hh"
+
+namespace utils {
+
+  inline
+  unsigned
+  threadsFor(std::size_t count,
+             unsigned threads,
+             std::size_t minChunk) noexcept
+  {
+    if (threads == 0u) {
+      // Querying the number of hardware threads reads system files on some
+      // platforms which is way more costly than small batches.
+      static const unsigned kHardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+      threads = kHardwareThreads;
+    }
+
+    const std::size_t chunks = std::max<std::size_t>(1u, count / std::max<std::size_t>(1u, minChunk));
+    return static_cast<unsigned>(std::min<std::size_t>(threads, chunks));
+  }
+
+  template <typename Function>
+  inline
+  void
+  parallelFor(std::size_t count,
+              Function&& func,
+              unsigned threads,
+              std::size_t minChunk)
+  {
+    const unsigned workers = threadsFor(count, threads, minChunk);
+    if (workers <= 1u) {
+      func(0u, std::size_t(0u), count);
+      return;
+    }
+
+    const std::size_t chunk = (count + workers - 1u) / workers;
+
+    std::vector<std::thread> pool;
+    pool.reserve(workers - 1u);
+
+    for (unsigned id = 1u ; id < workers ; ++id) {
+      const std::size_t begin = std::min(count, id * chunk);
+      const std::size_t end = std::min(count, begin + chunk);
+      pool.emplace_back(
+        [&func, id, begin, end]() {
+          func(id, begin, end);
+        }
+      );
+    }
+
+    func(0u, std::size_t(0u), std::min(count, chunk));
+
+    for (std::thread& t : pool) {
+      t.join();
+    }
+  }
+
+}
+
+#endif    /* PARALLEL_UTILS_HXX */
@@ -0,0 +1,119 @@
+#ifndef    PRIMITIVE_ARRAYS_HH
+# define   PRIMITIVE_ARRAYS_HH
+
+# include <vector>
+# include <cstddef>
+# include "Box.hh"
+# include "Size.hh"
+# include "Vector2.hh"
+# include "Vector3.hh"
+
+namespace utils {
+  namespace details {
+
+    /**
+     * @brief - Describes how a primitive is made of coordinates, defined for
+     *          `Vector2`, `Vector3`, `Size` and `Box`.
+     */
+    template <typename Primitive>
+    struct PrimitiveTraits;
+
+    template <typename CoordinateType>
+    struct PrimitiveTraits<Vector2<CoordinateType>> {
+      using ValueType = CoordinateType;
+      static constexpr std::size_t kCoordinates = 2u;
+
+      template <typename OtherCoordinateType>
+      using Rebind = Vector2<OtherCoordinateType>;
+    };
+
+    template <typename CoordinateType>
+    struct PrimitiveTraits<Vector3<CoordinateType>> {
+      using ValueType = CoordinateType;
+      static constexpr std::size_t kCoordinates = 3u;
+
+      template <typename OtherCoordinateType>
+      using Rebind = Vector3<OtherCoordinateType>;
+    };
+
+    template <typename DimsType>
+    struct PrimitiveTraits<Size<DimsType>> {
+      using ValueType = DimsType;
+      static constexpr std::size_t kCoordinates = 2u;
+
+      template <typename OtherDimsType>
+      using Rebind = Size<OtherDimsType>;
+    };
+
+    template <typename CoordinateType>
+    struct PrimitiveTraits<Box<CoordinateType>> {
+      using ValueType = CoordinateType;
+      static constexpr std::size_t kCoordinates = 4u;
+
+      template <typename OtherCoordinateType>
+      using Rebind = Box<OtherCoordinateType>;
+    };
+
+  }
+
+  /**
+   * @brief - Views an array of primitives as the flat array of their
+   *          coordinates, in declaration order: `(x, y)` for vectors,
+   *          `(w, h)` for sizes and `(x, y, w, h)` for boxes. This is the
+   *          layout expected by most C APIs (graphics buffers, etc.) and no
+   *          copy is made.
+   * @param primitives - the array of primitives.
+   * @return - a pointer to the first coordinate of the array, which holds
+   *           `kCoordinates` values per primitive.
+   */
+  template <typename Primitive>
+  typename details::PrimitiveTraits<Primitive>::ValueType*
+  coordinates(Primitive* primitives) noexcept;
+
+  template <typename Primitive>
+  const typename details::PrimitiveTraits<Primitive>::ValueType*
+  coordinates(const Primitive* primitives) noexcept;
+
+  /**
+   * @brief - Copies `count` primitives from `in` to `out` with a single
+   *          memory copy. The ranges may overlap, which allows to shift
+   *          elements within an array.
+   */
+  template <typename Primitive>
+  void
+  copyPrimitives(const Primitive* in,
+                 std::size_t count,
+                 Primitive* out) noexcept;
+
+  /**
+   * @brief - Converts `count` primitives to another coordinate type, in the
+   *          same way as `Size::toType`: each coordinate is converted with a
+   *          `static_cast`, so values are truncated when converting to an
+   *          integral type. The conversion runs on the flat arrays of
+   *          coordinates which lets the compiler vectorize it.
+   * @param in - the primitives to convert.
+   * @param count - the number of primitives.
+   * @param out - the output array, which should not overlap with `in` when
+   *              the coordinate types are different.
+   */
+  template <typename Primitive, typename OtherPrimitive>
+  void
+  toType(const Primitive* in,
+         std::size_t count,
+         OtherPrimitive* out) noexcept;
+
+  /**
+   * @brief - Similar to the other overload but converts a whole vector,
+   *          e.g. `toType<float>(boxes)`.
+   */
+  template <typename OtherCoordinateType,
+            template <typename> class Primitive,
+            typename CoordinateType>
+  std::vector<Primitive<OtherCoordinateType>>
+  toType(const std::vector<Primitive<CoordinateType>>& in);
+
+}
+
+# include "PrimitiveArrays.hxx"
+
+#endif    /* PRIMITIVE_ARRAYS_HH */
@@ -0,0 +1,97 @@
+#ifndef    PRIMITIVE_ARRAYS_HXX
+# define   PRIMITIVE_ARRAYS_HXX
+
+# include <cstring>
+# include <type_traits>
+# include "PrimitiveArrays.hh"
+# include "PrimitiveLayout.hh"
+
+namespace utils {
+
+  template <typename Primitive>
+  inline
+  typename details::PrimitiveTraits<Primitive>::ValueType*
+  coordinates(Primitive* primitives) noexcept {
+    using Traits = details::PrimitiveTraits<Primitive>;
+    static_assert(
+      isFlatPrimitive<Primitive, typename Traits::ValueType, Traits::kCoordinates>,
+      "Primitive cannot be viewed as an array of coordinates"
+    );
+
+    return reinterpret_cast<typename Traits::ValueType*>(primitives);
+  }
+
+  template <typename Primitive>
+  inline
+  const typename details::PrimitiveTraits<Primitive>::ValueType*
+  coordinates(const Primitive* primitives) noexcept {
+    using Traits = details::PrimitiveTraits<Primitive>;
+    static_assert(
+      isFlatPrimitive<Primitive, typename Traits::ValueType, Traits::kCoordinates>,
+      "Primitive cannot be viewed as an array of coordinates"
+    );
+
+    return reinterpret_cast<const typename Traits::ValueType*>(primitives);
+  }
+
+  template <typename Primitive>
+  inline
+  void
+  copyPrimitives(const Primitive* in,
+                 std::size_t count,
+                 Primitive* out) noexcept
+  {
+    static_assert(std::is_trivially_copyable<Primitive>::value, "Primitive cannot be copied with memmove");
+
+    // `memmove` requires valid pointers even when there is nothing to copy.
+    if (count == 0u) {
+      return;
+    }
+
+    std::memmove(static_cast<void*>(out), static_cast<const void*>(in), count * sizeof(Primitive));
+  }
+
+  template <typename Primitive, typename OtherPrimitive>
+  inline
+  void
+  toType(const Primitive* in,
+         std::size_t count,
+         OtherPrimitive* out) noexcept
+  {
+    using Traits = details::PrimitiveTraits<Primitive>;
+    using OtherCoordinateType = typename details::PrimitiveTraits<OtherPrimitive>::ValueType;
+
+    static_assert(
+      std::is_same<typename Traits::template Rebind<OtherCoordinateType>, OtherPrimitive>::value,
+      "toType can only change the coordinate type of a primitive"
+    );
+
+    if constexpr (std::is_same<Primitive, OtherPrimitive>::value) {
+      copyPrimitives(in, count, out);
+    }
+    else {
+      const typename Traits::ValueType* from = coordinates(in);
+      OtherCoordinateType* to = coordinates(out);
+
+      const std::size_t values = count * Traits::kCoordinates;
+      for (std::size_t id = 0u ; id < values ; ++id) {
+        to[id] = static_cast<OtherCoordinateType>(from[id]);
+      }
+    }
+  }
+
+  template <typename OtherCoordinateType,
+            template <typename> class Primitive,
+            typename CoordinateType>
+  inline
+  std::vector<Primitive<OtherCoordinateType>>
+  toType(const std::vector<Primitive<CoordinateType>>& in) {
+    std::vector<Primitive<OtherCoordinateType>> out(in.size());
+    toType(in.data(), in.size(), out.data());
+
+    return out;
+  }
+
+}
+
+#endif    /* PRIMITIVE_ARRAYS_HXX */
@@ -0,0 +1,26 @@
+#ifndef    PRIMITIVE_LAYOUT_HH
+# define   PRIMITIVE_LAYOUT_HH
+
+# include <cstddef>
+# include <type_traits>
+
+namespace utils {
+
+  /**
+   * @brief - Whether `Primitive` is stored exactly as `Count` contiguous
+   *          values of `CoordinateType` and can be copied with `memcpy`.
+   *          An array of such primitives can be handed to C code or to the
+   *          SIMD kernels as a flat array of coordinates, and containers
+   *          relocate it with plain memory copies.
+   */
+  template <typename Primitive, typename CoordinateType, std::size_t Count>
+  constexpr bool isFlatPrimitive =
+    std::is_trivially_copyable<Primitive>::value &&
+    std::is_standard_layout<Primitive>::value &&
+    sizeof(Primitive) == Count * sizeof(CoordinateType) &&
+    alignof(Primitive) == alignof(CoordinateType)
+  ;
+
+}
+
+#endif    /* PRIMITIVE_LAYOUT_HH */
@@ -0,0 +1,230 @@
+#ifndef    QUAD_TREE_HH
+# define   QUAD_TREE_HH
+
+# include <vector>
+# include <cstdint>
+# include "Box.hh"
+# include "Bounds.hh"
+
+namespace utils {
+
+  /**
+   * @brief - A dynamic loose quadtree indexing boxes. Each node covers a
+   *          cell of the area of the tree but accepts items whose center
+   *          lies in the cell and which extend at most half a cell outside
+   *          of it. Items are stored in the deepest node accepting them.
+   *          This looseness allows items to move slightly without being
+   *          reinserted.
+   *          Nodes and items are stored in pools and recycled through free
+   *          lists: once the pools have grown to their working size (or
+   *          after a call to `reserve`), updates do not allocate memory.
+   *          Items whose center is outside of the area of the tree are kept
+   *          in the root node and are still reported by queries.
+   */
+  template <typename CoordinateType>
+  class QuadTree {
+    public:
+
+      /**
+       * @brief - The handle identifying an item inserted in the tree.
+       */
+      using ItemId = std::uint32_t;
+
+      /**
+       * @brief - The maximum depth supported by the tree. Larger values
+       *          provided to the constructor are clamped.
+       */
+      static constexpr unsigned kMaxDepthLimit = 16u;
+
+      /**
+       * @brief - Creates an empty tree covering `area`.
+       * @param area - the area covered by the root node.
+       * @param maxDepth - the maximum depth of nodes.
+       * @param maxItemsPerNode - the number of items a leaf can hold before
+       *                          being subdivided.
+       */
+      explicit
+      QuadTree(const Box<CoordinateType>& area,
+               unsigned maxDepth = 8u,
+               unsigned maxItemsPerNode = 8u);
+
+      /**
+       * @brief - Preallocates the pools to hold `items` items without
+       *          reallocating.
+       * @param items - the expected number of items.
+       */
+      void
+      reserve(std::size_t items);
+
+      std::size_t
+      size() const noexcept;
+
+      bool
+      empty() const noexcept;
+
+      /**
+       * @brief - Removes all the items from the tree. Storage is kept.
+       */
+      void
+      clear() noexcept;
+
+      /**
+       * @brief - Inserts an item with the specified bounds.
+       * @param bounds - the bounds of the item.
+       * @return - the handle of the item, valid until it is removed.
+       */
+      ItemId
+      insert(const Box<CoordinateType>& bounds);
+
+      /**
+       * @brief - Removes the item from the tree. The handle must be valid.
+       * @param id - the handle of the item to remove.
+       */
+      void
+      remove(ItemId id) noexcept;
+
+      /**
+       * @brief - Updates the bounds of the item. In case the new bounds still
+       *          fit in the node holding the item nothing else is done.
+       *          Otherwise the item is moved to the relevant node.
+       * @param id - the handle of the item to move.
+       * @param bounds - the new bounds of the item.
+       */
+      void
+      move(ItemId id, const Box<CoordinateType>& bounds);
+
+      /**
+       * @brief - Returns the bounds of the item. The handle must be valid.
+       */
+      const Box<CoordinateType>&
+      bounds(ItemId id) const noexcept;
+
+      /**
+       * @brief - Calls `callback` with the handle of each item `i` for which
+       *          `area.intersects(i, strict)` is `true`.
+       * @param area - the area to query.
+       * @param callback - a callable accepting an `ItemId`.
+       * @param strict - whether touching boxes are considered intersecting.
+       */
+      template <typename Callback>
+      void
+      forEachIntersecting(const Box<CoordinateType>& area,
+                          Callback&& callback,
+                          bool strict = false) const;
+
+      void
+      intersecting(const Box<CoordinateType>& area,
+                   std::vector<ItemId>& out,
+                   bool strict = false) const;
+
+      /**
+       * @brief - Calls `callback` with the handle of each item which is at
+       *          most at `radius` from `center`, i.e. for which the value of
+       *          `d2` between `center` and the nearest point of the item is
+       *          not larger than `radius * radius`.
+       * @param center - the center of the query.
+       * @param radius - the radius of the query.
+       * @param callback - a callable accepting an `ItemId`.
+       */
+      template <typename Callback>
+      void
+      forEachInRadius(const Vector2<CoordinateType>& center,
+                      float radius,
+                      Callback&& callback) const;
+
+      void
+      inRadius(const Vector2<CoordinateType>& center,
+               float radius,
+               std::vector<ItemId>& out) const;
+
+    private:
+
+      static constexpr std::uint32_t kInvalid = 0xFFFFFFFFu;
+
+      /**
+       * @brief - The size of the stack used by traversals: each level pushes
+       *          at most four nodes and pops one.
+       */
+      static constexpr std::size_t kStackSize = 3u * kMaxDepthLimit + 4u;
+
+      /**
+       * @brief - A node of the tree. Children of a node are allocated as a
+       *          block of four consecutive nodes starting at `children`, the
+       *          child `i` covering the right half of the cell if `i & 1` is
+       *          set and the top half if `i & 2` is set.
+       *          Nodes in the free list use `parent` to link to the next free
+       *          block.
+       */
+      struct Node {
+        Bounds<CoordinateType> cell;
+        Bounds<CoordinateType> loose;
+        std::uint32_t parent;
+        std::uint32_t children;
+        std::uint32_t firstItem;
+        std::uint32_t count;
+        std::uint32_t depth;
+      };
+
+      /**
+       * @brief - An item of the tree. Items of a node are linked through the
+       *          `prev` and `next` fields. Items in the free list use `next`
+       *          to link to the next free item.
+       */
+      struct Item {
+        Box<CoordinateType> box;
+        std::uint32_t node;
+        std::uint32_t prev;
+        std::uint32_t next;
+      };
+
+      Node
+      makeNode(const Bounds<CoordinateType>& cell,
+               std::uint32_t parent,
+               std::uint32_t depth) const noexcept;
+
+      bool
+      fitsIn(const Box<CoordinateType>& box,
+             const Node& node) const noexcept;
+
+      std::uint32_t
+      childFor(const Node& node, const Box<CoordinateType>& box) const noexcept;
+
+      std::uint32_t
+      findNode(const Box<CoordinateType>& box) const noexcept;
+
+      void
+      link(std::uint32_t item, std::uint32_t node) noexcept;
+
+      void
+      unlink(std::uint32_t item) noexcept;
+
+      void
+      split(std::uint32_t node);
+
+      void
+      collapse(std::uint32_t node) noexcept;
+
+      std::uint32_t
+      allocateChildren();
+
+    private:
+
+      unsigned m_maxDepth;
+      unsigned m_maxItemsPerNode;
+      std::size_t m_size;
+
+      std::vector<Node> m_nodes;
+      std::uint32_t m_freeNodes;
+
+      std::vector<Item> m_items;
+      std::uint32_t m_freeItems;
+  };
+
+  using QuadTreef = QuadTree<float>;
+  using QuadTreei = QuadTree<int>;
+
+}
+
+# include "QuadTree.hxx"
+
+#endif    /* QUAD_TREE_HH */
@@ -0,0 +1,467 @@
+#ifndef    QUAD_TREE_HXX
+# define   QUAD_TREE_HXX
+
+# include "QuadTree.hh"
+# include "LocationUtils.hh"
+
+namespace utils {
+
+  template <typename CoordinateType>
+  inline
+  QuadTree<CoordinateType>::QuadTree(const Box<CoordinateType>& area,
+                                     unsigned maxDepth,
+                                     unsigned maxItemsPerNode):
+    m_maxDepth(maxDepth > kMaxDepthLimit ? kMaxDepthLimit : maxDepth),
+    m_maxItemsPerNode(maxItemsPerNode),
+    m_size(0u),
+
+    m_nodes(),
+    m_freeNodes(kInvalid),
+
+    m_items(),
+    m_freeItems(kInvalid)
+  {
+    m_nodes.push_back(makeNode(Bounds<CoordinateType>(area), kInvalid, 0u));
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  QuadTree<CoordinateType>::reserve(std::size_t items) {
+    m_items.reserve(items);
+
+    // Assume that leaves are on average half full.
+    const std::size_t leaves = 2u * items / (m_maxItemsPerNode > 0u ? m_maxItemsPerNode : 1u);
+    m_nodes.reserve(1u + 4u * (leaves / 3u + 1u));
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  QuadTree<CoordinateType>::size() const noexcept {
+    return m_size;
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  QuadTree<CoordinateType>::empty() const noexcept {
+    return m_size == 0u;
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  QuadTree<CoordinateType>::clear() noexcept {
+    const Bounds<CoordinateType> area = m_nodes[0u].cell;
+
+    m_nodes.resize(1u);
+    m_nodes[0u] = makeNode(area, kInvalid, 0u);
+    m_freeNodes = kInvalid;
+
+    m_items.clear();
+    m_freeItems = kInvalid;
+
+    m_size = 0u;
+  }
+
+  template <typename CoordinateType>
+  inline
+  typename QuadTree<CoordinateType>::ItemId
+  QuadTree<CoordinateType>::insert(const Box<CoordinateType>& bounds) {
+    std::uint32_t id = m_freeItems;
+    if (id != kInvalid) {
+      m_freeItems = m_items[id].next;
+      m_items[id].box = bounds;
+    }
+    else {
+      id = static_cast<std::uint32_t>(m_items.size());
+      m_items.push_back(Item{bounds, kInvalid, kInvalid, kInvalid});
+    }
+
+    const std::uint32_t node = findNode(bounds);
+    link(id, node);
+    ++m_size;
+
+    const Node& n = m_nodes[node];
+    if (n.children == kInvalid && n.count > m_maxItemsPerNode && n.depth < m_maxDepth) {
+      split(node);
+    }
+
+    return id;
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  QuadTree<CoordinateType>::remove(ItemId id) noexcept {
+    const std::uint32_t node = m_items[id].node;
+    unlink(id);
+
+    m_items[id].node = kInvalid;
+    m_items[id].next = m_freeItems;
+    m_freeItems = id;
+
+    --m_size;
+
+    collapse(node);
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  QuadTree<CoordinateType>::move(ItemId id, const Box<CoordinateType>& bounds) {
+    Item& item = m_items[id];
+    item.box = bounds;
+
+    // The item can stay where it is if it still fits in its node and can't
+    // be pushed further down. Items outside of the area of the tree always
+    // stay in the root node.
+    const Node& node = m_nodes[item.node];
+    const bool fits = fitsIn(bounds, node);
+
+    if (!fits && item.node == 0u) {
+      return;
+    }
+    if (fits && (node.children == kInvalid || !fitsIn(bounds, m_nodes[childFor(node, bounds)]))) {
+      return;
+    }
+
+    const std::uint32_t previous = item.node;
+    unlink(id);
+    collapse(previous);
+
+    const std::uint32_t target = findNode(bounds);
+    link(id, target);
+
+    const Node& n = m_nodes[target];
+    if (n.children == kInvalid && n.count > m_maxItemsPerNode && n.depth < m_maxDepth) {
+      split(target);
+    }
+  }
+
+  template <typename CoordinateType>
+  inline
+  const Box<CoordinateType>&
+  QuadTree<CoordinateType>::bounds(ItemId id) const noexcept {
+    return m_items[id].box;
+  }
+
+  template <typename CoordinateType>
+  template <typename Callback>
+  inline
+  void
+  QuadTree<CoordinateType>::forEachIntersecting(const Box<CoordinateType>& area,
+                                                Callback&& callback,
+                                                bool strict) const
+  {
+    const Bounds<CoordinateType> query(area);
+
+    std::uint32_t stack[kStackSize];
+    std::size_t top = 0u;
+    stack[top++] = 0u;
+
+    while (top > 0u) {
+      const std::uint32_t id = stack[--top];
+      const Node& node = m_nodes[id];
+
+      // The root node is always visited as it holds the items outside
+      // of the area of the tree.
+      if (id != 0u && !query.intersects(node.loose)) {
+        continue;
+      }
+
+      for (std::uint32_t item = node.firstItem ; item != kInvalid ; item = m_items[item].next) {
+        if (area.intersects(m_items[item].box, strict)) {
+          callback(static_cast<ItemId>(item));
+        }
+      }
+
+      if (node.children != kInvalid) {
+        for (std::uint32_t child = 0u ; child < 4u ; ++child) {
+          stack[top++] = node.children + child;
+        }
+      }
+    }
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  QuadTree<CoordinateType>::intersecting(const Box<CoordinateType>& area,
+                                         std::vector<ItemId>& out,
+                                         bool strict) const
+  {
+    forEachIntersecting(
+      area,
+      [&out](ItemId id) {
+        out.push_back(id);
+      },
+      strict
+    );
+  }
+
+  template <typename CoordinateType>
+  template <typename Callback>
+  inline
+  void
+  QuadTree<CoordinateType>::forEachInRadius(const Vector2<CoordinateType>& center,
+                                            float radius,
+                                            Callback&& callback) const
+  {
+    const float r2 = radius * radius;
+
+    std::uint32_t stack[kStackSize];
+    std::size_t top = 0u;
+    stack[top++] = 0u;
+
+    while (top > 0u) {
+      const std::uint32_t id = stack[--top];
+      const Node& node = m_nodes[id];
+
+      if (id != 0u && d2(center, node.loose.getNearestPoint(center)) > r2) {
+        continue;
+      }
+
+      for (std::uint32_t item = node.firstItem ; item != kInvalid ; item = m_items[item].next) {
+        if (d2(center, m_items[item].box.getNearestPoint(center)) <= r2) {
+          callback(static_cast<ItemId>(item));
+        }
+      }
+
+      if (node.children != kInvalid) {
+        for (std::uint32_t child = 0u ; child < 4u ; ++child) {
+          stack[top++] = node.children + child;
+        }
+      }
+    }
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  QuadTree<CoordinateType>::inRadius(const Vector2<CoordinateType>& center,
+                                     float radius,
+                                     std::vector<ItemId>& out) const
+  {
+    forEachInRadius(
+      center,
+      radius,
+      [&out](ItemId id) {
+        out.push_back(id);
+      }
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  typename QuadTree<CoordinateType>::Node
+  QuadTree<CoordinateType>::makeNode(const Bounds<CoordinateType>& cell,
+                                     std::uint32_t parent,
+                                     std::uint32_t depth) const noexcept
+  {
+    // Items have their center in the cell and may extend up to half a
+    // cell outside of it.
+    const CoordinateType hw = cell.w() / CoordinateType(2);
+    const CoordinateType hh = cell.h() / CoordinateType(2);
+
+    return Node{
+      cell,
+      Bounds<CoordinateType>(
+        cell.getLeftBound() - hw,
+        cell.getBottomBound() - hh,
+        cell.getRightBound() + hw,
+        cell.getTopBound() + hh
+      ),
+      parent,
+      kInvalid,
+      kInvalid,
+      0u,
+      depth
+    };
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  QuadTree<CoordinateType>::fitsIn(const Box<CoordinateType>& box,
+                                   const Node& node) const noexcept
+  {
+    return
+      node.cell.contains(box.getCenter()) &&
+      node.loose.contains(Bounds<CoordinateType>(box))
+    ;
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::uint32_t
+  QuadTree<CoordinateType>::childFor(const Node& node, const Box<CoordinateType>& box) const noexcept {
+    const Vector2<CoordinateType> mid = node.cell.getCenter();
+
+    return
+      node.children +
+      (box.x() >= mid.x() ? 1u : 0u) +
+      (box.y() >= mid.y() ? 2u : 0u)
+    ;
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::uint32_t
+  QuadTree<CoordinateType>::findNode(const Box<CoordinateType>& box) const noexcept {
+    std::uint32_t node = 0u;
+    if (!fitsIn(box, m_nodes[node])) {
+      return node;
+    }
+
+    while (m_nodes[node].children != kInvalid) {
+      const std::uint32_t child = childFor(m_nodes[node], box);
+      if (!fitsIn(box, m_nodes[child])) {
+        break;
+      }
+
+      node = child;
+    }
+
+    return node;
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  QuadTree<CoordinateType>::link(std::uint32_t item, std::uint32_t node) noexcept {
+    Node& n = m_nodes[node];
+    Item& i = m_items[item];
+
+    i.node = node;
+    i.prev = kInvalid;
+    i.next = n.firstItem;
+
+    if (n.firstItem != kInvalid) {
+      m_items[n.firstItem].prev = item;
+    }
+
+    n.firstItem = item;
+    ++n.count;
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  QuadTree<CoordinateType>::unlink(std::uint32_t item) noexcept {
+    Item& i = m_items[item];
+    Node& n = m_nodes[i.node];
+
+    if (i.prev != kInvalid) {
+      m_items[i.prev].next = i.next;
+    }
+    else {
+      n.firstItem = i.next;
+    }
+
+    if (i.next != kInvalid) {
+      m_items[i.next].prev = i.prev;
+    }
+
+    i.prev = kInvalid;
+    i.next = kInvalid;
+    --n.count;
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  QuadTree<CoordinateType>::split(std::uint32_t node) {
+    // Allocating the children might reallocate the nodes so we can't keep
+    // references across this call.
+    const std::uint32_t children = allocateChildren();
+
+    const Bounds<CoordinateType> cell = m_nodes[node].cell;
+    const Vector2<CoordinateType> mid = cell.getCenter();
+    const std::uint32_t depth = m_nodes[node].depth + 1u;
+
+    for (std::uint32_t child = 0u ; child < 4u ; ++child) {
+      const bool right = (child & 1u) != 0u;
+      const bool top = (child & 2u) != 0u;
+
+      m_nodes[children + child] = makeNode(
+        Bounds<CoordinateType>(
+          right ? mid.x() : cell.getLeftBound(),
+          top ? mid.y() : cell.getBottomBound(),
+          right ? cell.getRightBound() : mid.x(),
+          top ? cell.getTopBound() : mid.y()
+        ),
+        node,
+        depth
+      );
+    }
+
+    m_nodes[node].children = children;
+
+    // Push down the items fitting in one of the children.
+    std::uint32_t item = m_nodes[node].firstItem;
+    while (item != kInvalid) {
+      const std::uint32_t next = m_items[item].next;
+      const Box<CoordinateType>& box = m_items[item].box;
+
+      if (fitsIn(box, m_nodes[node])) {
+        const std::uint32_t child = childFor(m_nodes[node], box);
+        if (fitsIn(box, m_nodes[child])) {
+          unlink(item);
+          link(item, child);
+        }
+      }
+
+      item = next;
+    }
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  QuadTree<CoordinateType>::collapse(std::uint32_t node) noexcept {
+    // Walk up the tree and release the blocks of children which are all
+    // empty leaves.
+    std::uint32_t current = (m_nodes[node].children != kInvalid ? node : m_nodes[node].parent);
+
+    while (current != kInvalid) {
+      const std::uint32_t children = m_nodes[current].children;
+      if (children == kInvalid) {
+        return;
+      }
+
+      for (std::uint32_t child = 0u ; child < 4u ; ++child) {
+        const Node& n = m_nodes[children + child];
+        if (n.children != kInvalid || n.count > 0u) {
+          return;
+        }
+      }
+
+      m_nodes[children].parent = m_freeNodes;
+      m_freeNodes = children;
+      m_nodes[current].children = kInvalid;
+
+      current = m_nodes[current].parent;
+    }
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::uint32_t
+  QuadTree<CoordinateType>::allocateChildren() {
+    if (m_freeNodes != kInvalid) {
+      const std::uint32_t children = m_freeNodes;
+      m_freeNodes = m_nodes[children].parent;
+      return children;
+    }
+
+    const std::uint32_t children = static_cast<std::uint32_t>(m_nodes.size());
+    m_nodes.resize(m_nodes.size() + 4u);
+
+    return children;
+  }
+
+}
+
+#endif    /* QUAD_TREE_HXX */
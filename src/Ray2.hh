@@ -0,0 +1,157 @@
+#ifndef    RAY2_HH
+# define   RAY2_HH
+
+# include <limits>
+# include <cstddef>
+# include <cstdint>
+# include "Box.hh"
+# include "BoxSoA.hh"
+# include "Vector2.hh"
+# include "Segment2.hh"
+
+namespace utils {
+
+  /**
+   * @brief - A ray starting at `origin` and going along `direction`. The
+   *          direction does not need to be normalized: points of the ray
+   *          are described by a parameter `t >= 0` expressed in multiples of
+   *          the direction, see `at`. A ray built from a segment thus covers
+   *          the segment for `t` in `[0; 1]`.
+   *          The inverse of the direction is computed once so that tests
+   *          against boxes (using the slab method) do not need divisions.
+   *          Boxes are considered closed, just like for `Segment2`, but the
+   *          rounding of the inverse means that rays exactly grazing the
+   *          corner of a box might not give the same result as the clipping
+   *          methods of `Segment2`.
+   */
+  template <typename CoordinateType>
+  class Ray2 {
+    public:
+
+      Ray2(const Vector2<CoordinateType>& origin,
+           const Vector2<CoordinateType>& direction) noexcept;
+
+      explicit
+      Ray2(const Segment2<CoordinateType>& segment) noexcept;
+
+      const Vector2<CoordinateType>&
+      origin() const noexcept;
+
+      const Vector2<CoordinateType>&
+      direction() const noexcept;
+
+      /**
+       * @brief - Returns the inverse of each coordinate of the direction.
+       *          A coordinate is infinite if the ray is parallel to the
+       *          corresponding axis.
+       */
+      const Vector2<float>&
+      inverseDirection() const noexcept;
+
+      Vector2<float>
+      at(float t) const noexcept;
+
+      /**
+       * @brief - Determines whether this ray crosses `box` for a parameter
+       *          in `[0; tMax]`.
+       */
+      bool
+      intersects(const Box<CoordinateType>& box,
+                 float tMax = std::numeric_limits<float>::infinity()) const noexcept;
+
+      /**
+       * @brief - Computes the range of parameters for which this ray is in
+       *          `box` using the slab method.
+       * @param box - the box to intersect with this ray.
+       * @param tEnter - output argument receiving the parameter at which the
+       *                 ray enters the box (`0` if the origin is inside).
+       * @param tExit - output argument receiving the parameter at which the
+       *                ray leaves the box (at most `tMax`).
+       * @param tMax - the largest parameter to consider.
+       * @return - `true` if the ray crosses the box, in which case
+       *           `0 <= tEnter <= tExit <= tMax`.
+       */
+      bool
+      intersect(const Box<CoordinateType>& box,
+                float& tEnter,
+                float& tExit,
+                float tMax = std::numeric_limits<float>::infinity()) const noexcept;
+
+      /**
+       * @brief - Similar to `Segment2::intersect` but for a ray: computes the
+       *          parameter of the first point of the ray on `segment`.
+       */
+      bool
+      intersect(const Segment2<CoordinateType>& segment, float& t) const noexcept;
+
+    private:
+
+      Vector2<CoordinateType> m_origin;
+      Vector2<CoordinateType> m_direction;
+      Vector2<float> m_inverse;
+  };
+
+  using Ray2f = Ray2<float>;
+  using Ray2i = Ray2<int>;
+
+  /**
+   * @brief - Batch version of `Ray2::intersects`: tests `ray` against the
+   *          `count` input boxes. This is typically used for line of sight
+   *          checks by building the ray from a segment and using a `tMax`
+   *          of `1`. For `float` coordinates several boxes are tested at
+   *          once using SSE or AVX when available, with the same results
+   *          as the scalar test.
+   * @param ray - the ray to test against all the boxes.
+   * @param boxes - the boxes to test.
+   * @param count - the number of boxes.
+   * @param outMask - an array of at least `count` values which is set to
+   *                  `1` for boxes crossed by the ray and `0` otherwise.
+   * @param tMax - the largest parameter along the ray to consider.
+   * @param outEnter - an optional array of at least `count` values which
+   *                   receives the parameter at which the ray enters each
+   *                   box, or an infinite value for boxes which are missed.
+   * @return - the number of boxes crossed by the ray.
+   */
+  template <typename CoordinateType>
+  std::size_t
+  intersectsMany(const Ray2<CoordinateType>& ray,
+                 const Box<CoordinateType>* boxes,
+                 std::size_t count,
+                 std::uint8_t* outMask,
+                 float tMax = std::numeric_limits<float>::infinity(),
+                 float* outEnter = nullptr) noexcept;
+
+  /**
+   * @brief - Similar to the other overload but for boxes stored as a
+   *          structure of arrays, which avoids transposing the boxes.
+   */
+  template <typename CoordinateType>
+  std::size_t
+  intersectsMany(const Ray2<CoordinateType>& ray,
+                 const BoxSoA<CoordinateType>& boxes,
+                 std::uint8_t* outMask,
+                 float tMax = std::numeric_limits<float>::infinity(),
+                 float* outEnter = nullptr) noexcept;
+
+  /**
+   * @brief - Determines whether `ray` crosses any of the input boxes for a
+   *          parameter in `[0; tMax]`. Stops at the first box found.
+   */
+  template <typename CoordinateType>
+  bool
+  intersectsAny(const Ray2<CoordinateType>& ray,
+                const Box<CoordinateType>* boxes,
+                std::size_t count,
+                float tMax = std::numeric_limits<float>::infinity()) noexcept;
+
+  template <typename CoordinateType>
+  bool
+  intersectsAny(const Ray2<CoordinateType>& ray,
+                const BoxSoA<CoordinateType>& boxes,
+                float tMax = std::numeric_limits<float>::infinity()) noexcept;
+
+}
+
+# include "Ray2.hxx"
+
+#endif    /* RAY2_HH */
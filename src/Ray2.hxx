@@ -0,0 +1,493 @@
+#ifndef    RAY2_HXX
+# define   RAY2_HXX
+
+# include <cmath>
+# include "Ray2.hh"
+# include "SimdUtils.hh"
+
+namespace utils {
+  namespace details {
+
+    // The slab method intersects the ray with the two slabs bounded by the
+    // borders of the box along each axis. The helpers below mirror the
+    // semantic of the SSE/AVX `min` and `max` instructions so that scalar
+    // and vectorized tests give exactly the same results.
+
+    inline
+    float
+    slabMin(float lhs, float rhs) noexcept {
+      return lhs < rhs ? lhs : rhs;
+    }
+
+    inline
+    float
+    slabMax(float lhs, float rhs) noexcept {
+      return lhs > rhs ? lhs : rhs;
+    }
+
+    /**
+     * @brief - Restricts `[tEnter; tExit]` to the parameters for which the
+     *          ray is within `[low; high]` along a single axis. When the ray
+     *          is parallel to the axis (`inverse` is infinite) the range is
+     *          left untouched and the origin is checked instead.
+     * @return - `false` if the ray is parallel to and outside of the slab.
+     */
+    inline
+    bool
+    raySlab(float origin,
+            float inverse,
+            float low,
+            float high,
+            float& tEnter,
+            float& tExit) noexcept
+    {
+      if (std::isinf(inverse)) {
+        return low <= origin && origin <= high;
+      }
+
+      const float t1 = (low - origin) * inverse;
+      const float t2 = (high - origin) * inverse;
+
+      tEnter = slabMax(tEnter, slabMin(t1, t2));
+      tExit = slabMin(tExit, slabMax(t1, t2));
+
+      return true;
+    }
+
+    template <typename T>
+    inline
+    bool
+    rayBounds(const Ray2<T>& ray,
+              float left,
+              float right,
+              float bottom,
+              float top,
+              float tMax,
+              float& tEnter,
+              float& tExit) noexcept
+    {
+      tEnter = 0.0f;
+      tExit = tMax;
+
+      const bool inX = raySlab(static_cast<float>(ray.origin().x()), ray.inverseDirection().x(), left, right, tEnter, tExit);
+      const bool inY = raySlab(static_cast<float>(ray.origin().y()), ray.inverseDirection().y(), bottom, top, tEnter, tExit);
+
+      return inX && inY && tEnter <= tExit;
+    }
+
+    /**
+     * @brief - Tests the ray against the boxes in `[start; count[` whose
+     *          bounds are provided by `bounds(id, left, right, bottom, top)`.
+     *          When `Any` is `true` the outputs are not written and the
+     *          process stops at the first box crossed by the ray.
+     */
+    template <bool Any, typename T, typename BoundsAccessor>
+    inline
+    std::size_t
+    rayBoundsScalar(const Ray2<T>& ray,
+                    BoundsAccessor bounds,
+                    std::size_t start,
+                    std::size_t count,
+                    float tMax,
+                    std::uint8_t* outMask,
+                    float* outEnter) noexcept
+    {
+      std::size_t hits = 0u;
+
+      for (std::size_t id = start ; id < count ; ++id) {
+        float l, r, b, t;
+        bounds(id, l, r, b, t);
+
+        float tEnter, tExit;
+        const bool hit = rayBounds(ray, l, r, b, t, tMax, tEnter, tExit);
+
+        if (Any) {
+          if (hit) {
+            return 1u;
+          }
+          continue;
+        }
+
+        outMask[id] = hit ? 1u : 0u;
+        if (outEnter != nullptr) {
+          outEnter[id] = hit ? tEnter : std::numeric_limits<float>::infinity();
+        }
+        hits += (hit ? 1u : 0u);
+      }
+
+      return hits;
+    }
+
+    template <bool Any, typename T>
+    inline
+    std::size_t
+    rayBoxesKernel(const Ray2<T>& ray,
+                   const Box<T>* boxes,
+                   std::size_t count,
+                   float tMax,
+                   std::uint8_t* outMask,
+                   float* outEnter) noexcept
+    {
+      const auto bounds = [boxes](std::size_t id, float& l, float& r, float& b, float& t) {
+        l = static_cast<float>(boxes[id].getLeftBound());
+        r = static_cast<float>(boxes[id].getRightBound());
+        b = static_cast<float>(boxes[id].getBottomBound());
+        t = static_cast<float>(boxes[id].getTopBound());
+      };
+
+      return rayBoundsScalar<Any>(ray, bounds, 0u, count, tMax, outMask, outEnter);
+    }
+
+    template <bool Any, typename T>
+    inline
+    std::size_t
+    raySoAKernel(const Ray2<T>& ray,
+                 const BoxSoA<T>& boxes,
+                 float tMax,
+                 std::uint8_t* outMask,
+                 float* outEnter) noexcept
+    {
+      const auto bounds = [&boxes](std::size_t id, float& l, float& r, float& b, float& t) {
+        l = static_cast<float>(boxes.left()[id]);
+        r = static_cast<float>(boxes.right()[id]);
+        b = static_cast<float>(boxes.bottom()[id]);
+        t = static_cast<float>(boxes.top()[id]);
+      };
+
+      return rayBoundsScalar<Any>(ray, bounds, 0u, boxes.size(), tMax, outMask, outEnter);
+    }
+
+# if defined(MATHS_UTILS_SIMD)
+
+    /**
+     * @brief - Vectorized version of `rayBounds`: the ray is broadcast once
+     *          and tested against `kFloatWidth` boxes at a time.
+     */
+    class RayPack {
+      public:
+
+        RayPack(const Ray2<float>& ray, float tMax) noexcept:
+          m_ox(simd::broadcast(ray.origin().x())),
+          m_oy(simd::broadcast(ray.origin().y())),
+          m_ix(simd::broadcast(ray.inverseDirection().x())),
+          m_iy(simd::broadcast(ray.inverseDirection().y())),
+          m_tMax(simd::broadcast(tMax)),
+          m_flatX(std::isinf(ray.inverseDirection().x())),
+          m_flatY(std::isinf(ray.inverseDirection().y()))
+        {}
+
+        simd::FloatPack
+        test(simd::FloatPack l,
+             simd::FloatPack r,
+             simd::FloatPack b,
+             simd::FloatPack t,
+             simd::FloatPack& tEnter) const noexcept
+        {
+          tEnter = simd::broadcast(0.0f);
+          simd::FloatPack tExit = m_tMax;
+
+          if (!m_flatX) {
+            slab(m_ox, m_ix, l, r, tEnter, tExit);
+          }
+          if (!m_flatY) {
+            slab(m_oy, m_iy, b, t, tEnter, tExit);
+          }
+
+          simd::FloatPack hits = simd::lessOrEqual(tEnter, tExit);
+
+          // Rays parallel to an axis only cross boxes containing their
+          // origin along this axis.
+          if (m_flatX) {
+            hits = simd::maskAnd(hits, simd::maskAnd(simd::lessOrEqual(l, m_ox), simd::lessOrEqual(m_ox, r)));
+          }
+          if (m_flatY) {
+            hits = simd::maskAnd(hits, simd::maskAnd(simd::lessOrEqual(b, m_oy), simd::lessOrEqual(m_oy, t)));
+          }
+
+          return hits;
+        }
+
+      private:
+
+        static
+        void
+        slab(simd::FloatPack origin,
+             simd::FloatPack inverse,
+             simd::FloatPack low,
+             simd::FloatPack high,
+             simd::FloatPack& tEnter,
+             simd::FloatPack& tExit) noexcept
+        {
+          const simd::FloatPack t1 = simd::mul(simd::sub(low, origin), inverse);
+          const simd::FloatPack t2 = simd::mul(simd::sub(high, origin), inverse);
+
+          tEnter = simd::max(tEnter, simd::min(t1, t2));
+          tExit = simd::min(tExit, simd::max(t1, t2));
+        }
+
+        simd::FloatPack m_ox;
+        simd::FloatPack m_oy;
+        simd::FloatPack m_ix;
+        simd::FloatPack m_iy;
+        simd::FloatPack m_tMax;
+        bool m_flatX;
+        bool m_flatY;
+    };
+
+    /**
+     * @brief - Records the result of a pack of tests in the outputs.
+     * @return - the number of boxes crossed by the ray.
+     */
+    inline
+    std::size_t
+    storeRayHits(simd::FloatPack hits,
+                 simd::FloatPack tEnter,
+                 std::size_t id,
+                 std::uint8_t* outMask,
+                 float* outEnter) noexcept
+    {
+      const int bits = simd::movemask(hits);
+
+      std::size_t count = 0u;
+      for (std::size_t lane = 0u ; lane < simd::kFloatWidth ; ++lane) {
+        const std::uint8_t hit = static_cast<std::uint8_t>((bits >> lane) & 1);
+        outMask[id + lane] = hit;
+        count += hit;
+      }
+
+      if (outEnter != nullptr) {
+        const simd::FloatPack missed = simd::broadcast(std::numeric_limits<float>::infinity());
+        simd::store(outEnter + id, simd::select(hits, tEnter, missed));
+      }
+
+      return count;
+    }
+
+    template <bool Any>
+    inline
+    std::size_t
+    rayBoxesKernel(const Ray2<float>& ray,
+                   const Box<float>* boxes,
+                   std::size_t count,
+                   float tMax,
+                   std::uint8_t* outMask,
+                   float* outEnter) noexcept
+    {
+      // Boxes are made of exactly four floats so that a group of boxes can
+      // be transposed into packs of coordinates.
+      static_assert(sizeof(Box<float>) == 4u * sizeof(float), "Box<float> should be made of exactly four floats");
+
+      const RayPack rays(ray, tMax);
+      const simd::FloatPack half = simd::broadcast(0.5f);
+
+      std::size_t hits = 0u;
+      std::size_t id = 0u;
+      for ( ; id + simd::kFloatWidth <= count ; id += simd::kFloatWidth) {
+        simd::FloatPack x, y, w, h;
+        simd::loadInterleaved4(reinterpret_cast<const float*>(boxes + id), x, y, w, h);
+
+        // Same as `Box::getLeftBound` and similar: halving is exact.
+        const simd::FloatPack hw = simd::mul(w, half);
+        const simd::FloatPack hh = simd::mul(h, half);
+
+        simd::FloatPack tEnter;
+        const simd::FloatPack mask = rays.test(simd::sub(x, hw), simd::add(x, hw), simd::sub(y, hh), simd::add(y, hh), tEnter);
+
+        if (Any) {
+          if (simd::movemask(mask) != 0) {
+            return 1u;
+          }
+          continue;
+        }
+
+        hits += storeRayHits(mask, tEnter, id, outMask, outEnter);
+      }
+
+      const auto bounds = [boxes](std::size_t box, float& l, float& r, float& b, float& t) {
+        l = boxes[box].getLeftBound();
+        r = boxes[box].getRightBound();
+        b = boxes[box].getBottomBound();
+        t = boxes[box].getTopBound();
+      };
+
+      return hits + rayBoundsScalar<Any>(ray, bounds, id, count, tMax, outMask, outEnter);
+    }
+
+    template <bool Any>
+    inline
+    std::size_t
+    raySoAKernel(const Ray2<float>& ray,
+                 const BoxSoA<float>& boxes,
+                 float tMax,
+                 std::uint8_t* outMask,
+                 float* outEnter) noexcept
+    {
+      const RayPack rays(ray, tMax);
+
+      const float* l = boxes.left();
+      const float* r = boxes.right();
+      const float* b = boxes.bottom();
+      const float* t = boxes.top();
+
+      std::size_t hits = 0u;
+      std::size_t id = 0u;
+      for ( ; id + simd::kFloatWidth <= boxes.size() ; id += simd::kFloatWidth) {
+        simd::FloatPack tEnter;
+        const simd::FloatPack mask = rays.test(simd::load(l + id), simd::load(r + id), simd::load(b + id), simd::load(t + id), tEnter);
+
+        if (Any) {
+          if (simd::movemask(mask) != 0) {
+            return 1u;
+          }
+          continue;
+        }
+
+        hits += storeRayHits(mask, tEnter, id, outMask, outEnter);
+      }
+
+      const auto bounds = [l, r, b, t](std::size_t box, float& bl, float& br, float& bb, float& bt) {
+        bl = l[box];
+        br = r[box];
+        bb = b[box];
+        bt = t[box];
+      };
+
+      return hits + rayBoundsScalar<Any>(ray, bounds, id, boxes.size(), tMax, outMask, outEnter);
+    }
+
+# endif
+
+  }
+
+  template <typename CoordinateType>
+  inline
+  Ray2<CoordinateType>::Ray2(const Vector2<CoordinateType>& origin,
+                             const Vector2<CoordinateType>& direction) noexcept:
+    m_origin(origin),
+    m_direction(direction),
+    // Dividing by `0` yields an infinite value which marks the axes the
+    // ray is parallel to.
+    m_inverse(1.0f / static_cast<float>(direction.x()), 1.0f / static_cast<float>(direction.y()))
+  {}
+
+  template <typename CoordinateType>
+  inline
+  Ray2<CoordinateType>::Ray2(const Segment2<CoordinateType>& segment) noexcept:
+    Ray2(segment.start(), segment.direction())
+  {}
+
+  template <typename CoordinateType>
+  inline
+  const Vector2<CoordinateType>&
+  Ray2<CoordinateType>::origin() const noexcept {
+    return m_origin;
+  }
+
+  template <typename CoordinateType>
+  inline
+  const Vector2<CoordinateType>&
+  Ray2<CoordinateType>::direction() const noexcept {
+    return m_direction;
+  }
+
+  template <typename CoordinateType>
+  inline
+  const Vector2<float>&
+  Ray2<CoordinateType>::inverseDirection() const noexcept {
+    return m_inverse;
+  }
+
+  template <typename CoordinateType>
+  inline
+  Vector2<float>
+  Ray2<CoordinateType>::at(float t) const noexcept {
+    return Vector2<float>(
+      static_cast<float>(m_origin.x()) + t * static_cast<float>(m_direction.x()),
+      static_cast<float>(m_origin.y()) + t * static_cast<float>(m_direction.y())
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Ray2<CoordinateType>::intersects(const Box<CoordinateType>& box, float tMax) const noexcept {
+    float tEnter, tExit;
+    return intersect(box, tEnter, tExit, tMax);
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Ray2<CoordinateType>::intersect(const Box<CoordinateType>& box,
+                                  float& tEnter,
+                                  float& tExit,
+                                  float tMax) const noexcept
+  {
+    return details::rayBounds(
+      *this,
+      static_cast<float>(box.getLeftBound()),
+      static_cast<float>(box.getRightBound()),
+      static_cast<float>(box.getBottomBound()),
+      static_cast<float>(box.getTopBound()),
+      tMax,
+      tEnter,
+      tExit
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Ray2<CoordinateType>::intersect(const Segment2<CoordinateType>& segment, float& t) const noexcept {
+    return details::linesIntersection(m_origin, m_direction, segment.start(), segment.direction(), false, t);
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  intersectsMany(const Ray2<CoordinateType>& ray,
+                 const Box<CoordinateType>* boxes,
+                 std::size_t count,
+                 std::uint8_t* outMask,
+                 float tMax,
+                 float* outEnter) noexcept
+  {
+    return details::rayBoxesKernel<false>(ray, boxes, count, tMax, outMask, outEnter);
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  intersectsMany(const Ray2<CoordinateType>& ray,
+                 const BoxSoA<CoordinateType>& boxes,
+                 std::uint8_t* outMask,
+                 float tMax,
+                 float* outEnter) noexcept
+  {
+    return details::raySoAKernel<false>(ray, boxes, tMax, outMask, outEnter);
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  intersectsAny(const Ray2<CoordinateType>& ray,
+                const Box<CoordinateType>* boxes,
+                std::size_t count,
+                float tMax) noexcept
+  {
+    return details::rayBoxesKernel<true>(ray, boxes, count, tMax, nullptr, nullptr) != 0u;
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  intersectsAny(const Ray2<CoordinateType>& ray,
+                const BoxSoA<CoordinateType>& boxes,
+                float tMax) noexcept
+  {
+    return details::raySoAKernel<true>(ray, boxes, tMax, nullptr, nullptr) != 0u;
+  }
+
+}
+
+#endif    /* RAY2_HXX */
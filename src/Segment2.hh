@@ -0,0 +1,135 @@
+#ifndef    SEGMENT2_HH
+# define   SEGMENT2_HH
+
+# include <vector>
+# include <cstddef>
+# include "Box.hh"
+# include "Vector2.hh"
+
+namespace utils {
+
+  /**
+   * @brief - A segment joining `start` to `end`. Points of the segment are
+   *          described by a parameter `t` in `[0; 1]`: `0` maps to `start`
+   *          and `1` to `end`, see `at`. Parameters are always expressed as
+   *          `float` values, even for integer coordinates.
+   *          Boxes are considered closed: a segment touching the border of
+   *          a box intersects it.
+   */
+  template <typename CoordinateType>
+  class Segment2 {
+    public:
+
+      constexpr
+      Segment2(const Vector2<CoordinateType>& start,
+               const Vector2<CoordinateType>& end) noexcept;
+
+      constexpr const Vector2<CoordinateType>&
+      start() const noexcept;
+
+      constexpr const Vector2<CoordinateType>&
+      end() const noexcept;
+
+      /**
+       * @brief - Returns the vector going from `start` to `end`.
+       */
+      constexpr Vector2<CoordinateType>
+      direction() const noexcept;
+
+      CoordinateType
+      length() const noexcept;
+
+      /**
+       * @brief - Returns the point of the segment at parameter `t`.
+       */
+      Vector2<float>
+      at(float t) const noexcept;
+
+      bool
+      intersects(const Segment2<CoordinateType>& other) const noexcept;
+
+      /**
+       * @brief - Computes the first point of this segment which also belongs
+       *          to `other`. When both segments are collinear and overlap
+       *          this is the beginning of the overlap. Integer coordinates
+       *          are handled exactly.
+       * @param other - the segment to intersect with this one.
+       * @param t - output argument receiving the parameter of the first
+       *            common point along this segment. Only set if there is an
+       *            intersection.
+       * @return - `true` if both segments intersect.
+       */
+      bool
+      intersect(const Segment2<CoordinateType>& other, float& t) const noexcept;
+
+      /**
+       * @brief - Determines whether this segment crosses `box`. Segments with
+       *          both ends on the same outer side of the box (Cohen-Sutherland
+       *          outcodes) or with an end inside it are handled without any
+       *          division, the others are clipped against the box.
+       */
+      bool
+      intersects(const Box<CoordinateType>& box) const noexcept;
+
+      /**
+       * @brief - Clips this segment against `box` using the Liang-Barsky
+       *          algorithm.
+       * @param box - the box to clip the segment with.
+       * @param tEnter - output argument receiving the parameter at which the
+       *                 segment enters the box.
+       * @param tExit - output argument receiving the parameter at which the
+       *                segment leaves the box.
+       * @return - `true` if a part of the segment is inside the box, in which
+       *           case `0 <= tEnter <= tExit <= 1`.
+       */
+      bool
+      clip(const Box<CoordinateType>& box, float& tEnter, float& tExit) const noexcept;
+
+      /**
+       * @brief - Similar to the other `clip` method but produces the part of
+       *          the segment inside `box`. Integer coordinates are rounded to
+       *          the closest value, which keeps them inside the box.
+       * @param box - the box to clip the segment with.
+       * @param out - output argument receiving the clipped segment. Only set
+       *              if the segment crosses the box.
+       * @return - `true` if a part of the segment is inside the box.
+       */
+      bool
+      clip(const Box<CoordinateType>& box, Segment2<CoordinateType>& out) const noexcept;
+
+    private:
+
+      Vector2<CoordinateType> m_start;
+      Vector2<CoordinateType> m_end;
+  };
+
+  using Segment2f = Segment2<float>;
+  using Segment2i = Segment2<int>;
+
+  /**
+   * @brief - Clips the polygon described by the input vertices against `box`
+   *          using the Sutherland-Hodgman algorithm. The polygon is closed,
+   *          i.e. the last vertex is joined to the first one, and is expected
+   *          to be convex: clipping a concave polygon might produce
+   *          degenerate edges along the borders of the box.
+   *          Integer coordinates are rounded just like in `Segment2::clip`.
+   * @param vertices - the vertices of the polygon.
+   * @param count - the number of vertices.
+   * @param box - the box to clip the polygon with.
+   * @param out - output argument receiving the vertices of the clipped
+   *              polygon. It is cleared first.
+   * @return - the number of vertices of the clipped polygon, `0` if the
+   *           polygon does not cross the box.
+   */
+  template <typename CoordinateType>
+  std::size_t
+  clipPolygon(const Vector2<CoordinateType>* vertices,
+              std::size_t count,
+              const Box<CoordinateType>& box,
+              std::vector<Vector2<CoordinateType>>& out);
+
+}
+
+# include "Segment2.hxx"
+
+#endif    /* SEGMENT2_HH */
@@ -0,0 +1,381 @@
+#ifndef    SEGMENT2_HXX
+# define   SEGMENT2_HXX
+
+# include <cmath>
+# include <cstdint>
+# include <type_traits>
+# include "Segment2.hh"
+
+namespace utils {
+  namespace details {
+
+    /**
+     * @brief - The type used to compute products of coordinates without
+     *          overflowing, which keeps intersection tests on integers exact.
+     */
+    template <typename T>
+    using WideType = typename std::conditional<std::is_integral<T>::value, std::int64_t, T>::type;
+
+    /**
+     * @brief - Converts a coordinate computed from a parameter back to the
+     *          coordinate type, rounding to the closest integer if needed.
+     */
+    template <typename T>
+    inline
+    T
+    fromParameter(float value) noexcept {
+      if constexpr (std::is_integral<T>::value) {
+        return static_cast<T>(std::lround(value));
+      }
+      else {
+        return static_cast<T>(value);
+      }
+    }
+
+    /**
+     * @brief - Intersects the line `p + t * r` with the segment going from
+     *          `q` to `q + s`. The parameter `t` is restricted to `[0; 1]`
+     *          when `bounded` is `true` (the line is a segment) and to
+     *          `[0; +inf[` otherwise (the line is a ray).
+     *          All the tests are performed on the numerators and the common
+     *          denominator so that only the output parameter is divided.
+     */
+    template <typename T>
+    inline
+    bool
+    linesIntersection(const Vector2<T>& p,
+                      const Vector2<T>& r,
+                      const Vector2<T>& q,
+                      const Vector2<T>& s,
+                      bool bounded,
+                      float& t) noexcept
+    {
+      using Wide = WideType<T>;
+
+      const Wide rx = r.x(), ry = r.y();
+      const Wide sx = s.x(), sy = s.y();
+      const Wide wx = Wide(q.x()) - Wide(p.x());
+      const Wide wy = Wide(q.y()) - Wide(p.y());
+
+      Wide denom = rx * sy - ry * sx;
+      Wide tn = wx * sy - wy * sx;
+      Wide un = wx * ry - wy * rx;
+
+      if (denom != Wide(0)) {
+        if (denom < Wide(0)) {
+          denom = -denom;
+          tn = -tn;
+          un = -un;
+        }
+
+        if (tn < Wide(0) || (bounded && tn > denom) || un < Wide(0) || un > denom) {
+          return false;
+        }
+
+        t = static_cast<float>(tn) / static_cast<float>(denom);
+        return true;
+      }
+
+      const Wide rr = rx * rx + ry * ry;
+      const Wide ss = sx * sx + sy * sy;
+
+      if (rr == Wide(0)) {
+        // `p` is a single point: it should lie on the other segment.
+        if (ss == Wide(0)) {
+          if (wx != Wide(0) || wy != Wide(0)) {
+            return false;
+          }
+
+          t = 0.0f;
+          return true;
+        }
+
+        const Wide d = -(wx * sx + wy * sy);
+        if (wx * sy - wy * sx != Wide(0) || d < Wide(0) || d > ss) {
+          return false;
+        }
+
+        t = 0.0f;
+        return true;
+      }
+
+      // Parallel lines only intersect when they are the same.
+      if (un != Wide(0)) {
+        return false;
+      }
+
+      // Project the other segment on the line: both ends are expressed as
+      // multiples of `rr`.
+      const Wide t0 = wx * rx + wy * ry;
+      const Wide t1 = t0 + sx * rx + sy * ry;
+      const Wide lo = (t0 < t1 ? t0 : t1);
+      const Wide hi = (t0 < t1 ? t1 : t0);
+
+      if (hi < Wide(0) || (bounded && lo > rr)) {
+        return false;
+      }
+
+      t = (lo < Wide(0) ? 0.0f : static_cast<float>(lo) / static_cast<float>(rr));
+      return true;
+    }
+
+    /**
+     * @brief - Cohen-Sutherland outcode of a point relatively to a box: each
+     *          bit is set if the point is outside the corresponding border.
+     */
+    template <typename T>
+    inline
+    unsigned
+    outcode(const Vector2<T>& p, T left, T right, T bottom, T top) noexcept {
+      return
+        (p.x() < left ? 1u : 0u) |
+        (p.x() > right ? 2u : 0u) |
+        (p.y() < bottom ? 4u : 0u) |
+        (p.y() > top ? 8u : 0u)
+      ;
+    }
+
+    /**
+     * @brief - Liang-Barsky update of the parametric range `[t0; t1]` for a
+     *          single border: `p` is the projection of the direction on the
+     *          inward normal of the border (negated) and `q` the distance of
+     *          the origin to the border.
+     * @return - `false` if the range is empty.
+     */
+    inline
+    bool
+    clipBorder(float p, float q, float& t0, float& t1) noexcept {
+      if (p == 0.0f) {
+        return q >= 0.0f;
+      }
+
+      const float r = q / p;
+      if (p < 0.0f) {
+        if (r > t1) {
+          return false;
+        }
+        if (r > t0) {
+          t0 = r;
+        }
+      }
+      else {
+        if (r < t0) {
+          return false;
+        }
+        if (r < t1) {
+          t1 = r;
+        }
+      }
+
+      return true;
+    }
+
+    template <typename T>
+    inline
+    bool
+    liangBarsky(const Vector2<T>& start,
+                const Vector2<T>& end,
+                const Box<T>& box,
+                float& t0,
+                float& t1) noexcept
+    {
+      const float x = static_cast<float>(start.x());
+      const float y = static_cast<float>(start.y());
+      const float dx = static_cast<float>(end.x()) - x;
+      const float dy = static_cast<float>(end.y()) - y;
+
+      t0 = 0.0f;
+      t1 = 1.0f;
+
+      return
+        clipBorder(-dx, x - static_cast<float>(box.getLeftBound()), t0, t1) &&
+        clipBorder(dx, static_cast<float>(box.getRightBound()) - x, t0, t1) &&
+        clipBorder(-dy, y - static_cast<float>(box.getBottomBound()), t0, t1) &&
+        clipBorder(dy, static_cast<float>(box.getTopBound()) - y, t0, t1)
+      ;
+    }
+
+    /**
+     * @brief - Clips the polygon `in` against a single border of a box in
+     *          the Sutherland-Hodgman algorithm. The border is the line of
+     *          equation `x = bound` (or `y = bound` when `Vertical` is false)
+     *          and points are kept on the side of larger (or smaller when
+     *          `Lower` is false) values.
+     */
+    template <bool Vertical, bool Lower, typename T>
+    inline
+    void
+    clipPolygonBorder(const std::vector<Vector2<T>>& in,
+                      T bound,
+                      std::vector<Vector2<T>>& out)
+    {
+      out.clear();
+
+      const auto coord = [](const Vector2<T>& p) -> const T& { return Vertical ? p.x() : p.y(); };
+      const auto other = [](const Vector2<T>& p) -> const T& { return Vertical ? p.y() : p.x(); };
+      const auto inside = [&](const Vector2<T>& p) { return Lower ? coord(p) >= bound : coord(p) <= bound; };
+
+      const auto crossing = [&](const Vector2<T>& a, const Vector2<T>& b) {
+        const float t = (static_cast<float>(bound) - static_cast<float>(coord(a))) / (static_cast<float>(coord(b)) - static_cast<float>(coord(a)));
+        const T o = fromParameter<T>(static_cast<float>(other(a)) + t * (static_cast<float>(other(b)) - static_cast<float>(other(a))));
+        return (Vertical ? Vector2<T>(bound, o) : Vector2<T>(o, bound));
+      };
+
+      for (std::size_t id = 0u ; id < in.size() ; ++id) {
+        const Vector2<T>& prev = in[id == 0u ? in.size() - 1u : id - 1u];
+        const Vector2<T>& cur = in[id];
+
+        const bool prevIn = inside(prev);
+        const bool curIn = inside(cur);
+
+        if (curIn != prevIn) {
+          out.push_back(crossing(prev, cur));
+        }
+        if (curIn) {
+          out.push_back(cur);
+        }
+      }
+    }
+
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr
+  Segment2<CoordinateType>::Segment2(const Vector2<CoordinateType>& start,
+                                     const Vector2<CoordinateType>& end) noexcept:
+    m_start(start),
+    m_end(end)
+  {}
+
+  template <typename CoordinateType>
+  inline
+  constexpr const Vector2<CoordinateType>&
+  Segment2<CoordinateType>::start() const noexcept {
+    return m_start;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr const Vector2<CoordinateType>&
+  Segment2<CoordinateType>::end() const noexcept {
+    return m_end;
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr Vector2<CoordinateType>
+  Segment2<CoordinateType>::direction() const noexcept {
+    return m_end - m_start;
+  }
+
+  template <typename CoordinateType>
+  inline
+  CoordinateType
+  Segment2<CoordinateType>::length() const noexcept {
+    return direction().length();
+  }
+
+  template <typename CoordinateType>
+  inline
+  Vector2<float>
+  Segment2<CoordinateType>::at(float t) const noexcept {
+    const float x = static_cast<float>(m_start.x());
+    const float y = static_cast<float>(m_start.y());
+
+    return Vector2<float>(
+      x + t * (static_cast<float>(m_end.x()) - x),
+      y + t * (static_cast<float>(m_end.y()) - y)
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Segment2<CoordinateType>::intersects(const Segment2<CoordinateType>& other) const noexcept {
+    float t;
+    return intersect(other, t);
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Segment2<CoordinateType>::intersect(const Segment2<CoordinateType>& other, float& t) const noexcept {
+    return details::linesIntersection(m_start, direction(), other.m_start, other.direction(), true, t);
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Segment2<CoordinateType>::intersects(const Box<CoordinateType>& box) const noexcept {
+    const CoordinateType l = box.getLeftBound();
+    const CoordinateType r = box.getRightBound();
+    const CoordinateType b = box.getBottomBound();
+    const CoordinateType t = box.getTopBound();
+
+    const unsigned code1 = details::outcode(m_start, l, r, b, t);
+    const unsigned code2 = details::outcode(m_end, l, r, b, t);
+
+    if ((code1 & code2) != 0u) {
+      return false;
+    }
+    if (code1 == 0u || code2 == 0u) {
+      return true;
+    }
+
+    float t0, t1;
+    return details::liangBarsky(m_start, m_end, box, t0, t1);
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Segment2<CoordinateType>::clip(const Box<CoordinateType>& box, float& tEnter, float& tExit) const noexcept {
+    return details::liangBarsky(m_start, m_end, box, tEnter, tExit);
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Segment2<CoordinateType>::clip(const Box<CoordinateType>& box, Segment2<CoordinateType>& out) const noexcept {
+    float t0, t1;
+    if (!details::liangBarsky(m_start, m_end, box, t0, t1)) {
+      return false;
+    }
+
+    // Ends which are not clipped are kept as is to avoid rounding errors.
+    const Vector2<float> s = at(t0);
+    const Vector2<float> e = at(t1);
+
+    out = Segment2<CoordinateType>(
+      t0 == 0.0f ? m_start : Vector2<CoordinateType>(details::fromParameter<CoordinateType>(s.x()), details::fromParameter<CoordinateType>(s.y())),
+      t1 == 1.0f ? m_end : Vector2<CoordinateType>(details::fromParameter<CoordinateType>(e.x()), details::fromParameter<CoordinateType>(e.y()))
+    );
+
+    return true;
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  clipPolygon(const Vector2<CoordinateType>* vertices,
+              std::size_t count,
+              const Box<CoordinateType>& box,
+              std::vector<Vector2<CoordinateType>>& out)
+  {
+    std::vector<Vector2<CoordinateType>> current(vertices, vertices + count);
+    out.clear();
+
+    details::clipPolygonBorder<true, true>(current, box.getLeftBound(), out);
+    details::clipPolygonBorder<true, false>(out, box.getRightBound(), current);
+    details::clipPolygonBorder<false, true>(current, box.getBottomBound(), out);
+    details::clipPolygonBorder<false, false>(out, box.getTopBound(), current);
+
+    out.swap(current);
+
+    return out.size();
+  }
+
+}
+
+#endif    /* SEGMENT2_HXX */
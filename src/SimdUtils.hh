@@ -0,0 +1,276 @@
+#ifndef    SIMD_UTILS_HH
+# define   SIMD_UTILS_HH
+
+# include <cstddef>
+
+// Select the widest instruction set available for the current
+// compilation flags. Code relying on these helpers should always
+// provide a scalar path for the remaining elements or when none
+// of the instruction sets is available.
+# if defined(__AVX__)
+#  if defined(__AVX2__)
+#   define MATHS_UTILS_SIMD_AVX2
+#  endif
+#  define MATHS_UTILS_SIMD_AVX
+#  define MATHS_UTILS_SIMD
+#  include <immintrin.h>
+# elif defined(__SSE2__) || defined(_M_X64)
+#  define MATHS_UTILS_SIMD_SSE
+#  define MATHS_UTILS_SIMD
+#  include <emmintrin.h>
+# endif
+
+// Bit manipulation instructions are not tied to the vector ones and
+// are only used for scalar code.
+# if defined(__BMI2__)
+#  define MATHS_UTILS_BMI2
+#  include <immintrin.h>
+# endif
+
+namespace utils {
+  namespace simd {
+
+    /**
+     * @brief - Maps a scalar type to the pack processing it so that kernels
+     *          can be written once for all supported coordinate types. Only
+     *          specialized for the types handled by the available instruction
+     *          set: kernels should check `supported` before using it.
+     */
+    template <typename DataType>
+    struct Pack {
+      static constexpr bool supported = false;
+    };
+
+# if defined(MATHS_UTILS_SIMD)
+
+    /**
+     * @brief - A pack of `kFloatWidth` single precision values processed
+     *          at once by the available instruction set.
+     */
+#  if defined(MATHS_UTILS_SIMD_AVX)
+    using FloatPack = __m256;
+    constexpr std::size_t kFloatWidth = 8u;
+#  else
+    using FloatPack = __m128;
+    constexpr std::size_t kFloatWidth = 4u;
+#  endif
+
+    /**
+     * @brief - Similar to `FloatPack` but for 32 bits integers. Integer
+     *          operations on 256 bits registers require AVX2.
+     */
+#  if defined(MATHS_UTILS_SIMD_AVX2)
+    using IntPack = __m256i;
+    constexpr std::size_t kIntWidth = 8u;
+#  else
+    using IntPack = __m128i;
+    constexpr std::size_t kIntWidth = 4u;
+#  endif
+
+    template <>
+    struct Pack<float> {
+      static constexpr bool supported = true;
+      using Type = FloatPack;
+      static constexpr std::size_t width = kFloatWidth;
+    };
+
+    template <>
+    struct Pack<int> {
+      static constexpr bool supported = true;
+      using Type = IntPack;
+      static constexpr std::size_t width = kIntWidth;
+    };
+
+    /**
+     * @brief - Loads `kFloatWidth` values from `ptr` which does not need
+     *          to be aligned.
+     */
+    FloatPack
+    load(const float* ptr) noexcept;
+
+    /**
+     * @brief - Stores the values of `pack` to `ptr` which does not need
+     *          to be aligned.
+     */
+    void
+    store(float* ptr, FloatPack pack) noexcept;
+
+    /**
+     * @brief - Creates a pack where all lanes are set to `value`.
+     */
+    FloatPack
+    broadcast(float value) noexcept;
+
+    FloatPack
+    add(FloatPack lhs, FloatPack rhs) noexcept;
+
+    FloatPack
+    sub(FloatPack lhs, FloatPack rhs) noexcept;
+
+    FloatPack
+    mul(FloatPack lhs, FloatPack rhs) noexcept;
+
+    FloatPack
+    div(FloatPack lhs, FloatPack rhs) noexcept;
+
+    FloatPack
+    sqrt(FloatPack pack) noexcept;
+
+    FloatPack
+    min(FloatPack lhs, FloatPack rhs) noexcept;
+
+    FloatPack
+    max(FloatPack lhs, FloatPack rhs) noexcept;
+
+    /**
+     * @brief - Lane-wise comparisons: each lane of the result has all its
+     *          bits set if the comparison holds and is zero otherwise.
+     */
+    FloatPack
+    lessThan(FloatPack lhs, FloatPack rhs) noexcept;
+
+    FloatPack
+    lessOrEqual(FloatPack lhs, FloatPack rhs) noexcept;
+
+    FloatPack
+    maskAnd(FloatPack lhs, FloatPack rhs) noexcept;
+
+    FloatPack
+    maskOr(FloatPack lhs, FloatPack rhs) noexcept;
+
+    /**
+     * @brief - Picks for each lane the value of `ifTrue` when the lane of
+     *          `mask` is set and the value of `ifFalse` otherwise.
+     */
+    FloatPack
+    select(FloatPack mask, FloatPack ifTrue, FloatPack ifFalse) noexcept;
+
+    /**
+     * @brief - Gathers the most significant bit of each lane of `mask` in
+     *          the low bits of an integer: lane `i` maps to bit `i`.
+     */
+    int
+    movemask(FloatPack mask) noexcept;
+
+    /**
+     * @brief - Loads `kFloatWidth` pairs of interleaved values (such as the
+     *          coordinates of consecutive 2D points) starting at `ptr` and
+     *          splits them into the first and second value of each pair.
+     */
+    void
+    loadInterleaved(const float* ptr, FloatPack& first, FloatPack& second) noexcept;
+
+    /**
+     * @brief - The reverse operation of `loadInterleaved`: writes the lanes
+     *          of `first` and `second` as `kFloatWidth` consecutive pairs.
+     */
+    void
+    storeInterleaved(float* ptr, FloatPack first, FloatPack second) noexcept;
+
+    /**
+     * @brief - Similar to `loadInterleaved` but for `kFloatWidth` groups of
+     *          four values (such as the coordinates and dimensions of boxes).
+     */
+    void
+    loadInterleaved4(const float* ptr,
+                     FloatPack& first,
+                     FloatPack& second,
+                     FloatPack& third,
+                     FloatPack& fourth) noexcept;
+
+    IntPack
+    load(const int* ptr) noexcept;
+
+    void
+    store(int* ptr, IntPack pack) noexcept;
+
+    IntPack
+    broadcast(int value) noexcept;
+
+    IntPack
+    add(IntPack lhs, IntPack rhs) noexcept;
+
+    IntPack
+    sub(IntPack lhs, IntPack rhs) noexcept;
+
+    IntPack
+    min(IntPack lhs, IntPack rhs) noexcept;
+
+    IntPack
+    max(IntPack lhs, IntPack rhs) noexcept;
+
+    IntPack
+    lessThan(IntPack lhs, IntPack rhs) noexcept;
+
+    IntPack
+    lessOrEqual(IntPack lhs, IntPack rhs) noexcept;
+
+    IntPack
+    maskAnd(IntPack lhs, IntPack rhs) noexcept;
+
+    IntPack
+    maskOr(IntPack lhs, IntPack rhs) noexcept;
+
+    int
+    movemask(IntPack mask) noexcept;
+
+    /**
+     * @brief - A pack of four single precision values, whatever the widest
+     *          instruction set is. Used by types which fit a single 128 bits
+     *          register such as a 3D vector with a padding lane.
+     */
+    using Float4 = __m128;
+
+    /**
+     * @brief - Loads four values from `ptr` which must be aligned on a
+     *          16 bytes boundary.
+     */
+    Float4
+    load4(const float* ptr) noexcept;
+
+    /**
+     * @brief - Stores four values to `ptr` which must be aligned on a
+     *          16 bytes boundary.
+     */
+    void
+    store4(float* ptr, Float4 pack) noexcept;
+
+    Float4
+    broadcast4(float value) noexcept;
+
+    Float4
+    add4(Float4 lhs, Float4 rhs) noexcept;
+
+    Float4
+    sub4(Float4 lhs, Float4 rhs) noexcept;
+
+    Float4
+    mul4(Float4 lhs, Float4 rhs) noexcept;
+
+    Float4
+    div4(Float4 lhs, Float4 rhs) noexcept;
+
+    /**
+     * @brief - Computes the dot product of the first three lanes of `lhs`
+     *          and `rhs`: the fourth lane is ignored. The sum is evaluated
+     *          in the same order as `x1 * x2 + y1 * y2 + z1 * z2`.
+     */
+    float
+    dot3(Float4 lhs, Float4 rhs) noexcept;
+
+    /**
+     * @brief - Computes the cross product of the 3D vectors held in the
+     *          first three lanes of `lhs` and `rhs`. The fourth lane of the
+     *          result is `0` as long as the inputs are finite.
+     */
+    Float4
+    cross3(Float4 lhs, Float4 rhs) noexcept;
+
+# endif
+
+  }
+}
+
+# include "SimdUtils.hxx"
+
+#endif    /* SIMD_UTILS_HH */
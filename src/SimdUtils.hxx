@@ -0,0 +1,532 @@
+#ifndef    SIMD_UTILS_HXX
+# define   SIMD_UTILS_HXX
+
+# include "SimdUtils.hh"
+
+namespace utils {
+  namespace simd {
+
+# if defined(MATHS_UTILS_SIMD_AVX)
+
+    inline
+    FloatPack
+    load(const float* ptr) noexcept {
+      return _mm256_loadu_ps(ptr);
+    }
+
+    inline
+    void
+    store(float* ptr, FloatPack pack) noexcept {
+      _mm256_storeu_ps(ptr, pack);
+    }
+
+    inline
+    FloatPack
+    broadcast(float value) noexcept {
+      return _mm256_set1_ps(value);
+    }
+
+    inline
+    FloatPack
+    add(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm256_add_ps(lhs, rhs);
+    }
+
+    inline
+    FloatPack
+    sub(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm256_sub_ps(lhs, rhs);
+    }
+
+    inline
+    FloatPack
+    mul(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm256_mul_ps(lhs, rhs);
+    }
+
+    inline
+    FloatPack
+    div(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm256_div_ps(lhs, rhs);
+    }
+
+    inline
+    FloatPack
+    sqrt(FloatPack pack) noexcept {
+      return _mm256_sqrt_ps(pack);
+    }
+
+    inline
+    FloatPack
+    min(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm256_min_ps(lhs, rhs);
+    }
+
+    inline
+    FloatPack
+    max(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm256_max_ps(lhs, rhs);
+    }
+
+    inline
+    FloatPack
+    lessThan(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ);
+    }
+
+    inline
+    FloatPack
+    lessOrEqual(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm256_cmp_ps(lhs, rhs, _CMP_LE_OQ);
+    }
+
+    inline
+    FloatPack
+    maskAnd(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm256_and_ps(lhs, rhs);
+    }
+
+    inline
+    FloatPack
+    maskOr(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm256_or_ps(lhs, rhs);
+    }
+
+    inline
+    FloatPack
+    select(FloatPack mask, FloatPack ifTrue, FloatPack ifFalse) noexcept {
+      return _mm256_blendv_ps(ifFalse, ifTrue, mask);
+    }
+
+    inline
+    int
+    movemask(FloatPack mask) noexcept {
+      return _mm256_movemask_ps(mask);
+    }
+
+    inline
+    void
+    loadInterleaved(const float* ptr, FloatPack& first, FloatPack& second) noexcept {
+      const __m256 a = _mm256_loadu_ps(ptr);
+      const __m256 b = _mm256_loadu_ps(ptr + 8u);
+
+      // Gather pairs `0-1` and `4-5` in a single register and pairs `2-3`
+      // and `6-7` in another one so that shuffles within each 128 bits lane
+      // produce the values in order.
+      const __m256 lo = _mm256_permute2f128_ps(a, b, 0x20);
+      const __m256 hi = _mm256_permute2f128_ps(a, b, 0x31);
+
+      first = _mm256_shuffle_ps(lo, hi, 0x88);
+      second = _mm256_shuffle_ps(lo, hi, 0xDD);
+    }
+
+    inline
+    void
+    storeInterleaved(float* ptr, FloatPack first, FloatPack second) noexcept {
+      const __m256 lo = _mm256_unpacklo_ps(first, second);
+      const __m256 hi = _mm256_unpackhi_ps(first, second);
+
+      _mm256_storeu_ps(ptr, _mm256_permute2f128_ps(lo, hi, 0x20));
+      _mm256_storeu_ps(ptr + 8u, _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+
+    inline
+    void
+    loadInterleaved4(const float* ptr,
+                     FloatPack& first,
+                     FloatPack& second,
+                     FloatPack& third,
+                     FloatPack& fourth) noexcept
+    {
+      const __m256 a = _mm256_loadu_ps(ptr);
+      const __m256 b = _mm256_loadu_ps(ptr + 8u);
+      const __m256 c = _mm256_loadu_ps(ptr + 16u);
+      const __m256 d = _mm256_loadu_ps(ptr + 24u);
+
+      // Put groups `0` to `3` in the low 128 bits lanes and groups `4` to
+      // `7` in the high ones: each lane is then transposed independently.
+      const __m256 g04 = _mm256_permute2f128_ps(a, c, 0x20);
+      const __m256 g15 = _mm256_permute2f128_ps(a, c, 0x31);
+      const __m256 g26 = _mm256_permute2f128_ps(b, d, 0x20);
+      const __m256 g37 = _mm256_permute2f128_ps(b, d, 0x31);
+
+      const __m256 lo01 = _mm256_unpacklo_ps(g04, g15);
+      const __m256 lo23 = _mm256_unpacklo_ps(g26, g37);
+      const __m256 hi01 = _mm256_unpackhi_ps(g04, g15);
+      const __m256 hi23 = _mm256_unpackhi_ps(g26, g37);
+
+      first = _mm256_shuffle_ps(lo01, lo23, 0x44);
+      second = _mm256_shuffle_ps(lo01, lo23, 0xEE);
+      third = _mm256_shuffle_ps(hi01, hi23, 0x44);
+      fourth = _mm256_shuffle_ps(hi01, hi23, 0xEE);
+    }
+
+# elif defined(MATHS_UTILS_SIMD_SSE)
+
+    inline
+    FloatPack
+    load(const float* ptr) noexcept {
+      return _mm_loadu_ps(ptr);
+    }
+
+    inline
+    void
+    store(float* ptr, FloatPack pack) noexcept {
+      _mm_storeu_ps(ptr, pack);
+    }
+
+    inline
+    FloatPack
+    broadcast(float value) noexcept {
+      return _mm_set1_ps(value);
+    }
+
+    inline
+    FloatPack
+    add(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm_add_ps(lhs, rhs);
+    }
+
+    inline
+    FloatPack
+    sub(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm_sub_ps(lhs, rhs);
+    }
+
+    inline
+    FloatPack
+    mul(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm_mul_ps(lhs, rhs);
+    }
+
+    inline
+    FloatPack
+    div(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm_div_ps(lhs, rhs);
+    }
+
+    inline
+    FloatPack
+    sqrt(FloatPack pack) noexcept {
+      return _mm_sqrt_ps(pack);
+    }
+
+    inline
+    FloatPack
+    min(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm_min_ps(lhs, rhs);
+    }
+
+    inline
+    FloatPack
+    max(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm_max_ps(lhs, rhs);
+    }
+
+    inline
+    FloatPack
+    lessThan(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm_cmplt_ps(lhs, rhs);
+    }
+
+    inline
+    FloatPack
+    lessOrEqual(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm_cmple_ps(lhs, rhs);
+    }
+
+    inline
+    FloatPack
+    maskAnd(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm_and_ps(lhs, rhs);
+    }
+
+    inline
+    FloatPack
+    maskOr(FloatPack lhs, FloatPack rhs) noexcept {
+      return _mm_or_ps(lhs, rhs);
+    }
+
+    inline
+    FloatPack
+    select(FloatPack mask, FloatPack ifTrue, FloatPack ifFalse) noexcept {
+      // No blend instruction before SSE4.1.
+      return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+    }
+
+    inline
+    int
+    movemask(FloatPack mask) noexcept {
+      return _mm_movemask_ps(mask);
+    }
+
+    inline
+    void
+    loadInterleaved(const float* ptr, FloatPack& first, FloatPack& second) noexcept {
+      const __m128 a = _mm_loadu_ps(ptr);
+      const __m128 b = _mm_loadu_ps(ptr + 4u);
+
+      first = _mm_shuffle_ps(a, b, 0x88);
+      second = _mm_shuffle_ps(a, b, 0xDD);
+    }
+
+    inline
+    void
+    storeInterleaved(float* ptr, FloatPack first, FloatPack second) noexcept {
+      _mm_storeu_ps(ptr, _mm_unpacklo_ps(first, second));
+      _mm_storeu_ps(ptr + 4u, _mm_unpackhi_ps(first, second));
+    }
+
+    inline
+    void
+    loadInterleaved4(const float* ptr,
+                     FloatPack& first,
+                     FloatPack& second,
+                     FloatPack& third,
+                     FloatPack& fourth) noexcept
+    {
+      const __m128 a = _mm_loadu_ps(ptr);
+      const __m128 b = _mm_loadu_ps(ptr + 4u);
+      const __m128 c = _mm_loadu_ps(ptr + 8u);
+      const __m128 d = _mm_loadu_ps(ptr + 12u);
+
+      const __m128 lo01 = _mm_unpacklo_ps(a, b);
+      const __m128 lo23 = _mm_unpacklo_ps(c, d);
+      const __m128 hi01 = _mm_unpackhi_ps(a, b);
+      const __m128 hi23 = _mm_unpackhi_ps(c, d);
+
+      first = _mm_movelh_ps(lo01, lo23);
+      second = _mm_movehl_ps(lo23, lo01);
+      third = _mm_movelh_ps(hi01, hi23);
+      fourth = _mm_movehl_ps(hi23, hi01);
+    }
+
+# endif
+
+# if defined(MATHS_UTILS_SIMD_AVX2)
+
+    inline
+    IntPack
+    load(const int* ptr) noexcept {
+      return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+    }
+
+    inline
+    void
+    store(int* ptr, IntPack pack) noexcept {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), pack);
+    }
+
+    inline
+    IntPack
+    broadcast(int value) noexcept {
+      return _mm256_set1_epi32(value);
+    }
+
+    inline
+    IntPack
+    add(IntPack lhs, IntPack rhs) noexcept {
+      return _mm256_add_epi32(lhs, rhs);
+    }
+
+    inline
+    IntPack
+    sub(IntPack lhs, IntPack rhs) noexcept {
+      return _mm256_sub_epi32(lhs, rhs);
+    }
+
+    inline
+    IntPack
+    min(IntPack lhs, IntPack rhs) noexcept {
+      return _mm256_min_epi32(lhs, rhs);
+    }
+
+    inline
+    IntPack
+    max(IntPack lhs, IntPack rhs) noexcept {
+      return _mm256_max_epi32(lhs, rhs);
+    }
+
+    inline
+    IntPack
+    lessThan(IntPack lhs, IntPack rhs) noexcept {
+      return _mm256_cmpgt_epi32(rhs, lhs);
+    }
+
+    inline
+    IntPack
+    lessOrEqual(IntPack lhs, IntPack rhs) noexcept {
+      return _mm256_xor_si256(_mm256_cmpgt_epi32(lhs, rhs), _mm256_set1_epi32(-1));
+    }
+
+    inline
+    IntPack
+    maskAnd(IntPack lhs, IntPack rhs) noexcept {
+      return _mm256_and_si256(lhs, rhs);
+    }
+
+    inline
+    IntPack
+    maskOr(IntPack lhs, IntPack rhs) noexcept {
+      return _mm256_or_si256(lhs, rhs);
+    }
+
+    inline
+    int
+    movemask(IntPack mask) noexcept {
+      return _mm256_movemask_ps(_mm256_castsi256_ps(mask));
+    }
+
+# elif defined(MATHS_UTILS_SIMD)
+
+    inline
+    IntPack
+    load(const int* ptr) noexcept {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+    }
+
+    inline
+    void
+    store(int* ptr, IntPack pack) noexcept {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), pack);
+    }
+
+    inline
+    IntPack
+    broadcast(int value) noexcept {
+      return _mm_set1_epi32(value);
+    }
+
+    inline
+    IntPack
+    add(IntPack lhs, IntPack rhs) noexcept {
+      return _mm_add_epi32(lhs, rhs);
+    }
+
+    inline
+    IntPack
+    sub(IntPack lhs, IntPack rhs) noexcept {
+      return _mm_sub_epi32(lhs, rhs);
+    }
+
+    inline
+    IntPack
+    min(IntPack lhs, IntPack rhs) noexcept {
+      // No `_mm_min_epi32` before SSE4.1.
+      const IntPack lower = _mm_cmplt_epi32(lhs, rhs);
+      return _mm_or_si128(_mm_and_si128(lower, lhs), _mm_andnot_si128(lower, rhs));
+    }
+
+    inline
+    IntPack
+    max(IntPack lhs, IntPack rhs) noexcept {
+      const IntPack greater = _mm_cmpgt_epi32(lhs, rhs);
+      return _mm_or_si128(_mm_and_si128(greater, lhs), _mm_andnot_si128(greater, rhs));
+    }
+
+    inline
+    IntPack
+    lessThan(IntPack lhs, IntPack rhs) noexcept {
+      return _mm_cmplt_epi32(lhs, rhs);
+    }
+
+    inline
+    IntPack
+    lessOrEqual(IntPack lhs, IntPack rhs) noexcept {
+      return _mm_xor_si128(_mm_cmpgt_epi32(lhs, rhs), _mm_set1_epi32(-1));
+    }
+
+    inline
+    IntPack
+    maskAnd(IntPack lhs, IntPack rhs) noexcept {
+      return _mm_and_si128(lhs, rhs);
+    }
+
+    inline
+    IntPack
+    maskOr(IntPack lhs, IntPack rhs) noexcept {
+      return _mm_or_si128(lhs, rhs);
+    }
+
+    inline
+    int
+    movemask(IntPack mask) noexcept {
+      return _mm_movemask_ps(_mm_castsi128_ps(mask));
+    }
+
+# endif
+
+# if defined(MATHS_UTILS_SIMD)
+
+    inline
+    Float4
+    load4(const float* ptr) noexcept {
+      return _mm_load_ps(ptr);
+    }
+
+    inline
+    void
+    store4(float* ptr, Float4 pack) noexcept {
+      _mm_store_ps(ptr, pack);
+    }
+
+    inline
+    Float4
+    broadcast4(float value) noexcept {
+      return _mm_set1_ps(value);
+    }
+
+    inline
+    Float4
+    add4(Float4 lhs, Float4 rhs) noexcept {
+      return _mm_add_ps(lhs, rhs);
+    }
+
+    inline
+    Float4
+    sub4(Float4 lhs, Float4 rhs) noexcept {
+      return _mm_sub_ps(lhs, rhs);
+    }
+
+    inline
+    Float4
+    mul4(Float4 lhs, Float4 rhs) noexcept {
+      return _mm_mul_ps(lhs, rhs);
+    }
+
+    inline
+    Float4
+    div4(Float4 lhs, Float4 rhs) noexcept {
+      return _mm_div_ps(lhs, rhs);
+    }
+
+    inline
+    float
+    dot3(Float4 lhs, Float4 rhs) noexcept {
+      // Bring each of the first three products in the low lane so that
+      // they are summed in the same order as the scalar version.
+      const __m128 prod = _mm_mul_ps(lhs, rhs);
+      const __m128 y = _mm_shuffle_ps(prod, prod, _MM_SHUFFLE(1, 1, 1, 1));
+      const __m128 z = _mm_movehl_ps(prod, prod);
+
+      return _mm_cvtss_f32(_mm_add_ss(_mm_add_ss(prod, y), z));
+    }
+
+    inline
+    Float4
+    cross3(Float4 lhs, Float4 rhs) noexcept {
+      // Computes `(lhs * rhs.yzx - lhs.yzx * rhs).yzx` which only needs
+      // three shuffles instead of four.
+      const __m128 lYZX = _mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 0, 2, 1));
+      const __m128 rYZX = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 0, 2, 1));
+      const __m128 zxy = _mm_sub_ps(_mm_mul_ps(lhs, rYZX), _mm_mul_ps(lYZX, rhs));
+
+      return _mm_shuffle_ps(zxy, zxy, _MM_SHUFFLE(3, 0, 2, 1));
+    }
+
+# endif
+
+  }
+}
+
+#endif    /* SIMD_UTILS_HXX */
@@ -1,7 +1,10 @@
 #ifndef    SIZE_HH
 # define   SIZE_HH
 
+# include <string>
+# include <cstdint>
 # include <iostream>
+# include "PrimitiveLayout.hh"
 # include "Vector2.hh"
 
 namespace utils {
@@ -10,68 +13,89 @@ namespace utils {
   class Size {
     public:
 
-      explicit
+      explicit constexpr
       Size(const DimsType& width = DimsType(),
-            const DimsType& height = DimsType());
+            const DimsType& height = DimsType()) noexcept;
 
       ~Size() = default;
 
-      bool
+      constexpr bool
       operator==(const Size& rhs) const noexcept;
 
-      bool
+      constexpr bool
       operator!=(const Size& rhs) const noexcept;
 
-      Size
+      /**
+       * @brief - Compares this size with `rhs` using the `Comparison` policy
+       *          (see `ComparisonUtils.hh`) for both dimensions. `operator==`
+       *          uses the `DefaultComparison` of the type.
+       */
+      template <typename Comparison>
+      constexpr bool
+      equals(const Size& rhs) const noexcept;
+
+      constexpr Size
       operator+(const Size& rhs) const noexcept;
 
-      Size
+      constexpr Size
       operator-(const Size& rhs) const noexcept;
 
-      Size
+      constexpr Size
       operator*(float scale) const noexcept;
 
-      bool
+      constexpr bool
       valid() const noexcept;
 
-      bool
+      constexpr bool
       compareWithTolerance(const Size& rhs,
                            const DimsType& tolerance) const noexcept;
 
-      DimsType&
+      constexpr DimsType&
       w() noexcept;
 
-      const DimsType&
+      constexpr const DimsType&
       w() const noexcept;
 
-      DimsType&
+      constexpr DimsType&
       h() noexcept;
 
-      const DimsType&
+      constexpr const DimsType&
       h() const noexcept;
 
-      bool
+      constexpr bool
       isEmpty() const noexcept;
 
-      bool
+      constexpr bool
       isNull() const noexcept;
 
-      bool
+      constexpr bool
       isValid() const noexcept;
 
-      void
+      constexpr void
       transpose() noexcept;
 
-      DimsType
+      constexpr DimsType
       area() const noexcept;
 
       static
-      Size
+      constexpr Size
       max() noexcept;
 
       std::string
       toString() const noexcept;
 
+      std::size_t
+      format(char* buffer, std::size_t size) const noexcept;
+
+      std::size_t
+      encode(std::uint8_t* buffer, std::size_t size) const noexcept;
+
+      static
+      std::size_t
+      decode(const std::uint8_t* buffer, std::size_t size, Size<DimsType>& out) noexcept;
+
+      static constexpr std::size_t kEncodedSize = 2u * sizeof(DimsType);
+
       /**
        * @brief - Transforms this size into a new size where dimensions have the specified type.
        *          Note that overflow is possible or more generally the chosen type might not be
@@ -79,7 +103,7 @@ namespace utils {
        * @return - a new box whith coordinates of the specified type.
        */
       template <typename OtherDimsType>
-      Size<OtherDimsType>
+      constexpr Size<OtherDimsType>
       toType() const;
 
       /**
@@ -89,7 +113,7 @@ namespace utils {
        * @return - true if both the `w` and `h` dimension of `this` are larger than `other` and
        *           false otherwise.
        */
-      bool
+      constexpr bool
       contains(const Size<DimsType>& other) const noexcept;
 
       /**
@@ -98,7 +122,7 @@ namespace utils {
        * @return - a size with dimensions corresponding to the coordinates of the input vector.
        */
       static
-      Size<DimsType>
+      constexpr Size<DimsType>
       fromVector(const Vector2<DimsType>& vec) noexcept;
 
     private:
@@ -111,6 +135,9 @@ namespace utils {
   using Sizef = Size<float>;
   using Sizei = Size<int>;
 
+  static_assert(isFlatPrimitive<Sizef, float, 2u>, "Sizef should be made of exactly two floats");
+  static_assert(isFlatPrimitive<Sizei, int, 2u>, "Sizei should be made of exactly two ints");
+
 }
 
 template <typename DimsType>
@@ -122,7 +149,7 @@ std::ostream&
 operator<<(const utils::Size<DimsType>& size, std::ostream& out) noexcept;
 
 template <typename DimsType>
-utils::Size<DimsType>
+constexpr utils::Size<DimsType>
 operator*(float scale, const utils::Size<DimsType>& size) noexcept;
 
 # include "Size.hxx"
@@ -2,64 +2,96 @@
 # define   SIZE_HXX
 
 # include <limits>
+# include <type_traits>
 # include "Size.hh"
 # include "ComparisonUtils.hh"
+# include "FormatUtils.hh"
 
 namespace utils {
+  namespace details {
+
+    /**
+     * @brief - Scales a dimension by `factor`. Arithmetic values are simply
+     *          multiplied so that `double` keeps its precision, while other
+     *          types (such as fixed point values) can't be multiplied by a
+     *          floating point value and are converted to `double` first.
+     */
+    template <typename DimsType>
+    inline
+    constexpr DimsType
+    scaleDimension(const DimsType& value, float factor) noexcept {
+      if constexpr (std::is_arithmetic<DimsType>::value) {
+        return static_cast<DimsType>(value * factor);
+      }
+      else {
+        return static_cast<DimsType>(static_cast<double>(value) * factor);
+      }
+    }
+
+  }
 
   template <typename DimsType>
   inline
+  constexpr
   Size<DimsType>::Size(const DimsType& width,
-                       const DimsType& height):
+                       const DimsType& height) noexcept:
     m_w(width),
     m_h(height)
   {}
 
   template <typename DimsType>
   inline
-  bool
+  constexpr bool
   Size<DimsType>::operator==(const Size& rhs) const noexcept {
-    return fuzzyEqual(m_w, rhs.m_w) && fuzzyEqual(m_h, rhs.m_h);
+    return equals<typename DefaultComparison<DimsType>::Type>(rhs);
   }
 
   template <typename DimsType>
   inline
-  bool
+  constexpr bool
   Size<DimsType>::operator!=(const Size& rhs) const noexcept {
     return !operator==(rhs);
   }
 
+  template <typename DimsType>
+  template <typename Comparison>
+  inline
+  constexpr bool
+  Size<DimsType>::equals(const Size& rhs) const noexcept {
+    return Comparison::equal(m_w, rhs.m_w) && Comparison::equal(m_h, rhs.m_h);
+  }
+
   template <typename DimsType>
   inline
-  Size<DimsType>
+  constexpr Size<DimsType>
   Size<DimsType>::operator+(const Size& rhs) const noexcept {
     return Size(m_w + rhs.m_w, m_h + rhs.m_h);
   }
 
   template <typename DimsType>
   inline
-  Size<DimsType>
+  constexpr Size<DimsType>
   Size<DimsType>::operator-(const Size& rhs) const noexcept {
     return Size(m_w - rhs.m_w, m_h - rhs.m_h);
   }
 
   template <typename DimsType>
   inline
-  Size<DimsType>
+  constexpr Size<DimsType>
   Size<DimsType>::operator*(float scale) const noexcept {
-    return Size(m_w * scale, m_h * scale);
+    return Size(details::scaleDimension(m_w, scale), details::scaleDimension(m_h, scale));
   }
 
   template <typename CoordinateType>
   inline
-  bool
+  constexpr bool
   Size<CoordinateType>::valid() const noexcept {
     return m_w != CoordinateType() && m_h != CoordinateType();
   }
 
   template <typename DimsType>
   inline
-  bool
+  constexpr bool
   Size<DimsType>::compareWithTolerance(const Size& rhs,
                                        const DimsType& tolerance) const noexcept
   {
@@ -70,55 +102,57 @@ namespace utils {
   }
 
   template <typename DimsType>
-  DimsType&
+  inline
+  constexpr DimsType&
   Size<DimsType>::w() noexcept {
     return m_w;
   }
 
   template <typename DimsType>
   inline
-  const DimsType&
+  constexpr const DimsType&
   Size<DimsType>::w() const noexcept {
     return m_w;
   }
 
   template <typename DimsType>
-  DimsType&
+  inline
+  constexpr DimsType&
   Size<DimsType>::h() noexcept {
     return m_h;
   }
 
   template <typename DimsType>
   inline
-  const DimsType&
+  constexpr const DimsType&
   Size<DimsType>::h() const noexcept {
     return m_h;
   }
 
   template <typename DimsType>
   inline
-  bool
+  constexpr bool
   Size<DimsType>::isEmpty() const noexcept {
     return m_w == DimsType() || m_h == DimsType();
   }
 
   template <typename DimsType>
   inline
-  bool
+  constexpr bool
   Size<DimsType>::isNull() const noexcept {
     return m_w == DimsType() && m_h == DimsType();
   }
 
   template <typename DimsType>
   inline
-  bool
+  constexpr bool
   Size<DimsType>::isValid() const noexcept {
     return !isEmpty();
   }
 
   template <typename DimsType>
   inline
-  void
+  constexpr void
   Size<DimsType>::transpose() noexcept {
     const DimsType save = m_w;
     m_w = m_h;
@@ -127,14 +161,14 @@ namespace utils {
 
   template <typename DimsType>
   inline
-  DimsType
+  constexpr DimsType
   Size<DimsType>::area() const noexcept {
     return m_w * m_h;
   }
 
   template <typename DimsType>
   inline
-  Size<DimsType>
+  constexpr Size<DimsType>
   Size<DimsType>::max() noexcept {
     return Size(
       std::numeric_limits<DimsType>::max(),
@@ -146,13 +180,59 @@ namespace utils {
   inline
   std::string
   Size<DimsType>::toString() const noexcept {
-    return std::string("[Size: ") + std::to_string(w()) + "x" + std::to_string(h()) + "]";
+    char buffer[formatBufferSize<DimsType>(2u)];
+    return std::string(buffer, format(buffer, sizeof(buffer)));
+  }
+
+  template <typename DimsType>
+  inline
+  std::size_t
+  Size<DimsType>::format(char* buffer, std::size_t size) const noexcept {
+    FormatWriter writer(buffer, size);
+
+    writer.appendText("[Size: ");
+    writer.appendValue(m_w);
+    writer.appendText("x");
+    writer.appendValue(m_h);
+    writer.appendText("]");
+
+    return writer.size();
+  }
+
+  template <typename DimsType>
+  inline
+  std::size_t
+  Size<DimsType>::encode(std::uint8_t* buffer, std::size_t size) const noexcept {
+    if (size < kEncodedSize) {
+      return 0u;
+    }
+
+    encodeLittleEndian(buffer, m_w);
+    encodeLittleEndian(buffer + sizeof(DimsType), m_h);
+
+    return kEncodedSize;
+  }
+
+  template <typename DimsType>
+  inline
+  std::size_t
+  Size<DimsType>::decode(const std::uint8_t* buffer, std::size_t size, Size<DimsType>& out) noexcept {
+    if (size < kEncodedSize) {
+      return 0u;
+    }
+
+    out = Size<DimsType>(
+      decodeLittleEndian<DimsType>(buffer),
+      decodeLittleEndian<DimsType>(buffer + sizeof(DimsType))
+    );
+
+    return kEncodedSize;
   }
 
   template <typename DimsType>
   template <typename OtherDimsType>
   inline
-  Size<OtherDimsType>
+  constexpr Size<OtherDimsType>
   Size<DimsType>::toType() const {
     return Size<OtherDimsType>(
       static_cast<OtherDimsType>(m_w),
@@ -161,14 +241,15 @@ namespace utils {
   }
 
   template <typename DimsType>
-  bool
+  inline
+  constexpr bool
   Size<DimsType>::contains(const Size<DimsType>& other) const noexcept {
     return m_w >= other.m_w && m_h >= other.m_h;
   }
 
   template <typename DimsType>
   inline
-  Size<DimsType>
+  constexpr Size<DimsType>
   Size<DimsType>::fromVector(const Vector2<DimsType>& vec) noexcept {
     return Size<DimsType>(vec.x(), vec.y());
   }
@@ -179,7 +260,8 @@ template <typename DimsType>
 inline
 std::ostream&
 operator<<(std::ostream& out, const utils::Size<DimsType>& size) noexcept {
-  out << size.toString();
+  char buffer[utils::formatBufferSize<DimsType>(2u)];
+  out.write(buffer, static_cast<std::streamsize>(size.format(buffer, sizeof(buffer))));
   return out;
 }
 
@@ -192,7 +274,7 @@ operator<<(const utils::Size<DimsType>& size, std::ostream& out) noexcept {
 
 template <typename DimsType>
 inline
-utils::Size<DimsType>
+constexpr utils::Size<DimsType>
 operator*(float scale, const utils::Size<DimsType>& size) noexcept {
   return size * scale;
 }
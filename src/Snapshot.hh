@@ -0,0 +1,186 @@
+#ifndef    SNAPSHOT_HH
+# define   SNAPSHOT_HH
+
+# include <string>
+# include <vector>
+# include <cstddef>
+# include <cstdint>
+# include <iostream>
+# include "Box.hh"
+# include "Size.hh"
+# include "Bounds.hh"
+# include "Vector2.hh"
+
+namespace utils {
+
+  /**
+   * @brief - Describes the binary snapshot format used to persist arrays of
+   *          primitives. A snapshot is made of a header of `kSnapshotDataOffset`
+   *          bytes followed by the elements stored contiguously with exactly
+   *          the in-memory layout of the primitive. All values are little
+   *          endian so that on such hosts (i.e. virtually all of them) a
+   *          snapshot can be mapped in memory and used in place.
+   *          The header is laid out as follows:
+   *            - `[0; 4[`: the magic `MUSN`.
+   *            - `[4; 6[`: the version of the format.
+   *            - `6`: the kind of primitive, see `SnapshotElement`.
+   *            - `7`: the type of the coordinates, see `SnapshotScalar`.
+   *            - `[8; 12[`: the size in bytes of a single element.
+   *            - `[12; 16[`: the offset of the first element in the file.
+   *            - `[16; 24[`: the number of elements.
+   *          The rest of the header is zero.
+   */
+  constexpr std::uint16_t kSnapshotVersion = 1u;
+  constexpr std::size_t kSnapshotDataOffset = 64u;
+
+  enum class SnapshotElement: std::uint8_t {
+    Vector2 = 1u,
+    Size = 2u,
+    Box = 3u,
+    Bounds = 4u
+  };
+
+  enum class SnapshotScalar: std::uint8_t {
+    Float32 = 1u,
+    Int32 = 2u
+  };
+
+  struct SnapshotHeader {
+    std::uint16_t version;
+    SnapshotElement element;
+    SnapshotScalar scalar;
+    std::uint32_t elementSize;
+    std::uint32_t dataOffset;
+    std::uint64_t count;
+  };
+
+  /**
+   * @brief - Decodes and validates the header of a snapshot expected to hold
+   *          elements of type `Primitive`.
+   * @param data - the bytes of the snapshot.
+   * @param size - the number of bytes available in `data`.
+   * @param header - output argument receiving the decoded header.
+   * @return - `true` if the header is valid and describes `Primitive`
+   *           elements. Whether `data` actually holds all the elements is
+   *           not checked.
+   */
+  template <typename Primitive>
+  bool
+  readSnapshotHeader(const std::uint8_t* data,
+                     std::size_t size,
+                     SnapshotHeader& header) noexcept;
+
+  /**
+   * @brief - Writes a snapshot of the `count` input elements to `out`.
+   * @param out - the stream to write to, which should be opened in binary mode.
+   * @param elements - the elements to save.
+   * @param count - the number of elements.
+   * @return - `true` if the snapshot was successfully written.
+   */
+  template <typename Primitive>
+  bool
+  writeSnapshot(std::ostream& out,
+                const Primitive* elements,
+                std::size_t count);
+
+  template <typename Primitive>
+  bool
+  writeSnapshot(std::ostream& out,
+                const std::vector<Primitive>& elements);
+
+  /**
+   * @brief - Reads a snapshot from `in` into `elements`. Unlike the in place
+   *          views this works whatever the endianness of the host.
+   * @param in - the stream to read from, which should be opened in binary mode.
+   * @param elements - output argument receiving the elements.
+   * @return - `true` if a valid snapshot of `Primitive` was read.
+   */
+  template <typename Primitive>
+  bool
+  readSnapshot(std::istream& in,
+               std::vector<Primitive>& elements);
+
+  /**
+   * @brief - A read-only view on the elements of a snapshot held in memory,
+   *          usually a mapped file (see `MappedSnapshot`). Nothing is copied:
+   *          the elements are used in place. A view is only valid when the
+   *          snapshot is valid, the host is little endian and the elements
+   *          are correctly aligned.
+   */
+  template <typename Primitive>
+  class SnapshotView {
+    public:
+
+      SnapshotView() noexcept;
+
+      SnapshotView(const void* data, std::size_t size) noexcept;
+
+      bool
+      valid() const noexcept;
+
+      std::size_t
+      size() const noexcept;
+
+      bool
+      empty() const noexcept;
+
+      const Primitive*
+      data() const noexcept;
+
+      const Primitive*
+      begin() const noexcept;
+
+      const Primitive*
+      end() const noexcept;
+
+      const Primitive&
+      operator[](std::size_t id) const noexcept;
+
+    private:
+
+      const Primitive* m_elements;
+      std::size_t m_count;
+      bool m_valid;
+  };
+
+  /**
+   * @brief - Maps a snapshot file in memory and exposes its elements in place
+   *          through a `SnapshotView`. The mapping is released when this
+   *          object is destroyed. Only available on POSIX systems.
+   */
+  template <typename Primitive>
+  class MappedSnapshot {
+    public:
+
+      explicit
+      MappedSnapshot(const std::string& path) noexcept;
+
+      ~MappedSnapshot();
+
+      MappedSnapshot(const MappedSnapshot&) = delete;
+
+      MappedSnapshot&
+      operator=(const MappedSnapshot&) = delete;
+
+      bool
+      valid() const noexcept;
+
+      const SnapshotView<Primitive>&
+      view() const noexcept;
+
+    private:
+
+      void* m_mapping;
+      std::size_t m_size;
+      SnapshotView<Primitive> m_view;
+  };
+
+  using BoxfSnapshotView = SnapshotView<Boxf>;
+  using Vector2fSnapshotView = SnapshotView<Vector2f>;
+  using SizefSnapshotView = SnapshotView<Sizef>;
+
+}
+
+# include "Snapshot.hxx"
+
+#endif    /* SNAPSHOT_HH */
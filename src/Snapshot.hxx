@@ -0,0 +1,402 @@
+#ifndef    SNAPSHOT_HXX
+# define   SNAPSHOT_HXX
+
+# include <cstring>
+# include <algorithm>
+# include <type_traits>
+# include "Snapshot.hh"
+# include "FormatUtils.hh"
+
+# if defined(__unix__) || defined(__APPLE__)
+#  define MATHS_UTILS_SNAPSHOT_MMAP
+#  include <fcntl.h>
+#  include <unistd.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+# endif
+
+namespace utils {
+  namespace details {
+
+# if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    constexpr bool kHostLittleEndian = false;
+# else
+    constexpr bool kHostLittleEndian = true;
+# endif
+
+    constexpr char kSnapshotMagic[4] = {'M', 'U', 'S', 'N'};
+
+    template <typename ScalarType>
+    struct SnapshotScalarOf;
+
+    template <>
+    struct SnapshotScalarOf<float> {
+      static_assert(sizeof(float) == 4u, "Snapshots store 32 bits floating point values");
+      static constexpr SnapshotScalar value = SnapshotScalar::Float32;
+    };
+
+    template <>
+    struct SnapshotScalarOf<int> {
+      static_assert(sizeof(int) == 4u, "Snapshots store 32 bits integer values");
+      static constexpr SnapshotScalar value = SnapshotScalar::Int32;
+    };
+
+    template <typename Primitive>
+    struct SnapshotTraits;
+
+    template <typename CoordinateType>
+    struct SnapshotTraits<Vector2<CoordinateType>> {
+      using Scalar = CoordinateType;
+      static constexpr SnapshotElement element = SnapshotElement::Vector2;
+      static constexpr std::size_t components = 2u;
+    };
+
+    template <typename DimsType>
+    struct SnapshotTraits<Size<DimsType>> {
+      using Scalar = DimsType;
+      static constexpr SnapshotElement element = SnapshotElement::Size;
+      static constexpr std::size_t components = 2u;
+    };
+
+    template <typename CoordinateType>
+    struct SnapshotTraits<Box<CoordinateType>> {
+      using Scalar = CoordinateType;
+      static constexpr SnapshotElement element = SnapshotElement::Box;
+      static constexpr std::size_t components = 4u;
+    };
+
+    template <typename CoordinateType>
+    struct SnapshotTraits<Bounds<CoordinateType>> {
+      using Scalar = CoordinateType;
+      static constexpr SnapshotElement element = SnapshotElement::Bounds;
+      static constexpr std::size_t components = 4u;
+    };
+
+    /**
+     * @brief - Checks that a primitive can be written and read back as raw
+     *          bytes: its layout should be exactly the one of its coordinates
+     *          which is also the one produced by its `encode` method.
+     */
+    template <typename Primitive>
+    struct SnapshotLayout {
+      using Traits = SnapshotTraits<Primitive>;
+      using Scalar = typename Traits::Scalar;
+
+      static_assert(std::is_trivially_copyable<Primitive>::value, "Snapshot elements should be trivially copyable");
+      static_assert(std::is_standard_layout<Primitive>::value, "Snapshot elements should have a standard layout");
+      static_assert(sizeof(Primitive) == Traits::components * sizeof(Scalar), "Snapshot elements should not have padding");
+      static_assert(alignof(Primitive) == alignof(Scalar), "Snapshot elements should be aligned as their coordinates");
+      static_assert(Primitive::kEncodedSize == sizeof(Primitive), "Snapshot elements should be encoded with their layout");
+
+      static constexpr bool valid = true;
+    };
+
+    static_assert(SnapshotLayout<Vector2f>::valid, "Invalid layout for Vector2f");
+    static_assert(SnapshotLayout<Vector2i>::valid, "Invalid layout for Vector2i");
+    static_assert(SnapshotLayout<Sizef>::valid, "Invalid layout for Sizef");
+    static_assert(SnapshotLayout<Sizei>::valid, "Invalid layout for Sizei");
+    static_assert(SnapshotLayout<Boxf>::valid, "Invalid layout for Boxf");
+    static_assert(SnapshotLayout<Boxi>::valid, "Invalid layout for Boxi");
+    static_assert(SnapshotLayout<Boundsf>::valid, "Invalid layout for Boundsf");
+    static_assert(SnapshotLayout<Boundsi>::valid, "Invalid layout for Boundsi");
+
+    /**
+     * @brief - The number of elements encoded at once when the host is not
+     *          little endian and elements can't be written as is.
+     */
+    constexpr std::size_t kSnapshotEncodingChunk = 1024u;
+
+    /**
+     * @brief - The number of elements read at once from a stream: the count
+     *          of the header is not trusted before the elements are there.
+     */
+    constexpr std::size_t kSnapshotReadChunk = 65536u;
+
+  }
+
+  template <typename Primitive>
+  inline
+  bool
+  readSnapshotHeader(const std::uint8_t* data,
+                     std::size_t size,
+                     SnapshotHeader& header) noexcept
+  {
+    using Traits = details::SnapshotTraits<Primitive>;
+    static_assert(details::SnapshotLayout<Primitive>::valid, "Invalid snapshot element");
+
+    if (data == nullptr || size < kSnapshotDataOffset) {
+      return false;
+    }
+    if (std::memcmp(data, details::kSnapshotMagic, sizeof(details::kSnapshotMagic)) != 0) {
+      return false;
+    }
+
+    header.version = decodeLittleEndian<std::uint16_t>(data + 4u);
+    header.element = static_cast<SnapshotElement>(data[6u]);
+    header.scalar = static_cast<SnapshotScalar>(data[7u]);
+    header.elementSize = decodeLittleEndian<std::uint32_t>(data + 8u);
+    header.dataOffset = decodeLittleEndian<std::uint32_t>(data + 12u);
+    header.count = decodeLittleEndian<std::uint64_t>(data + 16u);
+
+    return
+      header.version == kSnapshotVersion &&
+      header.element == Traits::element &&
+      header.scalar == details::SnapshotScalarOf<typename Traits::Scalar>::value &&
+      header.elementSize == sizeof(Primitive) &&
+      header.dataOffset >= kSnapshotDataOffset &&
+      header.dataOffset % alignof(Primitive) == 0u
+    ;
+  }
+
+  template <typename Primitive>
+  inline
+  bool
+  writeSnapshot(std::ostream& out,
+                const Primitive* elements,
+                std::size_t count)
+  {
+    using Traits = details::SnapshotTraits<Primitive>;
+    static_assert(details::SnapshotLayout<Primitive>::valid, "Invalid snapshot element");
+
+    std::uint8_t header[kSnapshotDataOffset] = {};
+    std::memcpy(header, details::kSnapshotMagic, sizeof(details::kSnapshotMagic));
+    encodeLittleEndian(header + 4u, kSnapshotVersion);
+    header[6u] = static_cast<std::uint8_t>(Traits::element);
+    header[7u] = static_cast<std::uint8_t>(details::SnapshotScalarOf<typename Traits::Scalar>::value);
+    encodeLittleEndian(header + 8u, static_cast<std::uint32_t>(sizeof(Primitive)));
+    encodeLittleEndian(header + 12u, static_cast<std::uint32_t>(kSnapshotDataOffset));
+    encodeLittleEndian(header + 16u, static_cast<std::uint64_t>(count));
+
+    out.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+    if (details::kHostLittleEndian) {
+      // The layout of the elements is the one of the file.
+      out.write(reinterpret_cast<const char*>(elements), static_cast<std::streamsize>(count * sizeof(Primitive)));
+      return out.good();
+    }
+
+    std::uint8_t chunk[details::kSnapshotEncodingChunk * sizeof(Primitive)];
+    for (std::size_t start = 0u ; start < count && out.good() ; start += details::kSnapshotEncodingChunk) {
+      const std::size_t end = std::min(count, start + details::kSnapshotEncodingChunk);
+
+      std::size_t offset = 0u;
+      for (std::size_t id = start ; id < end ; ++id) {
+        offset += elements[id].encode(chunk + offset, sizeof(chunk) - offset);
+      }
+
+      out.write(reinterpret_cast<const char*>(chunk), static_cast<std::streamsize>(offset));
+    }
+
+    return out.good();
+  }
+
+  template <typename Primitive>
+  inline
+  bool
+  writeSnapshot(std::ostream& out,
+                const std::vector<Primitive>& elements)
+  {
+    return writeSnapshot(out, elements.data(), elements.size());
+  }
+
+  template <typename Primitive>
+  inline
+  bool
+  readSnapshot(std::istream& in,
+               std::vector<Primitive>& elements)
+  {
+    std::uint8_t header[kSnapshotDataOffset];
+    in.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (static_cast<std::size_t>(in.gcount()) != sizeof(header)) {
+      return false;
+    }
+
+    SnapshotHeader desc;
+    if (!readSnapshotHeader<Primitive>(header, sizeof(header), desc)) {
+      return false;
+    }
+
+    // Later versions of the format might have a larger header.
+    in.ignore(static_cast<std::streamsize>(desc.dataOffset - kSnapshotDataOffset));
+    if (!in.good()) {
+      return false;
+    }
+
+    // The stream might not be seekable so its size can't be checked like
+    // in the views: a corrupted count fails on the first short read rather
+    // than allocating all the elements it claims.
+    if (desc.count > elements.max_size()) {
+      return false;
+    }
+
+    const std::size_t count = static_cast<std::size_t>(desc.count);
+    elements.clear();
+    while (elements.size() < count) {
+      const std::size_t start = elements.size();
+      const std::size_t chunk = std::min(count - start, details::kSnapshotReadChunk);
+
+      elements.resize(start + chunk);
+      const std::streamsize bytes = static_cast<std::streamsize>(chunk * sizeof(Primitive));
+      in.read(reinterpret_cast<char*>(elements.data() + start), bytes);
+      if (in.gcount() != bytes) {
+        elements.clear();
+        return false;
+      }
+    }
+
+    if (!details::kHostLittleEndian) {
+      for (Primitive& element : elements) {
+        Primitive::decode(reinterpret_cast<const std::uint8_t*>(&element), sizeof(Primitive), element);
+      }
+    }
+
+    return true;
+  }
+
+  template <typename Primitive>
+  inline
+  SnapshotView<Primitive>::SnapshotView() noexcept:
+    m_elements(nullptr),
+    m_count(0u),
+    m_valid(false)
+  {}
+
+  template <typename Primitive>
+  inline
+  SnapshotView<Primitive>::SnapshotView(const void* data, std::size_t size) noexcept:
+    m_elements(nullptr),
+    m_count(0u),
+    m_valid(false)
+  {
+    if (!details::kHostLittleEndian) {
+      return;
+    }
+
+    const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+
+    SnapshotHeader header;
+    if (!readSnapshotHeader<Primitive>(bytes, size, header)) {
+      return;
+    }
+    if (header.dataOffset > size || header.count > (size - header.dataOffset) / sizeof(Primitive)) {
+      return;
+    }
+
+    const std::uint8_t* first = bytes + header.dataOffset;
+    if (reinterpret_cast<std::uintptr_t>(first) % alignof(Primitive) != 0u) {
+      return;
+    }
+
+    m_elements = reinterpret_cast<const Primitive*>(first);
+    m_count = static_cast<std::size_t>(header.count);
+    m_valid = true;
+  }
+
+  template <typename Primitive>
+  inline
+  bool
+  SnapshotView<Primitive>::valid() const noexcept {
+    return m_valid;
+  }
+
+  template <typename Primitive>
+  inline
+  std::size_t
+  SnapshotView<Primitive>::size() const noexcept {
+    return m_count;
+  }
+
+  template <typename Primitive>
+  inline
+  bool
+  SnapshotView<Primitive>::empty() const noexcept {
+    return m_count == 0u;
+  }
+
+  template <typename Primitive>
+  inline
+  const Primitive*
+  SnapshotView<Primitive>::data() const noexcept {
+    return m_elements;
+  }
+
+  template <typename Primitive>
+  inline
+  const Primitive*
+  SnapshotView<Primitive>::begin() const noexcept {
+    return m_elements;
+  }
+
+  template <typename Primitive>
+  inline
+  const Primitive*
+  SnapshotView<Primitive>::end() const noexcept {
+    return m_elements + m_count;
+  }
+
+  template <typename Primitive>
+  inline
+  const Primitive&
+  SnapshotView<Primitive>::operator[](std::size_t id) const noexcept {
+    return m_elements[id];
+  }
+
+  template <typename Primitive>
+  inline
+  MappedSnapshot<Primitive>::MappedSnapshot(const std::string& path) noexcept:
+    m_mapping(nullptr),
+    m_size(0u),
+    m_view()
+  {
+# if defined(MATHS_UTILS_SNAPSHOT_MMAP)
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return;
+    }
+
+    struct stat info;
+    if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+      const std::size_t size = static_cast<std::size_t>(info.st_size);
+      void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+      if (mapping != MAP_FAILED) {
+        m_mapping = mapping;
+        m_size = size;
+        m_view = SnapshotView<Primitive>(mapping, size);
+      }
+    }
+
+    // The mapping stays valid after closing the file.
+    ::close(fd);
+# else
+    static_cast<void>(path);
+# endif
+  }
+
+  template <typename Primitive>
+  inline
+  MappedSnapshot<Primitive>::~MappedSnapshot() {
+# if defined(MATHS_UTILS_SNAPSHOT_MMAP)
+    if (m_mapping != nullptr) {
+      ::munmap(m_mapping, m_size);
+    }
+# endif
+  }
+
+  template <typename Primitive>
+  inline
+  bool
+  MappedSnapshot<Primitive>::valid() const noexcept {
+    return m_view.valid();
+  }
+
+  template <typename Primitive>
+  inline
+  const SnapshotView<Primitive>&
+  MappedSnapshot<Primitive>::view() const noexcept {
+    return m_view;
+  }
+
+}
+
+#endif    /* SNAPSHOT_HXX */
@@ -0,0 +1,119 @@
+#ifndef    SPACE_FILLING_CURVE_HH
+# define   SPACE_FILLING_CURVE_HH
+
+# include <vector>
+# include <cstddef>
+# include <cstdint>
+# include "Box.hh"
+# include "Vector2.hh"
+
+namespace utils {
+
+  /**
+   * @brief - The space filling curves available to order points: both keep
+   *          points which are close on the curve close in space. The Hilbert
+   *          curve has better locality (consecutive cells are always adjacent)
+   *          while the Morton curve is cheaper to compute.
+   */
+  enum class Curve {
+    Morton,
+    Hilbert
+  };
+
+  /**
+   * @brief - Computes the index of `p` along the Morton (or Z-order) curve
+   *          by interleaving the bits of its coordinates, `x` taking the even
+   *          bits. Uses the `pdep` instruction when BMI2 is available.
+   *          The coordinates are offset by `2^31` so that the order of the
+   *          codes is consistent across the axes: the curve covers the whole
+   *          range of `int` values.
+   */
+  std::uint64_t
+  mortonEncode(const Vector2i& p) noexcept;
+
+  /**
+   * @brief - Reverse operation of `mortonEncode`.
+   */
+  Vector2i
+  mortonDecode(std::uint64_t code) noexcept;
+
+  /**
+   * @brief - Computes the index of `p` along a Hilbert curve covering the
+   *          whole range of `int` values, with the same offset as for the
+   *          Morton curve. The curve is followed with a state machine which
+   *          processes four bits of each coordinate at once.
+   */
+  std::uint64_t
+  hilbertEncode(const Vector2i& p) noexcept;
+
+  /**
+   * @brief - Reverse operation of `hilbertEncode`.
+   */
+  Vector2i
+  hilbertDecode(std::uint64_t code) noexcept;
+
+  std::uint64_t
+  curveEncode(const Vector2i& p, Curve curve) noexcept;
+
+  Vector2i
+  curveDecode(std::uint64_t code, Curve curve) noexcept;
+
+  /**
+   * @brief - Computes the order in which the input points should be stored
+   *          so that points close in space are close in memory. Points are
+   *          first mapped to the cells of a grid of size `cellSize` and the
+   *          cells are sorted by index along `curve`. Points in the same cell
+   *          keep their relative order.
+   *          Codes are computed relatively to the smallest cell so that only
+   *          the significant bits are sorted, using a radix sort.
+   * @param points - the points to order.
+   * @param count - the number of points, less than `2^32`.
+   * @param order - output vector receiving the index of the points in the
+   *                order of the curve.
+   * @param curve - the curve to use.
+   * @param cellSize - the size of the cells used to quantize coordinates.
+   *                   The default value keeps integer coordinates as is.
+   */
+  template <typename CoordinateType>
+  void
+  curveOrder(const Vector2<CoordinateType>* points,
+             std::size_t count,
+             std::vector<std::uint32_t>& order,
+             Curve curve = Curve::Hilbert,
+             float cellSize = 1.0f);
+
+  /**
+   * @brief - Similar to the other overload but orders boxes using their
+   *          center.
+   */
+  template <typename CoordinateType>
+  void
+  curveOrder(const Box<CoordinateType>* boxes,
+             std::size_t count,
+             std::vector<std::uint32_t>& order,
+             Curve curve = Curve::Hilbert,
+             float cellSize = 1.0f);
+
+  /**
+   * @brief - Sorts the input points in place in the order computed by
+   *          `curveOrder`.
+   */
+  template <typename CoordinateType>
+  void
+  sortByCurve(Vector2<CoordinateType>* points,
+              std::size_t count,
+              Curve curve = Curve::Hilbert,
+              float cellSize = 1.0f);
+
+  template <typename CoordinateType>
+  void
+  sortByCurve(Box<CoordinateType>* boxes,
+              std::size_t count,
+              Curve curve = Curve::Hilbert,
+              float cellSize = 1.0f);
+
+}
+
+# include "SpaceFillingCurve.hxx"
+
+#endif    /* SPACE_FILLING_CURVE_HH */
@@ -0,0 +1,462 @@
+#ifndef    SPACE_FILLING_CURVE_HXX
+# define   SPACE_FILLING_CURVE_HXX
+
+# include <cmath>
+# include <limits>
+# include <utility>
+# include <algorithm>
+# include "SpaceFillingCurve.hh"
+# include "SimdUtils.hh"
+
+namespace utils {
+  namespace details {
+
+    /**
+     * @brief - Offset applied to signed coordinates so that their order is
+     *          preserved once interpreted as unsigned values.
+     */
+    constexpr std::uint32_t kCurveOffset = 0x80000000u;
+
+    inline
+    std::uint64_t
+    spreadBits(std::uint32_t value) noexcept {
+      std::uint64_t v = value;
+      v = (v | (v << 16u)) & 0x0000FFFF0000FFFFull;
+      v = (v | (v << 8u)) & 0x00FF00FF00FF00FFull;
+      v = (v | (v << 4u)) & 0x0F0F0F0F0F0F0F0Full;
+      v = (v | (v << 2u)) & 0x3333333333333333ull;
+      v = (v | (v << 1u)) & 0x5555555555555555ull;
+
+      return v;
+    }
+
+    inline
+    std::uint32_t
+    compactBits(std::uint64_t value) noexcept {
+      std::uint64_t v = value & 0x5555555555555555ull;
+      v = (v | (v >> 1u)) & 0x3333333333333333ull;
+      v = (v | (v >> 2u)) & 0x0F0F0F0F0F0F0F0Full;
+      v = (v | (v >> 4u)) & 0x00FF00FF00FF00FFull;
+      v = (v | (v >> 8u)) & 0x0000FFFF0000FFFFull;
+      v = (v | (v >> 16u)) & 0x00000000FFFFFFFFull;
+
+      return static_cast<std::uint32_t>(v);
+    }
+
+    inline
+    std::uint64_t
+    morton(std::uint32_t x, std::uint32_t y) noexcept {
+# if defined(MATHS_UTILS_BMI2)
+      return _pdep_u64(x, 0x5555555555555555ull) | _pdep_u64(y, 0xAAAAAAAAAAAAAAAAull);
+# else
+      return spreadBits(x) | (spreadBits(y) << 1u);
+# endif
+    }
+
+    inline
+    void
+    unmorton(std::uint64_t code, std::uint32_t& x, std::uint32_t& y) noexcept {
+# if defined(MATHS_UTILS_BMI2)
+      x = static_cast<std::uint32_t>(_pext_u64(code, 0x5555555555555555ull));
+      y = static_cast<std::uint32_t>(_pext_u64(code, 0xAAAAAAAAAAAAAAAAull));
+# else
+      x = compactBits(code);
+      y = compactBits(code >> 1u);
+# endif
+    }
+
+    /**
+     * @brief - Transitions of the state machine following the Hilbert curve
+     *          for four levels at once. The state describes how the remaining
+     *          levels are transformed: the first bit tells whether both bits
+     *          are inverted and the second whether they are swapped.
+     *            - `encode[state][(x << 4) | y]` holds the four digits of the
+     *              curve for the nibbles `x` and `y` in its low byte and the
+     *              next state in the next bits.
+     *            - `decode[state][digits]` holds `(x << 4) | y` in its low
+     *              byte and the next state in the next bits.
+     */
+    struct HilbertTables {
+      std::uint16_t encode[4][256];
+      std::uint16_t decode[4][256];
+    };
+
+    /**
+     * @brief - Transforms the bits of a single level according to `state`
+     *          and computes the digit of the curve and the next state, see
+     *          the rotations described on the Hilbert curve Wikipedia page.
+     */
+    constexpr
+    void
+    hilbertStep(unsigned& state, unsigned& bx, unsigned& by, unsigned& digit) noexcept {
+      if (state & 1u) {
+        bx ^= 1u;
+        by ^= 1u;
+      }
+      if (state & 2u) {
+        const unsigned tmp = bx;
+        bx = by;
+        by = tmp;
+      }
+
+      digit = (3u * bx) ^ by;
+
+      if (by == 0u) {
+        state ^= (bx == 1u ? 3u : 2u);
+      }
+    }
+
+    constexpr
+    HilbertTables
+    buildHilbertTables() noexcept {
+      HilbertTables tables{};
+
+      for (unsigned start = 0u ; start < 4u ; ++start) {
+        for (unsigned key = 0u ; key < 256u ; ++key) {
+          // Encoding: `key` holds the nibbles of the coordinates.
+          unsigned state = start;
+          unsigned digits = 0u;
+          for (int level = 3 ; level >= 0 ; --level) {
+            unsigned bx = ((key >> 4u) >> level) & 1u;
+            unsigned by = (key >> level) & 1u;
+            unsigned digit = 0u;
+            hilbertStep(state, bx, by, digit);
+            digits = (digits << 2u) | digit;
+          }
+          tables.encode[start][key] = static_cast<std::uint16_t>(digits | (state << 8u));
+
+          // Decoding: `key` holds the digits of the curve. The coordinates
+          // are recovered by undoing the transformation of each level.
+          state = start;
+          unsigned coords = 0u;
+          for (int level = 3 ; level >= 0 ; --level) {
+            const unsigned digit = (key >> (2 * level)) & 3u;
+            unsigned bx = digit >> 1u;
+            unsigned by = (digit & 1u) ^ bx;
+
+            unsigned rx = ((state & 2u) ? by : bx) ^ (state & 1u);
+            unsigned ry = ((state & 2u) ? bx : by) ^ (state & 1u);
+            coords |= (rx << (4 + level)) | (ry << level);
+
+            unsigned check = 0u;
+            hilbertStep(state, rx, ry, check);
+          }
+          tables.decode[start][key] = static_cast<std::uint16_t>(coords | (state << 8u));
+        }
+      }
+
+      return tables;
+    }
+
+    inline constexpr HilbertTables kHilbertTables = buildHilbertTables();
+
+    inline
+    std::uint64_t
+    hilbert(std::uint32_t x, std::uint32_t y) noexcept {
+      unsigned state = 0u;
+      std::uint64_t code = 0u;
+
+      // Levels where both bits are `0` swap the coordinates: four of them
+      // leave the state unchanged so leading nibbles of zeros can be skipped.
+      int shift = 28;
+      while (shift > 0 && ((x | y) >> shift) == 0u) {
+        shift -= 4;
+      }
+
+      for ( ; shift >= 0 ; shift -= 4) {
+        const unsigned key = (((x >> shift) & 0xFu) << 4u) | ((y >> shift) & 0xFu);
+        const unsigned entry = kHilbertTables.encode[state][key];
+
+        code = (code << 8u) | (entry & 0xFFu);
+        state = entry >> 8u;
+      }
+
+      return code;
+    }
+
+    inline
+    void
+    unhilbert(std::uint64_t code, std::uint32_t& x, std::uint32_t& y) noexcept {
+      unsigned state = 0u;
+      x = 0u;
+      y = 0u;
+
+      for (int shift = 56 ; shift >= 0 ; shift -= 8) {
+        const unsigned entry = kHilbertTables.decode[state][(code >> shift) & 0xFFu];
+
+        x = (x << 4u) | ((entry >> 4u) & 0xFu);
+        y = (y << 4u) | (entry & 0xFu);
+        state = entry >> 8u;
+      }
+    }
+
+    /**
+     * @brief - Converts a coordinate to the index of the cell containing
+     *          it, clamped to the range of `int`. `scale` is the inverse of
+     *          the size of a cell.
+     */
+    template <typename CoordinateType>
+    inline
+    std::int32_t
+    curveCell(const CoordinateType& value, double scale) noexcept {
+      const double cell = std::floor(static_cast<double>(value) * scale);
+
+      // Written so that `NaN` maps to the lowest cell.
+      if (!(cell >= -2147483648.0)) {
+        return std::numeric_limits<std::int32_t>::lowest();
+      }
+      if (cell >= 2147483647.0) {
+        return std::numeric_limits<std::int32_t>::max();
+      }
+
+      return static_cast<std::int32_t>(cell);
+    }
+
+    /**
+     * @brief - Sorts the indices of the cells by increasing index along the
+     *          curve, keeping the relative order of identical cells. Codes
+     *          are computed relatively to the smallest cell so that only the
+     *          significant bits need to be sorted: when they fit on 32 bits
+     *          (i.e. less than `2^16` cells along each axis) each code is
+     *          packed with its index in a single 64 bits value and sorted
+     *          with a radix sort on the significant bits.
+     */
+    inline
+    void
+    orderCells(const std::vector<std::int32_t>& xs,
+               const std::vector<std::int32_t>& ys,
+               Curve curve,
+               std::vector<std::uint32_t>& order)
+    {
+      const std::size_t count = xs.size();
+
+      order.resize(count);
+      if (count == 0u) {
+        return;
+      }
+
+      const auto rangeX = std::minmax_element(xs.begin(), xs.end());
+      const auto rangeY = std::minmax_element(ys.begin(), ys.end());
+      const std::int64_t minX = *rangeX.first;
+      const std::int64_t minY = *rangeY.first;
+      const std::uint64_t span = static_cast<std::uint64_t>(std::max(*rangeX.second - minX, *rangeY.second - minY));
+
+      unsigned bits = 0u;
+      while (bits < 32u && (span >> bits) != 0u) {
+        ++bits;
+      }
+
+      const auto code = [&](std::size_t id) {
+        const std::uint32_t x = static_cast<std::uint32_t>(xs[id] - minX);
+        const std::uint32_t y = static_cast<std::uint32_t>(ys[id] - minY);
+        return (curve == Curve::Morton ? morton(x, y) : hilbert(x, y));
+      };
+
+      if (bits > 16u) {
+        std::vector<std::pair<std::uint64_t, std::uint32_t>> keys(count);
+        for (std::size_t id = 0u ; id < count ; ++id) {
+          keys[id] = std::make_pair(code(id), static_cast<std::uint32_t>(id));
+        }
+
+        std::sort(keys.begin(), keys.end());
+        for (std::size_t id = 0u ; id < count ; ++id) {
+          order[id] = keys[id].second;
+        }
+
+        return;
+      }
+
+      // Digits of up to 11 bits need less passes than bytes for a similar
+      // cost per pass, as long as the histograms fit in the cache.
+      const unsigned codeBits = 2u * bits;
+      const unsigned passes = (codeBits + 10u) / 11u;
+      const unsigned digitBits = (passes == 0u ? 0u : (codeBits + passes - 1u) / passes);
+      const std::uint64_t digitMask = (std::uint64_t(1) << digitBits) - 1u;
+      const std::size_t buckets = std::size_t(1) << digitBits;
+
+      std::vector<std::uint64_t> items(count);
+      std::vector<std::uint64_t> tmp(count);
+      std::vector<std::size_t> histograms(passes * buckets, 0u);
+
+      for (std::size_t id = 0u ; id < count ; ++id) {
+        const std::uint64_t item = (code(id) << 32u) | id;
+        items[id] = item;
+
+        for (unsigned pass = 0u ; pass < passes ; ++pass) {
+          ++histograms[pass * buckets + ((item >> (32u + pass * digitBits)) & digitMask)];
+        }
+      }
+
+      for (unsigned pass = 0u ; pass < passes ; ++pass) {
+        std::size_t* histogram = histograms.data() + pass * buckets;
+        const unsigned shift = 32u + pass * digitBits;
+
+        if (histogram[(items[0u] >> shift) & digitMask] == count) {
+          continue;
+        }
+
+        std::size_t offset = 0u;
+        for (std::size_t bucket = 0u ; bucket < buckets ; ++bucket) {
+          const std::size_t size = histogram[bucket];
+          histogram[bucket] = offset;
+          offset += size;
+        }
+
+        for (std::size_t id = 0u ; id < count ; ++id) {
+          tmp[histogram[(items[id] >> shift) & digitMask]++] = items[id];
+        }
+
+        items.swap(tmp);
+      }
+
+      for (std::size_t id = 0u ; id < count ; ++id) {
+        order[id] = static_cast<std::uint32_t>(items[id]);
+      }
+    }
+
+    /**
+     * @brief - Reorders `count` elements in place given the index of the
+     *          element to store at each position.
+     */
+    template <typename ValueType>
+    inline
+    void
+    applyOrder(ValueType* values,
+               std::size_t count,
+               const std::vector<std::uint32_t>& order)
+    {
+      std::vector<ValueType> sorted;
+      sorted.reserve(count);
+
+      for (std::size_t id = 0u ; id < count ; ++id) {
+        sorted.push_back(values[order[id]]);
+      }
+
+      std::copy(sorted.begin(), sorted.end(), values);
+    }
+
+  }
+
+  inline
+  std::uint64_t
+  mortonEncode(const Vector2i& p) noexcept {
+    return details::morton(
+      static_cast<std::uint32_t>(p.x()) ^ details::kCurveOffset,
+      static_cast<std::uint32_t>(p.y()) ^ details::kCurveOffset
+    );
+  }
+
+  inline
+  Vector2i
+  mortonDecode(std::uint64_t code) noexcept {
+    std::uint32_t x, y;
+    details::unmorton(code, x, y);
+
+    return Vector2i(
+      static_cast<int>(x ^ details::kCurveOffset),
+      static_cast<int>(y ^ details::kCurveOffset)
+    );
+  }
+
+  inline
+  std::uint64_t
+  hilbertEncode(const Vector2i& p) noexcept {
+    return details::hilbert(
+      static_cast<std::uint32_t>(p.x()) ^ details::kCurveOffset,
+      static_cast<std::uint32_t>(p.y()) ^ details::kCurveOffset
+    );
+  }
+
+  inline
+  Vector2i
+  hilbertDecode(std::uint64_t code) noexcept {
+    std::uint32_t x, y;
+    details::unhilbert(code, x, y);
+
+    return Vector2i(
+      static_cast<int>(x ^ details::kCurveOffset),
+      static_cast<int>(y ^ details::kCurveOffset)
+    );
+  }
+
+  inline
+  std::uint64_t
+  curveEncode(const Vector2i& p, Curve curve) noexcept {
+    return (curve == Curve::Morton ? mortonEncode(p) : hilbertEncode(p));
+  }
+
+  inline
+  Vector2i
+  curveDecode(std::uint64_t code, Curve curve) noexcept {
+    return (curve == Curve::Morton ? mortonDecode(code) : hilbertDecode(code));
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  curveOrder(const Vector2<CoordinateType>* points,
+             std::size_t count,
+             std::vector<std::uint32_t>& order,
+             Curve curve,
+             float cellSize)
+  {
+    const double scale = 1.0 / static_cast<double>(cellSize);
+    std::vector<std::int32_t> xs(count), ys(count);
+
+    for (std::size_t id = 0u ; id < count ; ++id) {
+      xs[id] = details::curveCell(points[id].x(), scale);
+      ys[id] = details::curveCell(points[id].y(), scale);
+    }
+
+    details::orderCells(xs, ys, curve, order);
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  curveOrder(const Box<CoordinateType>* boxes,
+             std::size_t count,
+             std::vector<std::uint32_t>& order,
+             Curve curve,
+             float cellSize)
+  {
+    const double scale = 1.0 / static_cast<double>(cellSize);
+    std::vector<std::int32_t> xs(count), ys(count);
+
+    for (std::size_t id = 0u ; id < count ; ++id) {
+      xs[id] = details::curveCell(boxes[id].x(), scale);
+      ys[id] = details::curveCell(boxes[id].y(), scale);
+    }
+
+    details::orderCells(xs, ys, curve, order);
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  sortByCurve(Vector2<CoordinateType>* points,
+              std::size_t count,
+              Curve curve,
+              float cellSize)
+  {
+    std::vector<std::uint32_t> order;
+    curveOrder(points, count, order, curve, cellSize);
+    details::applyOrder(points, count, order);
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  sortByCurve(Box<CoordinateType>* boxes,
+              std::size_t count,
+              Curve curve,
+              float cellSize)
+  {
+    std::vector<std::uint32_t> order;
+    curveOrder(boxes, count, order, curve, cellSize);
+    details::applyOrder(boxes, count, order);
+  }
+
+}
+
+#endif    /* SPACE_FILLING_CURVE_HXX */
@@ -0,0 +1,169 @@
+#ifndef    SPATIAL_HASH_GRID_HH
+# define   SPATIAL_HASH_GRID_HH
+
+# include <vector>
+# include <memory>
+# include <atomic>
+# include <cstdint>
+# include "Point2.hh"
+
+namespace utils {
+
+  /**
+   * @brief - Indexes a set of points in a uniform grid of square cells. The
+   *          cells are hashed into a table with a number of buckets close to
+   *          the number of points so the memory usage does not depend on the
+   *          extent of the points.
+   *          Points are sorted by bucket with a counting sort: all points of
+   *          a bucket are contiguous in memory and each bucket is described
+   *          by a range in this array.
+   *          Queries report the index of the points in the array used to
+   *          build the grid. The grid does not support updates: it should be
+   *          rebuilt when the points move, which is cheap and can be done
+   *          using several threads.
+   */
+  template <typename CoordinateType>
+  class SpatialHashGrid {
+    public:
+
+      /**
+       * @brief - Creates an empty grid with the specified cell size. Queries
+       *          are the most efficient when the cell size is close to the
+       *          typical query radius.
+       * @param cellSize - the size of a cell of the grid.
+       */
+      explicit
+      SpatialHashGrid(float cellSize);
+
+      /**
+       * @brief - Rebuilds the grid from the input points. Any previous
+       *          content is discarded.
+       * @param points - a pointer to the first point to index.
+       * @param count - the number of points to index.
+       * @param threads - the number of threads to use, `0` to use one per
+       *                  hardware thread. Small inputs always use a single
+       *                  thread.
+       */
+      void
+      rebuild(const Vector2<CoordinateType>* points,
+              std::size_t count,
+              unsigned threads = 0u);
+
+      void
+      rebuild(const std::vector<Vector2<CoordinateType>>& points,
+              unsigned threads = 0u);
+
+      float
+      cellSize() const noexcept;
+
+      std::size_t
+      size() const noexcept;
+
+      bool
+      empty() const noexcept;
+
+      /**
+       * @brief - Calls `callback` with the index of each point `q` such that
+       *          `d2(p, q) <= r * r`.
+       * @param p - the center of the query.
+       * @param r - the radius of the query.
+       * @param callback - a callable accepting a `std::size_t`.
+       */
+      template <typename Callback>
+      void
+      forEachInRadius(const Vector2<CoordinateType>& p,
+                      float r,
+                      Callback&& callback) const;
+
+      void
+      inRadius(const Vector2<CoordinateType>& p,
+               float r,
+               std::vector<std::size_t>& out) const;
+
+      /**
+       * @brief - Finds the `k` points closest to `p`. In case less than `k`
+       *          points are indexed all of them are returned.
+       * @param p - the reference point.
+       * @param k - the number of neighbours to find.
+       * @param out - output vector which is cleared and receives the index
+       *              of the neighbours sorted by increasing distance to `p`.
+       */
+      void
+      nearest(const Vector2<CoordinateType>& p,
+              std::size_t k,
+              std::vector<std::size_t>& out) const;
+
+    private:
+
+      /**
+       * @brief - Computes the coordinates of the cell containing `p`.
+       */
+      void
+      cellOf(const Vector2<CoordinateType>& p,
+             std::int32_t& cx,
+             std::int32_t& cy) const noexcept;
+
+      std::uint32_t
+      bucketOf(std::int32_t cx, std::int32_t cy) const noexcept;
+
+      /**
+       * @brief - Calls `callback` with the position in the sorted arrays of
+       *          each point lying in the cell `(cx, cy)`.
+       */
+      template <typename Callback>
+      void
+      forEachInCell(std::int32_t cx,
+                    std::int32_t cy,
+                    Callback&& callback) const;
+
+    private:
+
+      float m_cellSize;
+      float m_invCellSize;
+
+      /**
+       * @brief - The number of buckets minus one: the number of buckets is
+       *          always a power of two.
+       */
+      std::uint32_t m_mask;
+
+      /**
+       * @brief - The points of bucket `b` are in the range `[m_starts[b];
+       *          m_starts[b + 1][` of `m_points` and `m_indices`.
+       */
+      std::vector<std::uint32_t> m_starts;
+      std::vector<Vector2<CoordinateType>> m_points;
+      std::vector<std::uint32_t> m_indices;
+
+      /**
+       * @brief - Scratch storage used while rebuilding the grid.
+       */
+      std::vector<std::uint32_t> m_buckets;
+      std::unique_ptr<std::atomic<std::uint32_t>[]> m_cursors;
+      std::size_t m_cursorsCount;
+
+      /**
+       * @brief - The range of cells containing at least a point, used to
+       *          bound the search for nearest neighbours.
+       */
+      std::int32_t m_minCellX;
+      std::int32_t m_minCellY;
+      std::int32_t m_maxCellX;
+      std::int32_t m_maxCellY;
+
+      /**
+       * @brief - Whether the cells of all the points are strictly inside the
+       *          range of cells handled by the grid, in which case computing
+       *          the cell of a point does not need to clamp it.
+       */
+      bool m_cellsInRange;
+  };
+
+  using SpatialHashGridf = SpatialHashGrid<float>;
+  using SpatialHashGridi = SpatialHashGrid<int>;
+
+}
+
+# include "SpatialHashGrid.hxx"
+
+#endif    /* SPATIAL_HASH_GRID_HH */
@@ -0,0 +1,445 @@
+#ifndef    SPATIAL_HASH_GRID_HXX
+# define   SPATIAL_HASH_GRID_HXX
+
+# include <cmath>
+# include <limits>
+# include <utility>
+# include <algorithm>
+# include <type_traits>
+# include "SpatialHashGrid.hh"
+# include "LocationUtils.hh"
+# include "ParallelUtils.hh"
+
+namespace utils {
+  namespace details {
+
+    /**
+     * @brief - The range of cells handled by the grid: the floats closest to
+     *          the limits of `std::int32_t` within its range.
+     */
+    constexpr float kLowestCell = -2147483648.0f;
+    constexpr float kHighestCell = 2147483520.0f;
+
+    /**
+     * @brief - The cell containing the coordinate `value` in a grid whose
+     *          cells have a size of `1 / invCellSize`. When `Clamped` is
+     *          `false` the cell should be known to be in the range of cells
+     *          handled by the grid.
+     */
+    template <bool Clamped>
+    inline
+    std::int32_t
+    gridCell(float value, float invCellSize) noexcept {
+      const float cell = std::floor(value * invCellSize);
+
+      if constexpr (Clamped) {
+        // Written so that `NaN` maps to the lowest cell.
+        if (!(cell >= kLowestCell)) {
+          return static_cast<std::int32_t>(kLowestCell);
+        }
+        if (cell >= kHighestCell) {
+          return static_cast<std::int32_t>(kHighestCell);
+        }
+      }
+
+      return static_cast<std::int32_t>(cell);
+    }
+
+  }
+
+  template <typename CoordinateType>
+  inline
+  SpatialHashGrid<CoordinateType>::SpatialHashGrid(float cellSize):
+    m_cellSize(cellSize),
+    m_invCellSize(1.0f / cellSize),
+
+    m_mask(0u),
+
+    m_starts(1u, 0u),
+    m_points(),
+    m_indices(),
+
+    m_buckets(),
+    m_cursors(),
+    m_cursorsCount(0u),
+
+    m_minCellX(0),
+    m_minCellY(0),
+    m_maxCellX(-1),
+    m_maxCellY(-1),
+    m_cellsInRange(true)
+  {}
+
+  template <typename CoordinateType>
+  inline
+  void
+  SpatialHashGrid<CoordinateType>::rebuild(const Vector2<CoordinateType>* points,
+                                           std::size_t count,
+                                           unsigned threads)
+  {
+    // Use roughly one bucket per point.
+    std::size_t buckets = 16u;
+    while (buckets < count) {
+      buckets <<= 1u;
+    }
+
+    m_mask = static_cast<std::uint32_t>(buckets - 1u);
+    m_starts.resize(buckets + 1u);
+    m_points.resize(count);
+    m_indices.resize(count);
+    m_buckets.resize(count);
+
+    if (m_cursorsCount < buckets) {
+      m_cursors.reset(new std::atomic<std::uint32_t>[buckets]);
+      m_cursorsCount = buckets;
+    }
+    for (std::size_t id = 0u ; id < buckets ; ++id) {
+      m_cursors[id].store(0u, std::memory_order_relaxed);
+    }
+
+    // First pass: compute the bucket of each point and count the points
+    // in each bucket. Each chunk also computes the range of cells used.
+    const unsigned workers = threadsFor(count, threads);
+    std::vector<std::int32_t> ranges(4u * workers);
+    for (unsigned id = 0u ; id < workers ; ++id) {
+      ranges[4u * id + 0u] = std::numeric_limits<std::int32_t>::max();
+      ranges[4u * id + 1u] = std::numeric_limits<std::int32_t>::max();
+      ranges[4u * id + 2u] = std::numeric_limits<std::int32_t>::lowest();
+      ranges[4u * id + 3u] = std::numeric_limits<std::int32_t>::lowest();
+    }
+
+    parallelFor(
+      count,
+      [&](unsigned chunk, std::size_t begin, std::size_t end) {
+        std::int32_t* range = ranges.data() + 4u * chunk;
+
+        for (std::size_t id = begin ; id < end ; ++id) {
+          std::int32_t cx, cy;
+          cellOf(points[id], cx, cy);
+
+          range[0u] = std::min(range[0u], cx);
+          range[1u] = std::min(range[1u], cy);
+          range[2u] = std::max(range[2u], cx);
+          range[3u] = std::max(range[3u], cy);
+
+          const std::uint32_t bucket = bucketOf(cx, cy);
+          m_buckets[id] = bucket;
+          m_cursors[bucket].fetch_add(1u, std::memory_order_relaxed);
+        }
+      },
+      workers
+    );
+
+    m_minCellX = std::numeric_limits<std::int32_t>::max();
+    m_minCellY = std::numeric_limits<std::int32_t>::max();
+    m_maxCellX = std::numeric_limits<std::int32_t>::lowest();
+    m_maxCellY = std::numeric_limits<std::int32_t>::lowest();
+    for (unsigned id = 0u ; id < workers ; ++id) {
+      m_minCellX = std::min(m_minCellX, ranges[4u * id + 0u]);
+      m_minCellY = std::min(m_minCellY, ranges[4u * id + 1u]);
+      m_maxCellX = std::max(m_maxCellX, ranges[4u * id + 2u]);
+      m_maxCellY = std::max(m_maxCellY, ranges[4u * id + 3u]);
+    }
+
+    const std::int32_t lowest = static_cast<std::int32_t>(details::kLowestCell);
+    const std::int32_t highest = static_cast<std::int32_t>(details::kHighestCell);
+    m_cellsInRange =
+      m_minCellX > lowest && m_maxCellX < highest &&
+      m_minCellY > lowest && m_maxCellY < highest
+    ;
+
+    // Second pass: prefix sum of the counts to get the start of each bucket
+    // which is also the initial insertion cursor of the bucket.
+    std::uint32_t start = 0u;
+    for (std::size_t bucket = 0u ; bucket < buckets ; ++bucket) {
+      const std::uint32_t inBucket = m_cursors[bucket].load(std::memory_order_relaxed);
+      m_starts[bucket] = start;
+      m_cursors[bucket].store(start, std::memory_order_relaxed);
+      start += inBucket;
+    }
+    m_starts[buckets] = start;
+
+    // Third pass: scatter the points in their bucket.
+    parallelFor(
+      count,
+      [&](unsigned /*chunk*/, std::size_t begin, std::size_t end) {
+        for (std::size_t id = begin ; id < end ; ++id) {
+          const std::uint32_t pos = m_cursors[m_buckets[id]].fetch_add(1u, std::memory_order_relaxed);
+          m_points[pos] = points[id];
+          m_indices[pos] = static_cast<std::uint32_t>(id);
+        }
+      },
+      workers
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  SpatialHashGrid<CoordinateType>::rebuild(const std::vector<Vector2<CoordinateType>>& points,
+                                           unsigned threads)
+  {
+    rebuild(points.data(), points.size(), threads);
+  }
+
+  template <typename CoordinateType>
+  inline
+  float
+  SpatialHashGrid<CoordinateType>::cellSize() const noexcept {
+    return m_cellSize;
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  SpatialHashGrid<CoordinateType>::size() const noexcept {
+    return m_points.size();
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  SpatialHashGrid<CoordinateType>::empty() const noexcept {
+    return m_points.empty();
+  }
+
+  template <typename CoordinateType>
+  template <typename Callback>
+  inline
+  void
+  SpatialHashGrid<CoordinateType>::forEachInRadius(const Vector2<CoordinateType>& p,
+                                                   float r,
+                                                   Callback&& callback) const
+  {
+    if (m_points.empty()) {
+      return;
+    }
+
+    const float r2 = r * r;
+    const float px = static_cast<float>(p.x());
+    const float py = static_cast<float>(p.y());
+
+    // Only visit the cells overlapping the bounding box of the query and
+    // containing points.
+    const std::int64_t minX = std::max(m_minCellX, details::gridCell<true>(px - r, m_invCellSize));
+    const std::int64_t minY = std::max(m_minCellY, details::gridCell<true>(py - r, m_invCellSize));
+    const std::int64_t maxX = std::min(m_maxCellX, details::gridCell<true>(px + r, m_invCellSize));
+    const std::int64_t maxY = std::min(m_maxCellY, details::gridCell<true>(py + r, m_invCellSize));
+
+    if (minX > maxX || minY > maxY) {
+      return;
+    }
+
+    // The cost of a cell does not depend on whether it holds points: when
+    // there are more cells to visit than points it is faster to test all
+    // the points. Each dimension spans at most `2^32` cells so that their
+    // product can overflow.
+    const std::uint64_t w = static_cast<std::uint64_t>(maxX - minX + 1);
+    const std::uint64_t h = static_cast<std::uint64_t>(maxY - minY + 1);
+    if (w > m_points.size() || h > m_points.size() || w * h > m_points.size()) {
+      for (std::size_t pos = 0u ; pos < m_points.size() ; ++pos) {
+        if (d2(p, m_points[pos]) <= r2) {
+          callback(static_cast<std::size_t>(m_indices[pos]));
+        }
+      }
+
+      return;
+    }
+
+    for (std::int64_t cy = minY ; cy <= maxY ; ++cy) {
+      for (std::int64_t cx = minX ; cx <= maxX ; ++cx) {
+        forEachInCell(
+          static_cast<std::int32_t>(cx),
+          static_cast<std::int32_t>(cy),
+          [&](std::uint32_t pos) {
+            if (d2(p, m_points[pos]) <= r2) {
+              callback(static_cast<std::size_t>(m_indices[pos]));
+            }
+          }
+        );
+      }
+    }
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  SpatialHashGrid<CoordinateType>::inRadius(const Vector2<CoordinateType>& p,
+                                            float r,
+                                            std::vector<std::size_t>& out) const
+  {
+    forEachInRadius(
+      p,
+      r,
+      [&out](std::size_t id) {
+        out.push_back(id);
+      }
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  SpatialHashGrid<CoordinateType>::nearest(const Vector2<CoordinateType>& p,
+                                           std::size_t k,
+                                           std::vector<std::size_t>& out) const
+  {
+    out.clear();
+    k = std::min(k, m_points.size());
+    if (k == 0u) {
+      return;
+    }
+
+    // Keep the `k` best candidates in a max heap on the distance so that
+    // the worst one can be replaced efficiently.
+    using Candidate = std::pair<float, std::uint32_t>;
+    std::vector<Candidate> heap;
+    heap.reserve(k);
+
+    auto consider = [&](std::uint32_t pos) {
+      const float d = d2(p, m_points[pos]);
+      if (heap.size() < k) {
+        heap.emplace_back(d, m_indices[pos]);
+        std::push_heap(heap.begin(), heap.end());
+      }
+      else if (d < heap.front().first) {
+        std::pop_heap(heap.begin(), heap.end());
+        heap.back() = Candidate(d, m_indices[pos]);
+        std::push_heap(heap.begin(), heap.end());
+      }
+    };
+
+    auto visit = [&](std::int64_t cx, std::int64_t cy) {
+      if (cx >= m_minCellX && cx <= m_maxCellX && cy >= m_minCellY && cy <= m_maxCellY) {
+        forEachInCell(static_cast<std::int32_t>(cx), static_cast<std::int32_t>(cy), consider);
+      }
+    };
+
+    std::int32_t pcx, pcy;
+    cellOf(p, pcx, pcy);
+
+    // Visit rings of cells of increasing size around the cell of the point.
+    // Cells outside of ring `R` are at least at `R * cellSize` from `p`: we
+    // can stop as soon as the `k` best candidates are closer than that.
+    // Empty cells cost as much as the others: once the rings have visited
+    // as many cells as there are points, testing all of them is cheaper.
+    std::uint64_t visited = 0u;
+
+    for (std::int64_t ring = 0 ; ; ++ring) {
+      const std::int64_t left = pcx - ring;
+      const std::int64_t right = pcx + ring;
+      const std::int64_t bottom = pcy - ring;
+      const std::int64_t top = pcy + ring;
+
+      const std::int64_t xFrom = std::max<std::int64_t>(left, m_minCellX);
+      const std::int64_t xTo = std::min<std::int64_t>(right, m_maxCellX);
+      const std::int64_t yFrom = std::max<std::int64_t>(bottom + 1, m_minCellY);
+      const std::int64_t yTo = std::min<std::int64_t>(top - 1, m_maxCellY);
+
+      visited += 2u * static_cast<std::uint64_t>(std::max<std::int64_t>(0, xTo - xFrom + 1));
+      visited += 2u * static_cast<std::uint64_t>(std::max<std::int64_t>(0, yTo - yFrom + 1));
+
+      if (visited > m_points.size()) {
+        heap.clear();
+        for (std::uint32_t pos = 0u ; pos < m_points.size() ; ++pos) {
+          consider(pos);
+        }
+
+        break;
+      }
+
+      if (ring == 0) {
+        visit(pcx, pcy);
+      }
+      else {
+        for (std::int64_t cx = xFrom ; cx <= xTo ; ++cx) {
+          visit(cx, bottom);
+          visit(cx, top);
+        }
+
+        for (std::int64_t cy = yFrom ; cy <= yTo ; ++cy) {
+          visit(left, cy);
+          visit(right, cy);
+        }
+      }
+
+      const float bound = static_cast<float>(ring) * m_cellSize;
+      if (heap.size() == k && heap.front().first <= bound * bound) {
+        break;
+      }
+
+      // All the cells containing points have been visited.
+      if (left <= m_minCellX && right >= m_maxCellX && bottom <= m_minCellY && top >= m_maxCellY) {
+        break;
+      }
+    }
+
+    std::sort_heap(heap.begin(), heap.end());
+
+    out.reserve(heap.size());
+    for (const Candidate& c : heap) {
+      out.push_back(static_cast<std::size_t>(c.second));
+    }
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  SpatialHashGrid<CoordinateType>::cellOf(const Vector2<CoordinateType>& p,
+                                          std::int32_t& cx,
+                                          std::int32_t& cy) const noexcept
+  {
+    cx = details::gridCell<true>(static_cast<float>(p.x()), m_invCellSize);
+    cy = details::gridCell<true>(static_cast<float>(p.y()), m_invCellSize);
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::uint32_t
+  SpatialHashGrid<CoordinateType>::bucketOf(std::int32_t cx, std::int32_t cy) const noexcept {
+    const std::uint32_t h =
+      (static_cast<std::uint32_t>(cx) * 73856093u) ^
+      (static_cast<std::uint32_t>(cy) * 19349663u)
+    ;
+
+    return h & m_mask;
+  }
+
+  template <typename CoordinateType>
+  template <typename Callback>
+  inline
+  void
+  SpatialHashGrid<CoordinateType>::forEachInCell(std::int32_t cx,
+                                                 std::int32_t cy,
+                                                 Callback&& callback) const
+  {
+    const std::uint32_t bucket = bucketOf(cx, cy);
+
+    // Several cells can share the same bucket so we need to filter the
+    // points which do not belong to the requested cell. Clamping the cells
+    // is only needed when some points are far from the origin, which does
+    // not happen in most grids.
+    const auto scan = [&](auto clamped) {
+      constexpr bool Clamped = decltype(clamped)::value;
+
+      for (std::uint32_t pos = m_starts[bucket] ; pos < m_starts[bucket + 1u] ; ++pos) {
+        const std::int32_t x = details::gridCell<Clamped>(static_cast<float>(m_points[pos].x()), m_invCellSize);
+        const std::int32_t y = details::gridCell<Clamped>(static_cast<float>(m_points[pos].y()), m_invCellSize);
+
+        if (x == cx && y == cy) {
+          callback(pos);
+        }
+      }
+    };
+
+    if (m_cellsInRange) {
+      scan(std::false_type());
+    }
+    else {
+      scan(std::true_type());
+    }
+  }
+
+}
+
+#endif    /* SPATIAL_HASH_GRID_HXX */
@@ -0,0 +1,170 @@
+#ifndef    SWEEP_AND_PRUNE_HH
+# define   SWEEP_AND_PRUNE_HH
+
+# include <vector>
+# include <cstddef>
+# include <cstdint>
+# include "Box.hh"
+
+namespace utils {
+
+  /**
+   * @brief - Finds all the pairs of overlapping boxes in a set, typically
+   *          as the broad phase of a collision detection step. The boxes
+   *          are sorted by left bound and swept along the x axis: each box
+   *          is only tested against the boxes starting before it ends.
+   *          The sorted order is kept from one update to the next: when the
+   *          boxes only move a little between two calls (e.g. successive
+   *          frames of a simulation) restoring the order with an insertion
+   *          sort is close to linear. Large inputs are swept with several
+   *          threads, see `parallelFor`.
+   *          The pairs reported are exactly the ones for which
+   *          `Box::intersects(other, strict)` returns `true`. Bounds should
+   *          not be `NaN` and boxes are identified by their index in the
+   *          input array, which should hold less than `2^32` elements.
+   */
+  template <typename CoordinateType>
+  class SweepAndPrune {
+    public:
+
+      /**
+       * @brief - The index of two overlapping boxes, `first < second`.
+       */
+      struct Pair {
+        std::uint32_t first;
+        std::uint32_t second;
+      };
+
+      /**
+       * @brief - Creates a sweep with no boxes.
+       * @param strict - `true` if touching boxes should not be reported as
+       *                 overlapping, see `Box::intersects`.
+       */
+      explicit
+      SweepAndPrune(bool strict = false) noexcept;
+
+      bool
+      isStrict() const noexcept;
+
+      /**
+       * @brief - The number of boxes processed by the last update.
+       */
+      std::size_t
+      size() const noexcept;
+
+      /**
+       * @brief - Discards the order kept from the previous updates.
+       */
+      void
+      clear() noexcept;
+
+      /**
+       * @brief - Finds the overlapping pairs among the input boxes. When the
+       *          number of boxes is the same as for the previous update the
+       *          boxes are assumed to be the same ones, which have moved: the
+       *          previous order is used as a starting point.
+       *          The order of the pairs in the output is unspecified but does
+       *          not depend on the number of threads.
+       * @param boxes - the boxes to process.
+       * @param count - the number of boxes.
+       * @param out - a buffer receiving the overlapping pairs.
+       * @param capacity - the number of pairs `out` can hold. Pairs beyond
+       *                   this are counted but not written.
+       * @param threads - the maximum number of threads to use, `0` to use one
+       *                  per hardware thread and `1` to stay on the calling one.
+       * @return - the total number of overlapping pairs, which might exceed
+       *           `capacity`.
+       */
+      std::size_t
+      update(const Box<CoordinateType>* boxes,
+             std::size_t count,
+             Pair* out,
+             std::size_t capacity,
+             unsigned threads = 0u);
+
+      /**
+       * @brief - Similar to the other overload but `out` is resized to hold
+       *          exactly the overlapping pairs.
+       */
+      void
+      update(const std::vector<Box<CoordinateType>>& boxes,
+             std::vector<Pair>& out,
+             unsigned threads = 0u);
+
+    private:
+
+      /**
+       * @brief - Sorts the input boxes and sweeps them, collecting the pairs
+       *          found for each chunk of boxes in `m_partial`.
+       * @return - the total number of overlapping pairs.
+       */
+      std::size_t
+      process(const Box<CoordinateType>* boxes,
+              std::size_t count,
+              unsigned threads);
+
+      /**
+       * @brief - Restores the order of `m_entries` by increasing left bound,
+       *          with an insertion sort as long as the boxes did not move too
+       *          much and a full sort otherwise.
+       */
+      void
+      sort();
+
+      /**
+       * @brief - Sweeps the sorted boxes in `[begin; end[` against all the
+       *          boxes following them and stores the overlapping pairs in
+       *          `pairs`.
+       */
+      template <bool Strict>
+      void
+      sweepRange(std::size_t begin,
+                 std::size_t end,
+                 std::vector<Pair>& pairs) const;
+
+      /**
+       * @brief - Copies at most `capacity` of the pairs found by the last
+       *          call to `process` to `out`.
+       */
+      void
+      copyPairs(Pair* out, std::size_t capacity) const noexcept;
+
+    private:
+
+      /**
+       * @brief - The left bound of a box along with its index, sorted and
+       *          kept from one update to the next.
+       */
+      struct Entry {
+        CoordinateType min;
+        std::uint32_t id;
+      };
+
+      bool m_strict;
+
+      std::vector<Entry> m_entries;
+
+      /**
+       * @brief - The bounds of the boxes in the order of `m_entries`, which
+       *          keeps the sweep on contiguous memory.
+       */
+      std::vector<CoordinateType> m_left;
+      std::vector<CoordinateType> m_right;
+      std::vector<CoordinateType> m_bottom;
+      std::vector<CoordinateType> m_top;
+
+      /**
+       * @brief - The pairs found by each thread, kept between updates so that
+       *          their memory is reused.
+       */
+      std::vector<std::vector<Pair>> m_partial;
+  };
+
+  using SweepAndPrunef = SweepAndPrune<float>;
+  using SweepAndPrunei = SweepAndPrune<int>;
+
+}
+
+# include "SweepAndPrune.hxx"
+
+#endif    /* SWEEP_AND_PRUNE_HH */
@@ -0,0 +1,389 @@
+#ifndef    SWEEP_AND_PRUNE_HXX
+# define   SWEEP_AND_PRUNE_HXX
+
+# include <algorithm>
+# include <type_traits>
+# include "SweepAndPrune.hh"
+# include "ParallelUtils.hh"
+# include "SimdUtils.hh"
+# include "BoxSoA.hh"
+
+namespace utils {
+  namespace details {
+
+    // The candidates of a box in the sweep are the boxes in a window of the
+    // sorted arrays: they are already known to overlap it along the x axis
+    // when considering the left bound of the candidates. The remaining
+    // conditions of `Box::intersects` are expressed with `boundsCompare`:
+    //  - `qL ? R`, `qB ? T` and `B ? qT` use `<` when `Strict` and `<=`
+    //    otherwise.
+
+    /**
+     * @brief - Finds the first box in `[from; count[` starting after `right`
+     *          (or at `right` when `Strict`) in the sorted left bounds. The
+     *          window is usually short compared to the number of boxes: an
+     *          exponential search keeps the accesses close to `from`.
+     */
+    template <bool Strict, typename CoordinateType>
+    inline
+    std::size_t
+    sweepWindowEnd(const CoordinateType* lefts,
+                   std::size_t from,
+                   std::size_t count,
+                   const CoordinateType right) noexcept
+    {
+      const auto inWindow = [&](std::size_t id) {
+        return Strict ? lefts[id] < right : lefts[id] <= right;
+      };
+
+      // All the boxes before `lo` are in the window and the end is at most
+      // `hi`.
+      std::size_t lo = from;
+      std::size_t hi = from;
+      std::size_t step = 1u;
+
+      while (hi < count && inWindow(hi)) {
+        lo = hi + 1u;
+        hi = std::min(count, hi + step);
+        step *= 2u;
+      }
+
+      while (lo < hi) {
+        const std::size_t mid = lo + (hi - lo) / 2u;
+        if (inWindow(mid)) {
+          lo = mid + 1u;
+        }
+        else {
+          hi = mid;
+        }
+      }
+
+      return lo;
+    }
+
+    template <bool Strict, typename CoordinateType, typename Callback>
+    inline
+    void
+    sweepWindowScalar(const CoordinateType qL,
+                      const CoordinateType qB,
+                      const CoordinateType qT,
+                      const CoordinateType* r,
+                      const CoordinateType* b,
+                      const CoordinateType* t,
+                      std::size_t begin,
+                      std::size_t end,
+                      Callback&& callback)
+    {
+      for (std::size_t id = begin ; id < end ; ++id) {
+        // Evaluated without branches as the outcome is hard to predict.
+        const bool hit =
+          boundsCompare<Strict>(qL, r[id]) &
+          boundsCompare<Strict>(qB, t[id]) &
+          boundsCompare<Strict>(b[id], qT)
+        ;
+
+        if (hit) {
+          callback(id);
+        }
+      }
+    }
+
+    template <bool Strict, typename CoordinateType, typename Callback>
+    inline
+    void
+    sweepWindowKernel(const CoordinateType qL,
+                      const CoordinateType qB,
+                      const CoordinateType qT,
+                      const CoordinateType* r,
+                      const CoordinateType* b,
+                      const CoordinateType* t,
+                      std::size_t begin,
+                      std::size_t end,
+                      Callback&& callback,
+                      std::false_type /*vectorized*/)
+    {
+      sweepWindowScalar<Strict>(qL, qB, qT, r, b, t, begin, end, callback);
+    }
+
+# if defined(MATHS_UTILS_SIMD)
+
+    template <bool Strict, typename CoordinateType, typename Callback>
+    inline
+    void
+    sweepWindowKernel(const CoordinateType qL,
+                      const CoordinateType qB,
+                      const CoordinateType qT,
+                      const CoordinateType* r,
+                      const CoordinateType* b,
+                      const CoordinateType* t,
+                      std::size_t begin,
+                      std::size_t end,
+                      Callback&& callback,
+                      std::true_type /*vectorized*/)
+    {
+      using PackType = typename simd::Pack<CoordinateType>::Type;
+      constexpr std::size_t width = simd::Pack<CoordinateType>::width;
+
+      const PackType vqL = simd::broadcast(qL);
+      const PackType vqB = simd::broadcast(qB);
+      const PackType vqT = simd::broadcast(qT);
+
+      std::size_t id = begin;
+      for ( ; id + width <= end ; id += width) {
+        const PackType hits = simd::maskAnd(
+          boundsComparePack<Strict>(vqL, simd::load(r + id)),
+          simd::maskAnd(
+            boundsComparePack<Strict>(vqB, simd::load(t + id)),
+            boundsComparePack<Strict>(simd::load(b + id), vqT)
+          )
+        );
+
+        // Most candidates do not overlap along the y axis.
+        const int bits = simd::movemask(hits);
+        if (bits != 0) {
+          for (std::size_t lane = 0u ; lane < width ; ++lane) {
+            if ((bits >> lane) & 1) {
+              callback(id + lane);
+            }
+          }
+        }
+      }
+
+      sweepWindowScalar<Strict>(qL, qB, qT, r, b, t, id, end, callback);
+    }
+
+# endif
+
+  }
+
+  template <typename CoordinateType>
+  inline
+  SweepAndPrune<CoordinateType>::SweepAndPrune(bool strict) noexcept:
+    m_strict(strict),
+    m_entries(),
+    m_left(),
+    m_right(),
+    m_bottom(),
+    m_top(),
+    m_partial()
+  {}
+
+  template <typename CoordinateType>
+  inline
+  bool
+  SweepAndPrune<CoordinateType>::isStrict() const noexcept {
+    return m_strict;
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  SweepAndPrune<CoordinateType>::size() const noexcept {
+    return m_entries.size();
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  SweepAndPrune<CoordinateType>::clear() noexcept {
+    m_entries.clear();
+    m_left.clear();
+    m_right.clear();
+    m_bottom.clear();
+    m_top.clear();
+    m_partial.clear();
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  SweepAndPrune<CoordinateType>::update(const Box<CoordinateType>* boxes,
+                                        std::size_t count,
+                                        Pair* out,
+                                        std::size_t capacity,
+                                        unsigned threads)
+  {
+    const std::size_t total = process(boxes, count, threads);
+    copyPairs(out, capacity);
+
+    return total;
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  SweepAndPrune<CoordinateType>::update(const std::vector<Box<CoordinateType>>& boxes,
+                                        std::vector<Pair>& out,
+                                        unsigned threads)
+  {
+    out.resize(process(boxes.data(), boxes.size(), threads));
+    copyPairs(out.data(), out.size());
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  SweepAndPrune<CoordinateType>::process(const Box<CoordinateType>* boxes,
+                                         std::size_t count,
+                                         unsigned threads)
+  {
+    // A different number of boxes means that the previous order does not
+    // describe the same boxes anymore.
+    if (count != m_entries.size()) {
+      m_entries.resize(count);
+      for (std::size_t id = 0u ; id < count ; ++id) {
+        m_entries[id].id = static_cast<std::uint32_t>(id);
+      }
+    }
+
+    parallelFor(
+      count,
+      [&](unsigned /*chunk*/, std::size_t begin, std::size_t end) {
+        for (std::size_t id = begin ; id < end ; ++id) {
+          m_entries[id].min = boxes[m_entries[id].id].getLeftBound();
+        }
+      },
+      threads
+    );
+
+    sort();
+
+    m_left.resize(count);
+    m_right.resize(count);
+    m_bottom.resize(count);
+    m_top.resize(count);
+
+    parallelFor(
+      count,
+      [&](unsigned /*chunk*/, std::size_t begin, std::size_t end) {
+        for (std::size_t id = begin ; id < end ; ++id) {
+          const Box<CoordinateType>& box = boxes[m_entries[id].id];
+
+          m_left[id] = m_entries[id].min;
+          m_right[id] = box.getRightBound();
+          m_bottom[id] = box.getBottomBound();
+          m_top[id] = box.getTopBound();
+        }
+      },
+      threads
+    );
+
+    // Each chunk sweeps the boxes starting in its range against all the
+    // boxes starting after them: chunks are independent and concatenating
+    // their pairs gives the same result as a single sweep.
+    m_partial.resize(threadsFor(count, threads));
+
+    parallelFor(
+      count,
+      [&](unsigned chunk, std::size_t begin, std::size_t end) {
+        if (m_strict) {
+          sweepRange<true>(begin, end, m_partial[chunk]);
+        }
+        else {
+          sweepRange<false>(begin, end, m_partial[chunk]);
+        }
+      },
+      threads
+    );
+
+    std::size_t total = 0u;
+    for (const std::vector<Pair>& pairs : m_partial) {
+      total += pairs.size();
+    }
+
+    return total;
+  }
+
+  template <typename CoordinateType>
+  template <bool Strict>
+  inline
+  void
+  SweepAndPrune<CoordinateType>::sweepRange(std::size_t begin,
+                                            std::size_t end,
+                                            std::vector<Pair>& pairs) const
+  {
+    pairs.clear();
+
+    const std::size_t count = m_entries.size();
+    const CoordinateType* lefts = m_left.data();
+    const CoordinateType* rights = m_right.data();
+    const CoordinateType* bottoms = m_bottom.data();
+    const CoordinateType* tops = m_top.data();
+
+    for (std::size_t id = begin ; id < end ; ++id) {
+      const std::uint32_t boxId = m_entries[id].id;
+
+      // Boxes are sorted by left bound: the candidates of the current box
+      // are the following ones up to the first one starting after its end.
+      const std::size_t windowEnd = details::sweepWindowEnd<Strict>(lefts, id + 1u, count, rights[id]);
+
+      details::sweepWindowKernel<Strict>(
+        lefts[id],
+        bottoms[id],
+        tops[id],
+        rights,
+        bottoms,
+        tops,
+        id + 1u,
+        windowEnd,
+        [&](std::size_t other) {
+          const std::uint32_t otherId = m_entries[other].id;
+          pairs.push_back(Pair{std::min(boxId, otherId), std::max(boxId, otherId)});
+        },
+        std::integral_constant<bool, simd::Pack<CoordinateType>::supported>()
+      );
+    }
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  SweepAndPrune<CoordinateType>::sort() {
+    // Boxes moving a little between two updates only need a few swaps but
+    // the insertion sort is quadratic in the worst case: past a budget of
+    // moves a full sort is faster.
+    const std::size_t budget = 8u * m_entries.size() + 1024u;
+    std::size_t moves = 0u;
+
+    for (std::size_t id = 1u ; id < m_entries.size() ; ++id) {
+      const Entry entry = m_entries[id];
+
+      std::size_t pos = id;
+      while (pos > 0u && entry.min < m_entries[pos - 1u].min) {
+        m_entries[pos] = m_entries[pos - 1u];
+        --pos;
+      }
+
+      m_entries[pos] = entry;
+      moves += id - pos;
+
+      if (moves > budget) {
+        std::sort(
+          m_entries.begin(),
+          m_entries.end(),
+          [](const Entry& lhs, const Entry& rhs) {
+            return lhs.min < rhs.min;
+          }
+        );
+
+        return;
+      }
+    }
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  SweepAndPrune<CoordinateType>::copyPairs(Pair* out, std::size_t capacity) const noexcept {
+    std::size_t written = 0u;
+
+    for (const std::vector<Pair>& pairs : m_partial) {
+      const std::size_t n = std::min(pairs.size(), capacity - written);
+      std::copy_n(pairs.begin(), n, out + written);
+      written += n;
+    }
+  }
+
+}
+
+#endif    /* SWEEP_AND_PRUNE_HXX */
@@ -0,0 +1,183 @@
+#ifndef    TILE_RANGE_HH
+# define   TILE_RANGE_HH
+
+# include <cstddef>
+# include <iterator>
+# include "Box.hh"
+# include "Size.hh"
+# include "Bounds.hh"
+# include "Vector2.hh"
+
+namespace utils {
+
+  /**
+   * @brief - The tiles of a regular grid covered by a box, possibly minus
+   *          the ones covered by another box. Tile `(tx, ty)` spans the area
+   *          `[tx * w; (tx + 1) * w[ x [ty * h; (ty + 1) * h[` for a tile
+   *          size of `(w, h)`.
+   *          The range does not allocate: iterating it enumerates the tiles
+   *          one row after the other starting from the bottom left one,
+   *          skipping the excluded ones as whole spans.
+   *          Use `tilesCovering`, `tilesEntering` and `tilesLeaving` to
+   *          build a range from boxes.
+   */
+  class TileRange {
+    public:
+
+      class Iterator {
+        public:
+
+          using iterator_category = std::forward_iterator_tag;
+          using value_type = Vector2i;
+          using difference_type = std::ptrdiff_t;
+          using pointer = const Vector2i*;
+          using reference = const Vector2i&;
+
+          Iterator() noexcept;
+
+          reference
+          operator*() const noexcept;
+
+          pointer
+          operator->() const noexcept;
+
+          Iterator&
+          operator++() noexcept;
+
+          Iterator
+          operator++(int) noexcept;
+
+          bool
+          operator==(const Iterator& other) const noexcept;
+
+          bool
+          operator!=(const Iterator& other) const noexcept;
+
+        private:
+
+          friend class TileRange;
+
+          Iterator(const TileRange* range, const Vector2i& tile) noexcept;
+
+          /**
+           * @brief - Moves forward from the current position to the first
+           *          tile which is not excluded, or to the end of the range,
+           *          and updates `m_runEnd`.
+           */
+          void
+          skipExcluded() noexcept;
+
+        private:
+
+          const TileRange* m_range;
+          Vector2i m_tile;
+
+          /**
+           * @brief - The end of the run of consecutive tiles on the current
+           *          row: either the right bound of the range or the start of
+           *          the excluded tiles. Moving within a run only increments
+           *          the tile.
+           */
+          int m_runEnd;
+      };
+
+      /**
+       * @brief - Creates the range of the tiles in `tiles` which are not in
+       *          `excluded`. Both bounds contain tile coordinates, the
+       *          maximum being excluded.
+       * @param tiles - the tiles to enumerate.
+       * @param excluded - the tiles to skip, none by default.
+       */
+      explicit
+      TileRange(const Boundsi& tiles,
+                const Boundsi& excluded = Boundsi()) noexcept;
+
+      Iterator
+      begin() const noexcept;
+
+      Iterator
+      end() const noexcept;
+
+      bool
+      empty() const noexcept;
+
+      /**
+       * @brief - The number of tiles in the range, computed without iterating
+       *          over them.
+       */
+      std::size_t
+      size() const noexcept;
+
+      bool
+      contains(const Vector2i& tile) const noexcept;
+
+      /**
+       * @brief - The tiles enumerated before the excluded ones are removed,
+       *          the maximum being excluded.
+       */
+      const Boundsi&
+      getTiles() const noexcept;
+
+    private:
+
+      bool
+      isExcluded(const Vector2i& tile) const noexcept;
+
+    private:
+
+      Boundsi m_tiles;
+
+      /**
+       * @brief - The excluded tiles clipped to `m_tiles`, an empty area when
+       *          they do not overlap.
+       */
+      Boundsi m_excluded;
+  };
+
+  /**
+   * @brief - Computes the tiles overlapped by `box`. An integer box covers
+   *          `w` columns starting at its left bound and `h` rows starting at
+   *          its bottom bound (the same convention as `DirtyRegion`), so
+   *          that boxes with odd dimensions are not truncated. A floating
+   *          point box covers `[left; right[ x [bottom; top[`. Boxes with an
+   *          empty area do not cover any tile. Tile coordinates are clamped
+   *          to `[-2^30 + 1; 2^30 - 1]`.
+   * @param box - the box for which tiles should be computed.
+   * @param tileSize - the dimensions of a tile, strictly positive.
+   * @return - the range of tiles overlapped by `box`.
+   */
+  template <typename CoordinateType>
+  TileRange
+  tilesCovering(const Box<CoordinateType>& box,
+                const Sizei& tileSize) noexcept;
+
+  /**
+   * @brief - Computes the tiles covered by `current` which were not covered
+   *          by `previous`, typically the chunks to load when a view moves.
+   * @param previous - the box before the move.
+   * @param current - the box after the move.
+   * @param tileSize - the dimensions of a tile, strictly positive.
+   * @return - the range of tiles entering the box.
+   */
+  template <typename CoordinateType>
+  TileRange
+  tilesEntering(const Box<CoordinateType>& previous,
+                const Box<CoordinateType>& current,
+                const Sizei& tileSize) noexcept;
+
+  /**
+   * @brief - Computes the tiles covered by `previous` which are not covered
+   *          by `current` anymore, typically the chunks to unload when a view
+   *          moves.
+   */
+  template <typename CoordinateType>
+  TileRange
+  tilesLeaving(const Box<CoordinateType>& previous,
+               const Box<CoordinateType>& current,
+               const Sizei& tileSize) noexcept;
+
+}
+
+# include "TileRange.hxx"
+
+#endif    /* TILE_RANGE_HH */
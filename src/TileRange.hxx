@@ -0,0 +1,294 @@
+#ifndef    TILE_RANGE_HXX
+# define   TILE_RANGE_HXX
+
+# include <cmath>
+# include <cstdint>
+# include <algorithm>
+# include <type_traits>
+# include "TileRange.hh"
+
+namespace utils {
+  namespace details {
+
+    inline
+    std::int64_t
+    floorDiv(std::int64_t value, std::int64_t size) noexcept {
+      const std::int64_t quotient = value / size;
+      return (value % size < 0 ? quotient - 1 : quotient);
+    }
+
+    inline
+    std::int64_t
+    ceilDiv(std::int64_t value, std::int64_t size) noexcept {
+      return -floorDiv(-value, size);
+    }
+
+    /**
+     * @brief - The largest tile coordinate handled: the number of tiles
+     *          along an axis then always fits in an `int`.
+     */
+    constexpr int kMaxTile = (1 << 30) - 1;
+
+    template <typename ValueType>
+    inline
+    int
+    clampTile(ValueType tile) noexcept {
+      return static_cast<int>(
+        std::clamp<ValueType>(tile, static_cast<ValueType>(-kMaxTile), static_cast<ValueType>(kMaxTile))
+      );
+    }
+
+    /**
+     * @brief - The tiles overlapped by `box` as bounds of tile coordinates,
+     *          the maximum being excluded. See `tilesCovering`.
+     */
+    template <typename CoordinateType>
+    inline
+    Boundsi
+    tileBounds(const Box<CoordinateType>& box, const Sizei& tileSize) noexcept {
+      if (!(CoordinateType() < box.w()) || !(CoordinateType() < box.h())) {
+        return Boundsi();
+      }
+
+      if constexpr (std::is_integral<CoordinateType>::value) {
+        // Computed on 64 bits: the right bound of a box might not fit in an
+        // `int` even when its left bound and dimensions do.
+        const std::int64_t left = box.getLeftBound();
+        const std::int64_t bottom = box.getBottomBound();
+
+        return Boundsi(
+          clampTile(floorDiv(left, tileSize.w())),
+          clampTile(floorDiv(bottom, tileSize.h())),
+          clampTile(ceilDiv(left + box.w(), tileSize.w())),
+          clampTile(ceilDiv(bottom + box.h(), tileSize.h()))
+        );
+      }
+      else {
+        const double w = tileSize.w();
+        const double h = tileSize.h();
+
+        return Boundsi(
+          clampTile(std::floor(static_cast<double>(box.getLeftBound()) / w)),
+          clampTile(std::floor(static_cast<double>(box.getBottomBound()) / h)),
+          clampTile(std::ceil(static_cast<double>(box.getRightBound()) / w)),
+          clampTile(std::ceil(static_cast<double>(box.getTopBound()) / h))
+        );
+      }
+    }
+
+  }
+
+  inline
+  TileRange::Iterator::Iterator() noexcept:
+    m_range(nullptr),
+    m_tile(),
+    m_runEnd(0)
+  {}
+
+  inline
+  TileRange::Iterator::Iterator(const TileRange* range, const Vector2i& tile) noexcept:
+    m_range(range),
+    m_tile(tile),
+    m_runEnd(tile.x())
+  {}
+
+  inline
+  TileRange::Iterator::reference
+  TileRange::Iterator::operator*() const noexcept {
+    return m_tile;
+  }
+
+  inline
+  TileRange::Iterator::pointer
+  TileRange::Iterator::operator->() const noexcept {
+    return &m_tile;
+  }
+
+  inline
+  TileRange::Iterator&
+  TileRange::Iterator::operator++() noexcept {
+    ++m_tile.x();
+    if (m_tile.x() >= m_runEnd) {
+      skipExcluded();
+    }
+
+    return *this;
+  }
+
+  inline
+  TileRange::Iterator
+  TileRange::Iterator::operator++(int) noexcept {
+    Iterator out(*this);
+    ++(*this);
+
+    return out;
+  }
+
+  inline
+  bool
+  TileRange::Iterator::operator==(const Iterator& other) const noexcept {
+    return m_range == other.m_range && m_tile == other.m_tile;
+  }
+
+  inline
+  bool
+  TileRange::Iterator::operator!=(const Iterator& other) const noexcept {
+    return !operator==(other);
+  }
+
+  inline
+  void
+  TileRange::Iterator::skipExcluded() noexcept {
+    const Boundsi& tiles = m_range->m_tiles;
+    const Boundsi& excluded = m_range->m_excluded;
+
+    while (m_tile.y() < tiles.getTopBound()) {
+      if (m_tile.x() >= tiles.getRightBound()) {
+        m_tile = Vector2i(tiles.getLeftBound(), m_tile.y() + 1);
+        continue;
+      }
+
+      m_runEnd = tiles.getRightBound();
+
+      const bool excludedRow =
+        m_tile.y() >= excluded.getBottomBound() &&
+        m_tile.y() < excluded.getTopBound()
+      ;
+      if (!excludedRow) {
+        return;
+      }
+
+      if (m_tile.x() < excluded.getLeftBound()) {
+        m_runEnd = excluded.getLeftBound();
+        return;
+      }
+
+      if (m_tile.x() >= excluded.getRightBound()) {
+        return;
+      }
+
+      // The excluded tiles are a rectangle: the rest of its span on this
+      // row can be skipped at once.
+      m_tile.x() = excluded.getRightBound();
+    }
+
+    m_tile = Vector2i(tiles.getLeftBound(), tiles.getTopBound());
+  }
+
+  inline
+  TileRange::TileRange(const Boundsi& tiles,
+                       const Boundsi& excluded) noexcept:
+    m_tiles(tiles),
+    m_excluded()
+  {
+    const Boundsi clipped(
+      std::max(excluded.getLeftBound(), tiles.getLeftBound()),
+      std::max(excluded.getBottomBound(), tiles.getBottomBound()),
+      std::min(excluded.getRightBound(), tiles.getRightBound()),
+      std::min(excluded.getTopBound(), tiles.getTopBound())
+    );
+
+    if (clipped.w() > 0 && clipped.h() > 0) {
+      m_excluded = clipped;
+    }
+  }
+
+  inline
+  TileRange::Iterator
+  TileRange::begin() const noexcept {
+    if (m_tiles.w() <= 0 || m_tiles.h() <= 0) {
+      return end();
+    }
+
+    Iterator it(this, m_tiles.getMin());
+    it.skipExcluded();
+
+    return it;
+  }
+
+  inline
+  TileRange::Iterator
+  TileRange::end() const noexcept {
+    return Iterator(this, Vector2i(m_tiles.getLeftBound(), m_tiles.getTopBound()));
+  }
+
+  inline
+  bool
+  TileRange::empty() const noexcept {
+    return size() == 0u;
+  }
+
+  inline
+  std::size_t
+  TileRange::size() const noexcept {
+    if (m_tiles.w() <= 0 || m_tiles.h() <= 0) {
+      return 0u;
+    }
+
+    const std::int64_t all = static_cast<std::int64_t>(m_tiles.w()) * m_tiles.h();
+    const std::int64_t excluded = static_cast<std::int64_t>(m_excluded.w()) * m_excluded.h();
+
+    return static_cast<std::size_t>(all - excluded);
+  }
+
+  inline
+  bool
+  TileRange::contains(const Vector2i& tile) const noexcept {
+    return
+      tile.x() >= m_tiles.getLeftBound() &&
+      tile.x() < m_tiles.getRightBound() &&
+      tile.y() >= m_tiles.getBottomBound() &&
+      tile.y() < m_tiles.getTopBound() &&
+      !isExcluded(tile)
+    ;
+  }
+
+  inline
+  const Boundsi&
+  TileRange::getTiles() const noexcept {
+    return m_tiles;
+  }
+
+  inline
+  bool
+  TileRange::isExcluded(const Vector2i& tile) const noexcept {
+    return
+      tile.x() >= m_excluded.getLeftBound() &&
+      tile.x() < m_excluded.getRightBound() &&
+      tile.y() >= m_excluded.getBottomBound() &&
+      tile.y() < m_excluded.getTopBound()
+    ;
+  }
+
+  template <typename CoordinateType>
+  inline
+  TileRange
+  tilesCovering(const Box<CoordinateType>& box,
+                const Sizei& tileSize) noexcept
+  {
+    return TileRange(details::tileBounds(box, tileSize));
+  }
+
+  template <typename CoordinateType>
+  inline
+  TileRange
+  tilesEntering(const Box<CoordinateType>& previous,
+                const Box<CoordinateType>& current,
+                const Sizei& tileSize) noexcept
+  {
+    return TileRange(details::tileBounds(current, tileSize), details::tileBounds(previous, tileSize));
+  }
+
+  template <typename CoordinateType>
+  inline
+  TileRange
+  tilesLeaving(const Box<CoordinateType>& previous,
+               const Box<CoordinateType>& current,
+               const Sizei& tileSize) noexcept
+  {
+    return TileRange(details::tileBounds(previous, tileSize), details::tileBounds(current, tileSize));
+  }
+
+}
+
+#endif    /* TILE_RANGE_HXX */
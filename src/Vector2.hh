@@ -1,7 +1,10 @@
 #ifndef    VECTOR2_HH
 # define   VECTOR2_HH
 
+# include <string>
+# include <cstdint>
 # include <iostream>
+# include "PrimitiveLayout.hh"
 
 namespace utils {
 
@@ -9,37 +12,38 @@ namespace utils {
   class Vector2 {
     public:
 
-      explicit
+      explicit constexpr
       Vector2(const CoordinateType& x = CoordinateType(),
               const CoordinateType& y = CoordinateType()) noexcept;
 
-      Vector2(const Vector2<CoordinateType>& other) noexcept;
+      constexpr
+      Vector2(const Vector2<CoordinateType>& other) noexcept = default;
 
-      Vector2<CoordinateType>&
-      operator=(const Vector2<CoordinateType>& other) noexcept;
+      constexpr Vector2<CoordinateType>&
+      operator=(const Vector2<CoordinateType>& other) noexcept = default;
 
-      CoordinateType&
+      constexpr CoordinateType&
       x() noexcept;
 
-      const CoordinateType&
+      constexpr const CoordinateType&
       x() const noexcept;
 
-      void
+      constexpr void
       setX(const CoordinateType& x) noexcept;
 
-      CoordinateType&
+      constexpr CoordinateType&
       y() noexcept;
 
-      const CoordinateType&
+      constexpr const CoordinateType&
       y() const noexcept;
 
-      void
+      constexpr void
       setY(const CoordinateType& y) noexcept;
 
       CoordinateType
       length() const noexcept;
 
-      CoordinateType
+      constexpr CoordinateType
       lengthSquared() const noexcept;
 
       CoordinateType
@@ -48,62 +52,83 @@ namespace utils {
       Vector2<CoordinateType>&
       normalized() noexcept;
 
-      CoordinateType
+      constexpr CoordinateType
       operator*(const Vector2<CoordinateType>& other) const noexcept;
 
-      bool
+      constexpr bool
       operator==(const Vector2<CoordinateType>& other) const noexcept;
 
-      bool
+      constexpr bool
       operator!=(const Vector2<CoordinateType>& other) const noexcept;
 
-      Vector2<CoordinateType>
+      /**
+       * @brief - Compares this vector with `other` using the `Comparison`
+       *          policy (see `ComparisonUtils.hh`) for each coordinate.
+       *          `operator==` uses the `DefaultComparison` of the type.
+       */
+      template <typename Comparison>
+      constexpr bool
+      equals(const Vector2<CoordinateType>& other) const noexcept;
+
+      constexpr Vector2<CoordinateType>
       operator+(const Vector2<CoordinateType>& other) const noexcept;
 
-      Vector2<CoordinateType>&
+      constexpr Vector2<CoordinateType>&
       operator+=(const Vector2<CoordinateType>& other) noexcept;
 
-      Vector2<CoordinateType>
+      constexpr Vector2<CoordinateType>
       operator-(const Vector2<CoordinateType>& other) const noexcept;
 
-      Vector2<CoordinateType>
+      constexpr Vector2<CoordinateType>
       operator-() const noexcept;
 
-      Vector2<CoordinateType>&
+      constexpr Vector2<CoordinateType>&
       operator-=(const Vector2<CoordinateType>& other) noexcept;
 
-      Vector2<CoordinateType>
+      constexpr Vector2<CoordinateType>
       operator*(const CoordinateType& scale) const noexcept;
 
-      Vector2<CoordinateType>&
+      constexpr Vector2<CoordinateType>&
       operator*=(const CoordinateType& scale) noexcept;
 
-      Vector2<CoordinateType>
+      constexpr Vector2<CoordinateType>
       operator/(const CoordinateType& scale) const noexcept;
 
-      Vector2<CoordinateType>&
+      constexpr Vector2<CoordinateType>&
       operator/=(const CoordinateType& scale) noexcept;
 
-      CoordinateType
+      constexpr CoordinateType
       operator^(const Vector2<CoordinateType>& other) const noexcept;
 
       std::string
       toString() const noexcept;
 
+      std::size_t
+      format(char* buffer, std::size_t size) const noexcept;
+
+      std::size_t
+      encode(std::uint8_t* buffer, std::size_t size) const noexcept;
+
       static
-      Vector2<CoordinateType>
+      std::size_t
+      decode(const std::uint8_t* buffer, std::size_t size, Vector2<CoordinateType>& out) noexcept;
+
+      static constexpr std::size_t kEncodedSize = 2u * sizeof(CoordinateType);
+
+      static
+      constexpr Vector2<CoordinateType>
       max() noexcept;
 
       static
-      Vector2<CoordinateType>
+      constexpr Vector2<CoordinateType>
       min() noexcept;
 
       static
-      Vector2<CoordinateType>
+      constexpr Vector2<CoordinateType>
       minmax() noexcept;
 
       static
-      Vector2<CoordinateType>
+      constexpr Vector2<CoordinateType>
       maxmin() noexcept;
 
     private:
@@ -114,6 +139,9 @@ namespace utils {
 
   using Vector2f = Vector2<float>;
   using Vector2i = Vector2<int>;
+
+  static_assert(isFlatPrimitive<Vector2f, float, 2u>, "Vector2f should be made of exactly two floats");
+  static_assert(isFlatPrimitive<Vector2i, int, 2u>, "Vector2i should be made of exactly two ints");
 }
 
 template <typename CoordinateType>
@@ -125,7 +153,7 @@ std::ostream&
 operator<<(const utils::Vector2<CoordinateType>& vec, std::ostream& out) noexcept;
 
 template <typename CoordinateType>
-utils::Vector2<CoordinateType>
+constexpr utils::Vector2<CoordinateType>
 operator*(const CoordinateType& scale, const utils::Vector2<CoordinateType>& vector) noexcept;
 
 # include "Vector2.hxx"
@@ -4,11 +4,13 @@
 # include <cmath>
 # include "Vector2.hh"
 # include "ComparisonUtils.hh"
+# include "FormatUtils.hh"
 
 namespace utils {
 
   template <typename CoordinateType>
   inline
+  constexpr
   Vector2<CoordinateType>::Vector2(const CoordinateType& x,
                                    const CoordinateType& y) noexcept:
     m_x(x),
@@ -17,59 +19,42 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>::Vector2(const Vector2<CoordinateType>& other) noexcept:
-    m_x(other.m_x),
-    m_y(other.m_y)
-  {}
-
-  template <typename CoordinateType>
-  inline
-  Vector2<CoordinateType>&
-  Vector2<CoordinateType>::operator=(const Vector2<CoordinateType>& other) noexcept {
-    m_x = other.x();
-    m_y = other.y();
-
-    return *this;
-  }
-
-  template <typename CoordinateType>
-  inline
-  CoordinateType&
+  constexpr CoordinateType&
   Vector2<CoordinateType>::x() noexcept {
     return m_x;
   }
 
   template <typename CoordinateType>
   inline
-  const CoordinateType&
+  constexpr const CoordinateType&
   Vector2<CoordinateType>::x() const noexcept {
     return m_x;
   }
 
   template <typename CoordinateType>
   inline
-  void
+  constexpr void
   Vector2<CoordinateType>::setX(const CoordinateType& x) noexcept {
     m_x = x;
   }
 
   template <typename CoordinateType>
   inline
-  CoordinateType&
+  constexpr CoordinateType&
   Vector2<CoordinateType>::y() noexcept {
     return m_y;
   }
 
   template <typename CoordinateType>
   inline
-  const CoordinateType&
+  constexpr const CoordinateType&
   Vector2<CoordinateType>::y() const noexcept {
     return m_y;
   }
 
   template <typename CoordinateType>
   inline
-  void
+  constexpr void
   Vector2<CoordinateType>::setY(const CoordinateType& y) noexcept {
     m_y = y;
   }
@@ -78,12 +63,14 @@ namespace utils {
   inline
   CoordinateType
   Vector2<CoordinateType>::length() const noexcept {
-    return std::sqrt(lengthSquared());
+    // Also looks up `sqrt` in the namespace of the coordinate type.
+    using std::sqrt;
+    return sqrt(lengthSquared());
   }
 
   template <typename CoordinateType>
   inline
-  CoordinateType
+  constexpr CoordinateType
   Vector2<CoordinateType>::lengthSquared() const noexcept {
     return m_x * m_x + m_y * m_y;
   }
@@ -110,31 +97,39 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  CoordinateType
+  constexpr CoordinateType
   Vector2<CoordinateType>::operator*(const Vector2<CoordinateType>& other) const noexcept {
     return m_x * other.m_x + m_y * other.m_y;
   }
 
   template <typename CoordinateType>
   inline
-  bool
+  constexpr bool
   Vector2<CoordinateType>::operator==(const Vector2<CoordinateType>& other) const noexcept {
-    return (
-      fuzzyEqual(m_x, other.m_x) &&
-      fuzzyEqual(m_y, other.m_y)
-    );
+    return equals<typename DefaultComparison<CoordinateType>::Type>(other);
   }
 
   template <typename CoordinateType>
   inline
-  bool
+  constexpr bool
   Vector2<CoordinateType>::operator!=(const Vector2<CoordinateType>& other) const noexcept {
     return !operator==(other);
   }
 
+  template <typename CoordinateType>
+  template <typename Comparison>
+  inline
+  constexpr bool
+  Vector2<CoordinateType>::equals(const Vector2<CoordinateType>& other) const noexcept {
+    return (
+      Comparison::equal(m_x, other.m_x) &&
+      Comparison::equal(m_y, other.m_y)
+    );
+  }
+
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>
+  constexpr Vector2<CoordinateType>
   Vector2<CoordinateType>::operator+(const Vector2<CoordinateType>& other) const noexcept {
     Vector2<CoordinateType> sum(*this);
     sum += other;
@@ -143,7 +138,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>&
+  constexpr Vector2<CoordinateType>&
   Vector2<CoordinateType>::operator+=(const Vector2<CoordinateType>& other) noexcept {
     m_x += other.m_x;
     m_y += other.m_y;
@@ -152,7 +147,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>
+  constexpr Vector2<CoordinateType>
   Vector2<CoordinateType>::operator-(const Vector2<CoordinateType>& other) const noexcept {
     Vector2<CoordinateType> diff(*this);
     diff -= other;
@@ -161,16 +156,14 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>
+  constexpr Vector2<CoordinateType>
   Vector2<CoordinateType>::operator-() const noexcept {
-      Vector2<CoordinateType> minus;
-      minus -= (*this);
-      return minus;
+    return Vector2<CoordinateType>(-m_x, -m_y);
   }
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>&
+  constexpr Vector2<CoordinateType>&
   Vector2<CoordinateType>::operator-=(const Vector2<CoordinateType>& other) noexcept {
     m_x -= other.m_x;
     m_y -= other.m_y;
@@ -179,7 +172,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>
+  constexpr Vector2<CoordinateType>
   Vector2<CoordinateType>::operator*(const CoordinateType& scale) const noexcept {
     Vector2<CoordinateType> multiply(*this);
     multiply.m_x *= scale;
@@ -189,7 +182,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>&
+  constexpr Vector2<CoordinateType>&
   Vector2<CoordinateType>::operator*=(const CoordinateType& scale) noexcept {
       m_x *= scale;
       m_y *= scale;
@@ -198,7 +191,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>
+  constexpr Vector2<CoordinateType>
   Vector2<CoordinateType>::operator/(const CoordinateType& scale) const noexcept {
     Vector2<CoordinateType> divide(*this);
     divide.m_x /= scale;
@@ -208,7 +201,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>&
+  constexpr Vector2<CoordinateType>&
   Vector2<CoordinateType>::operator/=(const CoordinateType& scale) noexcept {
     m_x /= scale;
     m_y /= scale;
@@ -217,7 +210,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  CoordinateType
+  constexpr CoordinateType
   Vector2<CoordinateType>::operator^(const Vector2<CoordinateType>& other) const noexcept {
       return m_x * other.m_y - m_y * other.m_x;
   }
@@ -226,12 +219,58 @@ namespace utils {
   inline
   std::string
   Vector2<CoordinateType>::toString() const noexcept {
-    return std::string("[Vector: ") + std::to_string(x()) + ", " + std::to_string(y()) + "]";
+    char buffer[formatBufferSize<CoordinateType>(2u)];
+    return std::string(buffer, format(buffer, sizeof(buffer)));
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  Vector2<CoordinateType>::format(char* buffer, std::size_t size) const noexcept {
+    FormatWriter writer(buffer, size);
+
+    writer.appendText("[Vector: ");
+    writer.appendValue(m_x);
+    writer.appendText(", ");
+    writer.appendValue(m_y);
+    writer.appendText("]");
+
+    return writer.size();
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  Vector2<CoordinateType>::encode(std::uint8_t* buffer, std::size_t size) const noexcept {
+    if (size < kEncodedSize) {
+      return 0u;
+    }
+
+    encodeLittleEndian(buffer, m_x);
+    encodeLittleEndian(buffer + sizeof(CoordinateType), m_y);
+
+    return kEncodedSize;
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  Vector2<CoordinateType>::decode(const std::uint8_t* buffer, std::size_t size, Vector2<CoordinateType>& out) noexcept {
+    if (size < kEncodedSize) {
+      return 0u;
+    }
+
+    out = Vector2<CoordinateType>(
+      decodeLittleEndian<CoordinateType>(buffer),
+      decodeLittleEndian<CoordinateType>(buffer + sizeof(CoordinateType))
+    );
+
+    return kEncodedSize;
   }
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>
+  constexpr Vector2<CoordinateType>
   Vector2<CoordinateType>::max() noexcept {
     return Vector2(
       std::numeric_limits<CoordinateType>::max(),
@@ -241,7 +280,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>
+  constexpr Vector2<CoordinateType>
   Vector2<CoordinateType>::min() noexcept {
     return Vector2(
       std::numeric_limits<CoordinateType>::lowest(),
@@ -251,7 +290,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>
+  constexpr Vector2<CoordinateType>
   Vector2<CoordinateType>::minmax() noexcept {
     return Vector2(
       std::numeric_limits<CoordinateType>::lowest(),
@@ -261,7 +300,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector2<CoordinateType>
+  constexpr Vector2<CoordinateType>
   Vector2<CoordinateType>::maxmin() noexcept {
     return Vector2(
       std::numeric_limits<CoordinateType>::max(),
@@ -275,7 +314,8 @@ template <typename CoordinateType>
 inline
 std::ostream&
 operator<<(std::ostream& out, const utils::Vector2<CoordinateType>& vec) noexcept {
-  out << vec.toString();
+  char buffer[utils::formatBufferSize<CoordinateType>(2u)];
+  out.write(buffer, static_cast<std::streamsize>(vec.format(buffer, sizeof(buffer))));
   return out;
 }
 
@@ -288,7 +328,7 @@ operator<<(const utils::Vector2<CoordinateType>& vec, std::ostream& out) noexcep
 
 template <typename CoordinateType>
 inline
-utils::Vector2<CoordinateType>
+constexpr utils::Vector2<CoordinateType>
 operator*(const CoordinateType& scale, const utils::Vector2<CoordinateType>& vector) noexcept {
   return vector * scale;
 }
@@ -0,0 +1,157 @@
+#ifndef    VECTOR2_BATCH_HH
+# define   VECTOR2_BATCH_HH
+
+# include <vector>
+# include "Vector2.hh"
+# include "AlignedAllocator.hh"
+
+namespace utils {
+
+  /**
+   * @brief - Stores a collection of 2D vectors as a structure of arrays:
+   *          all abscissa are contiguous in memory and so are ordinates.
+   *          This layout allows operations on the whole collection to be
+   *          vectorized (using SSE or AVX when available for `float`) and
+   *          falls back to scalar loops otherwise.
+   *          The semantic of each operation is the same as the one of the
+   *          corresponding method in `Vector2`.
+   *          When two batches are combined, only the first `min(size(),
+   *          other.size())` elements are processed.
+   */
+  template <typename CoordinateType>
+  class Vector2Batch {
+    public:
+
+      /**
+       * @brief - Creates a batch with `size` null vectors.
+       * @param size - the number of elements of the batch.
+       */
+      explicit
+      Vector2Batch(std::size_t size = 0u);
+
+      /**
+       * @brief - Creates a batch holding the same vectors as `vectors`. As
+       *          the layouts differ this requires a copy of the data.
+       * @param vectors - the vectors to copy in the batch.
+       */
+      explicit
+      Vector2Batch(const std::vector<Vector2<CoordinateType>>& vectors);
+
+      std::size_t
+      size() const noexcept;
+
+      bool
+      empty() const noexcept;
+
+      void
+      resize(std::size_t size);
+
+      void
+      reserve(std::size_t size);
+
+      void
+      clear() noexcept;
+
+      void
+      push_back(const Vector2<CoordinateType>& vec);
+
+      /**
+       * @brief - Returns the vector at index `id`. No bound checking is
+       *          performed.
+       */
+      Vector2<CoordinateType>
+      at(std::size_t id) const noexcept;
+
+      void
+      set(std::size_t id, const Vector2<CoordinateType>& vec) noexcept;
+
+      CoordinateType*
+      x() noexcept;
+
+      const CoordinateType*
+      x() const noexcept;
+
+      CoordinateType*
+      y() noexcept;
+
+      const CoordinateType*
+      y() const noexcept;
+
+      /**
+       * @brief - Copies the content of this batch into `out` which is resized
+       *          to match the size of this batch.
+       * @param out - the output vector.
+       */
+      void
+      toVectors(std::vector<Vector2<CoordinateType>>& out) const;
+
+      std::vector<Vector2<CoordinateType>>
+      toVectors() const;
+
+      /**
+       * @brief - Replaces the content of this batch with the input vectors.
+       *          Allows to reuse the allocated storage across frames.
+       * @param vectors - the vectors to copy.
+       */
+      void
+      assign(const std::vector<Vector2<CoordinateType>>& vectors);
+
+      Vector2Batch<CoordinateType>&
+      operator+=(const Vector2Batch<CoordinateType>& other) noexcept;
+
+      Vector2Batch<CoordinateType>&
+      operator-=(const Vector2Batch<CoordinateType>& other) noexcept;
+
+      Vector2Batch<CoordinateType>&
+      operator*=(const CoordinateType& scale) noexcept;
+
+      /**
+       * @brief - Computes the dot product of each vector of `this` batch with
+       *          the vector at the same index in `other`.
+       * @param other - the other batch.
+       * @param out - an array of at least `min(size(), other.size())` values
+       *              receiving the dot products.
+       */
+      void
+      dot(const Vector2Batch<CoordinateType>& other,
+          CoordinateType* out) const noexcept;
+
+      /**
+       * @brief - Similar to `dot` but computes the cross product (see the
+       *          `operator^` of `Vector2`).
+       */
+      void
+      cross(const Vector2Batch<CoordinateType>& other,
+            CoordinateType* out) const noexcept;
+
+      /**
+       * @brief - Computes the length of each vector of the batch.
+       * @param out - an array of at least `size()` values.
+       */
+      void
+      length(CoordinateType* out) const noexcept;
+
+      /**
+       * @brief - Normalizes each vector of the batch. Null vectors are left
+       *          untouched just like `Vector2::normalize` does.
+       * @param lengths - an optional array of at least `size()` values which
+       *                  receives the length of each vector before it was
+       *                  normalized.
+       */
+      void
+      normalize(CoordinateType* lengths = nullptr) noexcept;
+
+    private:
+
+      AlignedVector<CoordinateType> m_x;
+      AlignedVector<CoordinateType> m_y;
+  };
+
+  using Vector2fBatch = Vector2Batch<float>;
+  using Vector2iBatch = Vector2Batch<int>;
+
+}
+
+# include "Vector2Batch.hxx"
+
+#endif    /* VECTOR2_BATCH_HH */
@@ -0,0 +1,442 @@
+#ifndef    VECTOR2_BATCH_HXX
+# define   VECTOR2_BATCH_HXX
+
+# include <cmath>
+# include <limits>
+# include <algorithm>
+# include "Vector2Batch.hh"
+# include "SimdUtils.hh"
+# include "ComparisonUtils.hh"
+
+namespace utils {
+  namespace details {
+
+    // Generic scalar kernels, used for non `float` coordinates. The `float`
+    // overloads below are preferred by the overload resolution and handle
+    // as many elements as possible with vector instructions before falling
+    // back to these for the remaining ones.
+
+    template <typename CoordinateType>
+    inline
+    void
+    addKernel(CoordinateType* dst, const CoordinateType* src, std::size_t start, std::size_t count) noexcept {
+      for (std::size_t id = start ; id < count ; ++id) {
+        dst[id] += src[id];
+      }
+    }
+
+    template <typename CoordinateType>
+    inline
+    void
+    subKernel(CoordinateType* dst, const CoordinateType* src, std::size_t start, std::size_t count) noexcept {
+      for (std::size_t id = start ; id < count ; ++id) {
+        dst[id] -= src[id];
+      }
+    }
+
+    template <typename CoordinateType>
+    inline
+    void
+    scaleKernel(CoordinateType* dst, CoordinateType scale, std::size_t start, std::size_t count) noexcept {
+      for (std::size_t id = start ; id < count ; ++id) {
+        dst[id] *= scale;
+      }
+    }
+
+    template <typename CoordinateType>
+    inline
+    void
+    dotKernel(const CoordinateType* x1, const CoordinateType* y1,
+              const CoordinateType* x2, const CoordinateType* y2,
+              CoordinateType* out,
+              std::size_t start, std::size_t count) noexcept
+    {
+      for (std::size_t id = start ; id < count ; ++id) {
+        out[id] = x1[id] * x2[id] + y1[id] * y2[id];
+      }
+    }
+
+    template <typename CoordinateType>
+    inline
+    void
+    crossKernel(const CoordinateType* x1, const CoordinateType* y1,
+                const CoordinateType* x2, const CoordinateType* y2,
+                CoordinateType* out,
+                std::size_t start, std::size_t count) noexcept
+    {
+      for (std::size_t id = start ; id < count ; ++id) {
+        out[id] = x1[id] * y2[id] - y1[id] * x2[id];
+      }
+    }
+
+    template <typename CoordinateType>
+    inline
+    void
+    lengthKernel(const CoordinateType* x, const CoordinateType* y,
+                 CoordinateType* out,
+                 std::size_t start, std::size_t count) noexcept
+    {
+      for (std::size_t id = start ; id < count ; ++id) {
+        out[id] = std::sqrt(x[id] * x[id] + y[id] * y[id]);
+      }
+    }
+
+    template <typename CoordinateType>
+    inline
+    void
+    normalizeKernel(CoordinateType* x, CoordinateType* y,
+                    CoordinateType* lengths,
+                    std::size_t start, std::size_t count) noexcept
+    {
+      for (std::size_t id = start ; id < count ; ++id) {
+        const CoordinateType l = std::sqrt(x[id] * x[id] + y[id] * y[id]);
+        if (!fuzzyEqual(l, CoordinateType())) {
+          x[id] /= l;
+          y[id] /= l;
+        }
+
+        if (lengths != nullptr) {
+          lengths[id] = l;
+        }
+      }
+    }
+
+# if defined(MATHS_UTILS_SIMD)
+
+    inline
+    void
+    addKernel(float* dst, const float* src, std::size_t start, std::size_t count) noexcept {
+      std::size_t id = start;
+      for ( ; id + simd::kFloatWidth <= count ; id += simd::kFloatWidth) {
+        simd::store(dst + id, simd::add(simd::load(dst + id), simd::load(src + id)));
+      }
+
+      addKernel<float>(dst, src, id, count);
+    }
+
+    inline
+    void
+    subKernel(float* dst, const float* src, std::size_t start, std::size_t count) noexcept {
+      std::size_t id = start;
+      for ( ; id + simd::kFloatWidth <= count ; id += simd::kFloatWidth) {
+        simd::store(dst + id, simd::sub(simd::load(dst + id), simd::load(src + id)));
+      }
+
+      subKernel<float>(dst, src, id, count);
+    }
+
+    inline
+    void
+    scaleKernel(float* dst, float scale, std::size_t start, std::size_t count) noexcept {
+      const simd::FloatPack s = simd::broadcast(scale);
+
+      std::size_t id = start;
+      for ( ; id + simd::kFloatWidth <= count ; id += simd::kFloatWidth) {
+        simd::store(dst + id, simd::mul(simd::load(dst + id), s));
+      }
+
+      scaleKernel<float>(dst, scale, id, count);
+    }
+
+    inline
+    void
+    dotKernel(const float* x1, const float* y1,
+              const float* x2, const float* y2,
+              float* out,
+              std::size_t start, std::size_t count) noexcept
+    {
+      std::size_t id = start;
+      for ( ; id + simd::kFloatWidth <= count ; id += simd::kFloatWidth) {
+        simd::store(
+          out + id,
+          simd::add(
+            simd::mul(simd::load(x1 + id), simd::load(x2 + id)),
+            simd::mul(simd::load(y1 + id), simd::load(y2 + id))
+          )
+        );
+      }
+
+      dotKernel<float>(x1, y1, x2, y2, out, id, count);
+    }
+
+    inline
+    void
+    crossKernel(const float* x1, const float* y1,
+                const float* x2, const float* y2,
+                float* out,
+                std::size_t start, std::size_t count) noexcept
+    {
+      std::size_t id = start;
+      for ( ; id + simd::kFloatWidth <= count ; id += simd::kFloatWidth) {
+        simd::store(
+          out + id,
+          simd::sub(
+            simd::mul(simd::load(x1 + id), simd::load(y2 + id)),
+            simd::mul(simd::load(y1 + id), simd::load(x2 + id))
+          )
+        );
+      }
+
+      crossKernel<float>(x1, y1, x2, y2, out, id, count);
+    }
+
+    inline
+    void
+    lengthKernel(const float* x, const float* y,
+                 float* out,
+                 std::size_t start, std::size_t count) noexcept
+    {
+      std::size_t id = start;
+      for ( ; id + simd::kFloatWidth <= count ; id += simd::kFloatWidth) {
+        const simd::FloatPack vx = simd::load(x + id);
+        const simd::FloatPack vy = simd::load(y + id);
+        simd::store(out + id, simd::sqrt(simd::add(simd::mul(vx, vx), simd::mul(vy, vy))));
+      }
+
+      lengthKernel<float>(x, y, out, id, count);
+    }
+
+    inline
+    void
+    normalizeKernel(float* x, float* y,
+                    float* lengths,
+                    std::size_t start, std::size_t count) noexcept
+    {
+      // `fuzzyEqual(l, 0)` is `l < min()` so vectors whose length is at
+      // least `min()` are normalized and the others are kept as is.
+      const simd::FloatPack threshold = simd::broadcast(std::numeric_limits<float>::min());
+
+      std::size_t id = start;
+      for ( ; id + simd::kFloatWidth <= count ; id += simd::kFloatWidth) {
+        const simd::FloatPack vx = simd::load(x + id);
+        const simd::FloatPack vy = simd::load(y + id);
+        const simd::FloatPack l = simd::sqrt(simd::add(simd::mul(vx, vx), simd::mul(vy, vy)));
+        const simd::FloatPack valid = simd::lessOrEqual(threshold, l);
+
+        simd::store(x + id, simd::select(valid, simd::div(vx, l), vx));
+        simd::store(y + id, simd::select(valid, simd::div(vy, l), vy));
+
+        if (lengths != nullptr) {
+          simd::store(lengths + id, l);
+        }
+      }
+
+      normalizeKernel<float>(x, y, lengths, id, count);
+    }
+
+# endif
+
+  }
+
+  template <typename CoordinateType>
+  inline
+  Vector2Batch<CoordinateType>::Vector2Batch(std::size_t size):
+    m_x(size, CoordinateType()),
+    m_y(size, CoordinateType())
+  {}
+
+  template <typename CoordinateType>
+  inline
+  Vector2Batch<CoordinateType>::Vector2Batch(const std::vector<Vector2<CoordinateType>>& vectors):
+    m_x(),
+    m_y()
+  {
+    assign(vectors);
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  Vector2Batch<CoordinateType>::size() const noexcept {
+    return m_x.size();
+  }
+
+  template <typename CoordinateType>
+  inline
+  bool
+  Vector2Batch<CoordinateType>::empty() const noexcept {
+    return m_x.empty();
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Vector2Batch<CoordinateType>::resize(std::size_t size) {
+    m_x.resize(size, CoordinateType());
+    m_y.resize(size, CoordinateType());
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Vector2Batch<CoordinateType>::reserve(std::size_t size) {
+    m_x.reserve(size);
+    m_y.reserve(size);
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Vector2Batch<CoordinateType>::clear() noexcept {
+    m_x.clear();
+    m_y.clear();
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Vector2Batch<CoordinateType>::push_back(const Vector2<CoordinateType>& vec) {
+    m_x.push_back(vec.x());
+    m_y.push_back(vec.y());
+  }
+
+  template <typename CoordinateType>
+  inline
+  Vector2<CoordinateType>
+  Vector2Batch<CoordinateType>::at(std::size_t id) const noexcept {
+    return Vector2<CoordinateType>(m_x[id], m_y[id]);
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Vector2Batch<CoordinateType>::set(std::size_t id, const Vector2<CoordinateType>& vec) noexcept {
+    m_x[id] = vec.x();
+    m_y[id] = vec.y();
+  }
+
+  template <typename CoordinateType>
+  inline
+  CoordinateType*
+  Vector2Batch<CoordinateType>::x() noexcept {
+    return m_x.data();
+  }
+
+  template <typename CoordinateType>
+  inline
+  const CoordinateType*
+  Vector2Batch<CoordinateType>::x() const noexcept {
+    return m_x.data();
+  }
+
+  template <typename CoordinateType>
+  inline
+  CoordinateType*
+  Vector2Batch<CoordinateType>::y() noexcept {
+    return m_y.data();
+  }
+
+  template <typename CoordinateType>
+  inline
+  const CoordinateType*
+  Vector2Batch<CoordinateType>::y() const noexcept {
+    return m_y.data();
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Vector2Batch<CoordinateType>::toVectors(std::vector<Vector2<CoordinateType>>& out) const {
+    out.resize(size());
+    for (std::size_t id = 0u ; id < out.size() ; ++id) {
+      out[id].x() = m_x[id];
+      out[id].y() = m_y[id];
+    }
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::vector<Vector2<CoordinateType>>
+  Vector2Batch<CoordinateType>::toVectors() const {
+    std::vector<Vector2<CoordinateType>> out;
+    toVectors(out);
+    return out;
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Vector2Batch<CoordinateType>::assign(const std::vector<Vector2<CoordinateType>>& vectors) {
+    m_x.resize(vectors.size());
+    m_y.resize(vectors.size());
+
+    for (std::size_t id = 0u ; id < vectors.size() ; ++id) {
+      m_x[id] = vectors[id].x();
+      m_y[id] = vectors[id].y();
+    }
+  }
+
+  template <typename CoordinateType>
+  inline
+  Vector2Batch<CoordinateType>&
+  Vector2Batch<CoordinateType>::operator+=(const Vector2Batch<CoordinateType>& other) noexcept {
+    const std::size_t count = std::min(size(), other.size());
+    details::addKernel(m_x.data(), other.m_x.data(), 0u, count);
+    details::addKernel(m_y.data(), other.m_y.data(), 0u, count);
+    return *this;
+  }
+
+  template <typename CoordinateType>
+  inline
+  Vector2Batch<CoordinateType>&
+  Vector2Batch<CoordinateType>::operator-=(const Vector2Batch<CoordinateType>& other) noexcept {
+    const std::size_t count = std::min(size(), other.size());
+    details::subKernel(m_x.data(), other.m_x.data(), 0u, count);
+    details::subKernel(m_y.data(), other.m_y.data(), 0u, count);
+    return *this;
+  }
+
+  template <typename CoordinateType>
+  inline
+  Vector2Batch<CoordinateType>&
+  Vector2Batch<CoordinateType>::operator*=(const CoordinateType& scale) noexcept {
+    details::scaleKernel(m_x.data(), scale, 0u, size());
+    details::scaleKernel(m_y.data(), scale, 0u, size());
+    return *this;
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Vector2Batch<CoordinateType>::dot(const Vector2Batch<CoordinateType>& other,
+                                    CoordinateType* out) const noexcept
+  {
+    details::dotKernel(
+      m_x.data(), m_y.data(),
+      other.m_x.data(), other.m_y.data(),
+      out,
+      0u, std::min(size(), other.size())
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Vector2Batch<CoordinateType>::cross(const Vector2Batch<CoordinateType>& other,
+                                      CoordinateType* out) const noexcept
+  {
+    details::crossKernel(
+      m_x.data(), m_y.data(),
+      other.m_x.data(), other.m_y.data(),
+      out,
+      0u, std::min(size(), other.size())
+    );
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Vector2Batch<CoordinateType>::length(CoordinateType* out) const noexcept {
+    details::lengthKernel(m_x.data(), m_y.data(), out, 0u, size());
+  }
+
+  template <typename CoordinateType>
+  inline
+  void
+  Vector2Batch<CoordinateType>::normalize(CoordinateType* lengths) noexcept {
+    details::normalizeKernel(m_x.data(), m_y.data(), lengths, 0u, size());
+  }
+
+}
+
+#endif    /* VECTOR2_BATCH_HXX */
@@ -1,7 +1,10 @@
 #ifndef    VECTOR_3_HH
 # define   VECTOR_3_HH
 
+# include <string>
+# include <cstdint>
 # include <iostream>
+# include "PrimitiveLayout.hh"
 
 namespace utils {
 
@@ -9,47 +12,48 @@ namespace utils {
   class Vector3 {
     public:
 
-      explicit
+      explicit constexpr
       Vector3(const CoordinateType& x = CoordinateType(),
               const CoordinateType& y = CoordinateType(),
               const CoordinateType& z = CoordinateType()) noexcept;
 
-      Vector3(const Vector3<CoordinateType>& other) noexcept;
+      constexpr
+      Vector3(const Vector3<CoordinateType>& other) noexcept = default;
 
-      Vector3<CoordinateType>&
-      operator=(const Vector3<CoordinateType>& other) noexcept;
+      constexpr Vector3<CoordinateType>&
+      operator=(const Vector3<CoordinateType>& other) noexcept = default;
 
-      CoordinateType&
+      constexpr CoordinateType&
       x() noexcept;
 
-      const CoordinateType&
+      constexpr const CoordinateType&
       x() const noexcept;
 
-      void
+      constexpr void
       setX(const CoordinateType& x) noexcept;
 
-      CoordinateType&
+      constexpr CoordinateType&
       y() noexcept;
 
-      const CoordinateType&
+      constexpr const CoordinateType&
       y() const noexcept;
 
-      void
+      constexpr void
       setY(const CoordinateType& y) noexcept;
 
-      CoordinateType&
+      constexpr CoordinateType&
       z() noexcept;
 
-      const CoordinateType&
+      constexpr const CoordinateType&
       z() const noexcept;
 
-      void
+      constexpr void
       setZ(const CoordinateType& z) noexcept;
 
       CoordinateType
       length() const noexcept;
 
-      CoordinateType
+      constexpr CoordinateType
       lengthSquared() const noexcept;
 
       CoordinateType
@@ -58,54 +62,75 @@ namespace utils {
       Vector3<CoordinateType>&
       normalized() noexcept;
 
-      CoordinateType
+      constexpr CoordinateType
       operator*(const Vector3<CoordinateType>& other) const noexcept;
 
-      bool
+      constexpr bool
       operator==(const Vector3<CoordinateType>& other) const noexcept;
 
-      bool
+      constexpr bool
       operator!=(const Vector3<CoordinateType>& other) const noexcept;
 
-      Vector3<CoordinateType>
+      /**
+       * @brief - Compares this vector with `other` using the `Comparison`
+       *          policy (see `ComparisonUtils.hh`) for each coordinate.
+       *          `operator==` uses the `DefaultComparison` of the type.
+       */
+      template <typename Comparison>
+      constexpr bool
+      equals(const Vector3<CoordinateType>& other) const noexcept;
+
+      constexpr Vector3<CoordinateType>
       operator+(const Vector3<CoordinateType>& other) const noexcept;
 
-      Vector3<CoordinateType>&
+      constexpr Vector3<CoordinateType>&
       operator+=(const Vector3<CoordinateType>& other) noexcept;
 
-      Vector3<CoordinateType>
+      constexpr Vector3<CoordinateType>
       operator-(const Vector3<CoordinateType>& other) const noexcept;
 
-      Vector3<CoordinateType>
+      constexpr Vector3<CoordinateType>
       operator-() const noexcept;
 
-      Vector3<CoordinateType>&
+      constexpr Vector3<CoordinateType>&
       operator-=(const Vector3<CoordinateType>& other) noexcept;
 
-      Vector3<CoordinateType>
+      constexpr Vector3<CoordinateType>
       operator*(const CoordinateType& scale) const noexcept;
 
-      Vector3<CoordinateType>&
+      constexpr Vector3<CoordinateType>&
       operator*=(const CoordinateType& scale) noexcept;
 
-      Vector3<CoordinateType>
+      constexpr Vector3<CoordinateType>
       operator/(const CoordinateType& scale) const noexcept;
 
-      Vector3<CoordinateType>&
+      constexpr Vector3<CoordinateType>&
       operator/=(const CoordinateType& scale) noexcept;
 
-      Vector3<CoordinateType>
+      constexpr Vector3<CoordinateType>
       operator^(const Vector3<CoordinateType>& other) const noexcept;
 
       std::string
       toString() const noexcept;
 
+      std::size_t
+      format(char* buffer, std::size_t size) const noexcept;
+
+      std::size_t
+      encode(std::uint8_t* buffer, std::size_t size) const noexcept;
+
       static
-      Vector3<CoordinateType>
+      std::size_t
+      decode(const std::uint8_t* buffer, std::size_t size, Vector3<CoordinateType>& out) noexcept;
+
+      static constexpr std::size_t kEncodedSize = 3u * sizeof(CoordinateType);
+
+      static
+      constexpr Vector3<CoordinateType>
       max() noexcept;
 
       static
-      Vector3<CoordinateType>
+      constexpr Vector3<CoordinateType>
       min() noexcept;
 
     private:
@@ -117,6 +142,9 @@ namespace utils {
 
   using Vector3f = Vector3<float>;
   using Vector3i = Vector3<int>;
+
+  static_assert(isFlatPrimitive<Vector3f, float, 3u>, "Vector3f should be made of exactly three floats");
+  static_assert(isFlatPrimitive<Vector3i, int, 3u>, "Vector3i should be made of exactly three ints");
 }
 
 template <typename CoordinateType>
@@ -128,7 +156,7 @@ std::ostream&
 operator<<(const utils::Vector3<CoordinateType>& vec, std::ostream& out) noexcept;
 
 template <typename CoordinateType>
-utils::Vector3<CoordinateType>
+constexpr utils::Vector3<CoordinateType>
 operator*(const CoordinateType& scale, const utils::Vector3<CoordinateType>& vector) noexcept;
 
 # include "Vector3.hxx"
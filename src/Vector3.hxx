@@ -3,12 +3,14 @@
 
 # include <cmath>
 # include "Vector3.hh"
-# include <maths_utils/ComparisonUtils.hh>
+# include "ComparisonUtils.hh"
+# include "FormatUtils.hh"
 
 namespace utils {
 
   template <typename CoordinateType>
   inline
+  constexpr
   Vector3<CoordinateType>::Vector3(const CoordinateType& x,
                                    const CoordinateType& y,
                                    const CoordinateType& z) noexcept:
@@ -19,82 +21,63 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector3<CoordinateType>::Vector3(const Vector3<CoordinateType>& other) noexcept:
-    m_x(other.m_x),
-    m_y(other.m_y),
-    m_z(other.m_z)
-  {}
-
-  template <typename CoordinateType>
-  inline
-  Vector3<CoordinateType>&
-  Vector3<CoordinateType>::operator=(const Vector3<CoordinateType>& other) noexcept {
-    m_x = other.x();
-    m_y = other.y();
-    m_z = other.z();
-
-    return *this;
-  }
-
-  template <typename CoordinateType>
-  inline
-  CoordinateType&
+  constexpr CoordinateType&
   Vector3<CoordinateType>::x() noexcept {
     return m_x;
   }
 
   template <typename CoordinateType>
   inline
-  const CoordinateType&
+  constexpr const CoordinateType&
   Vector3<CoordinateType>::x() const noexcept {
     return m_x;
   }
 
   template <typename CoordinateType>
   inline
-  void
+  constexpr void
   Vector3<CoordinateType>::setX(const CoordinateType& x) noexcept {
     m_x = x;
   }
 
   template <typename CoordinateType>
   inline
-  CoordinateType&
+  constexpr CoordinateType&
   Vector3<CoordinateType>::y() noexcept {
     return m_y;
   }
 
   template <typename CoordinateType>
   inline
-  const CoordinateType&
+  constexpr const CoordinateType&
   Vector3<CoordinateType>::y() const noexcept {
     return m_y;
   }
 
   template <typename CoordinateType>
   inline
-  void
+  constexpr void
   Vector3<CoordinateType>::setY(const CoordinateType& y) noexcept {
     m_y = y;
   }
 
   template <typename CoordinateType>
   inline
-  CoordinateType&
+  constexpr CoordinateType&
   Vector3<CoordinateType>::z() noexcept {
     return m_z;
   }
 
   template <typename CoordinateType>
   inline
-  const CoordinateType&
+  constexpr const CoordinateType&
   Vector3<CoordinateType>::z() const noexcept {
     return m_z;
   }
 
   template <typename CoordinateType>
   inline
-  void
+  constexpr void
   Vector3<CoordinateType>::setZ(const CoordinateType& z) noexcept {
     m_z = z;
   }
@@ -103,12 +86,14 @@ namespace utils {
   inline
   CoordinateType
   Vector3<CoordinateType>::length() const noexcept {
-    return std::sqrt(lengthSquared());
+    // Also looks up `sqrt` in the namespace of the coordinate type.
+    using std::sqrt;
+    return sqrt(lengthSquared());
   }
 
   template <typename CoordinateType>
   inline
-  CoordinateType
+  constexpr CoordinateType
   Vector3<CoordinateType>::lengthSquared() const noexcept {
     return m_x * m_x + m_y * m_y + m_z * m_z;
   }
@@ -136,32 +121,40 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  CoordinateType
+  constexpr CoordinateType
   Vector3<CoordinateType>::operator*(const Vector3<CoordinateType>& other) const noexcept {
     return m_x * other.m_x + m_y * other.m_y + m_z * other.m_z;
   }
 
   template <typename CoordinateType>
   inline
-  bool
+  constexpr bool
   Vector3<CoordinateType>::operator==(const Vector3<CoordinateType>& other) const noexcept {
-    return (
-      fuzzyEqual(m_x, other.m_x) &&
-      fuzzyEqual(m_y, other.m_y) &&
-      fuzzyEqual(m_z, other.m_z)
-    );
+    return equals<typename DefaultComparison<CoordinateType>::Type>(other);
   }
 
   template <typename CoordinateType>
   inline
-  bool
+  constexpr bool
   Vector3<CoordinateType>::operator!=(const Vector3<CoordinateType>& other) const noexcept {
     return !operator==(other);
   }
 
+  template <typename CoordinateType>
+  template <typename Comparison>
+  inline
+  constexpr bool
+  Vector3<CoordinateType>::equals(const Vector3<CoordinateType>& other) const noexcept {
+    return (
+      Comparison::equal(m_x, other.m_x) &&
+      Comparison::equal(m_y, other.m_y) &&
+      Comparison::equal(m_z, other.m_z)
+    );
+  }
+
   template <typename CoordinateType>
   inline
-  Vector3<CoordinateType>
+  constexpr Vector3<CoordinateType>
   Vector3<CoordinateType>::operator+(const Vector3<CoordinateType>& other) const noexcept {
     Vector3<CoordinateType> sum(*this);
     sum += other;
@@ -170,7 +163,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector3<CoordinateType>&
+  constexpr Vector3<CoordinateType>&
   Vector3<CoordinateType>::operator+=(const Vector3<CoordinateType>& other) noexcept {
     m_x += other.m_x;
     m_y += other.m_y;
@@ -180,7 +173,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector3<CoordinateType>
+  constexpr Vector3<CoordinateType>
   Vector3<CoordinateType>::operator-(const Vector3<CoordinateType>& other) const noexcept {
     Vector3<CoordinateType> diff(*this);
     diff -= other;
@@ -189,16 +182,14 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector3<CoordinateType>
+  constexpr Vector3<CoordinateType>
   Vector3<CoordinateType>::operator-() const noexcept {
-      Vector3<CoordinateType> minus;
-      minus -= (*this);
-      return minus;
+    return Vector3<CoordinateType>(-m_x, -m_y, -m_z);
   }
 
   template <typename CoordinateType>
   inline
-  Vector3<CoordinateType>&
+  constexpr Vector3<CoordinateType>&
   Vector3<CoordinateType>::operator-=(const Vector3<CoordinateType>& other) noexcept {
     m_x -= other.m_x;
     m_y -= other.m_y;
@@ -208,7 +199,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector3<CoordinateType>
+  constexpr Vector3<CoordinateType>
   Vector3<CoordinateType>::operator*(const CoordinateType& scale) const noexcept {
     Vector3<CoordinateType> multiply(*this);
     multiply.m_x *= scale;
@@ -219,16 +210,17 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector3<CoordinateType>&
+  constexpr Vector3<CoordinateType>&
   Vector3<CoordinateType>::operator*=(const CoordinateType& scale) noexcept {
-      m_x *= scale;
-      m_y *= scale;
-      return *this;
+    m_x *= scale;
+    m_y *= scale;
+    m_z *= scale;
+    return *this;
   }
 
   template <typename CoordinateType>
   inline
-  Vector3<CoordinateType>
+  constexpr Vector3<CoordinateType>
   Vector3<CoordinateType>::operator/(const CoordinateType& scale) const noexcept {
     Vector3<CoordinateType> divide(*this);
     divide.m_x /= scale;
@@ -239,7 +231,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector3<CoordinateType>&
+  constexpr Vector3<CoordinateType>&
   Vector3<CoordinateType>::operator/=(const CoordinateType& scale) noexcept {
     m_x /= scale;
     m_y /= scale;
@@ -249,7 +241,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector3<CoordinateType>
+  constexpr Vector3<CoordinateType>
   Vector3<CoordinateType>::operator^(const Vector3<CoordinateType>& other) const noexcept {
     return Vector3<CoordinateType>(
       y() * other.z() - z() * other.y(),
@@ -262,12 +254,62 @@ namespace utils {
   inline
   std::string
   Vector3<CoordinateType>::toString() const noexcept {
-    return std::string("[Vector: ") + std::to_string(x()) + ", " + std::to_string(y()) + ", " + std::to_string(z()) + "]";
+    char buffer[formatBufferSize<CoordinateType>(3u)];
+    return std::string(buffer, format(buffer, sizeof(buffer)));
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  Vector3<CoordinateType>::format(char* buffer, std::size_t size) const noexcept {
+    FormatWriter writer(buffer, size);
+
+    writer.appendText("[Vector: ");
+    writer.appendValue(m_x);
+    writer.appendText(", ");
+    writer.appendValue(m_y);
+    writer.appendText(", ");
+    writer.appendValue(m_z);
+    writer.appendText("]");
+
+    return writer.size();
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  Vector3<CoordinateType>::encode(std::uint8_t* buffer, std::size_t size) const noexcept {
+    if (size < kEncodedSize) {
+      return 0u;
+    }
+
+    encodeLittleEndian(buffer, m_x);
+    encodeLittleEndian(buffer + sizeof(CoordinateType), m_y);
+    encodeLittleEndian(buffer + 2u * sizeof(CoordinateType), m_z);
+
+    return kEncodedSize;
+  }
+
+  template <typename CoordinateType>
+  inline
+  std::size_t
+  Vector3<CoordinateType>::decode(const std::uint8_t* buffer, std::size_t size, Vector3<CoordinateType>& out) noexcept {
+    if (size < kEncodedSize) {
+      return 0u;
+    }
+
+    out = Vector3<CoordinateType>(
+      decodeLittleEndian<CoordinateType>(buffer),
+      decodeLittleEndian<CoordinateType>(buffer + sizeof(CoordinateType)),
+      decodeLittleEndian<CoordinateType>(buffer + 2u * sizeof(CoordinateType))
+    );
+
+    return kEncodedSize;
   }
 
   template <typename CoordinateType>
   inline
-  Vector3<CoordinateType>
+  constexpr Vector3<CoordinateType>
   Vector3<CoordinateType>::max() noexcept {
     return Vector3(
       std::numeric_limits<CoordinateType>::max(),
@@ -278,7 +320,7 @@ namespace utils {
 
   template <typename CoordinateType>
   inline
-  Vector3<CoordinateType>
+  constexpr Vector3<CoordinateType>
   Vector3<CoordinateType>::min() noexcept {
     return Vector3(
       std::numeric_limits<CoordinateType>::lowest(),
@@ -293,7 +335,8 @@ template <typename CoordinateType>
 inline
 std::ostream&
 operator<<(std::ostream& out, const utils::Vector3<CoordinateType>& vec) noexcept {
-  out << vec.toString();
+  char buffer[utils::formatBufferSize<CoordinateType>(3u)];
+  out.write(buffer, static_cast<std::streamsize>(vec.format(buffer, sizeof(buffer))));
   return out;
 }
 
@@ -306,7 +349,7 @@ operator<<(const utils::Vector3<CoordinateType>& vec, std::ostream& out) noexcep
 
 template <typename CoordinateType>
 inline
-utils::Vector3<CoordinateType>
+constexpr utils::Vector3<CoordinateType>
 operator*(const CoordinateType& scale, const utils::Vector3<CoordinateType>& vector) noexcept {
   return vector * scale;
 }
@@ -0,0 +1,326 @@
+#ifndef    VECTOR_EXPRESSION_HH
+# define   VECTOR_EXPRESSION_HH
+
+# include <limits>
+# include <cstddef>
+# include <type_traits>
+# include "Vector2.hh"
+# include "Vector3.hh"
+# include "Vector2Batch.hh"
+# include "SimdUtils.hh"
+
+namespace utils {
+
+  /**
+   * @brief - Opt-in expression templates for vector arithmetic. Operands
+   *          wrapped with `lazy` build a tree of operations instead of
+   *          computing intermediate vectors: an expression such as
+   *          `lazy(a) + lazy(b) * s - lazy(c)` is computed coordinate by
+   *          coordinate in a single pass by `evaluate` or `assign`.
+   *          This matters mostly for batches where each operation of the
+   *          regular API is a pass over the whole batch: the fused version
+   *          reads each input once and writes the output once, using SSE or
+   *          AVX for `float` coordinates when available.
+   *          Expressions only support coordinate-wise operations (sum,
+   *          difference, negation and scaling) which makes it safe to assign
+   *          an expression to one of its operands. Plain vectors combined
+   *          with an expression (e.g. `lazy(a) + b`) are wrapped implicitly
+   *          and become leaves of the tree, but a sub-expression written
+   *          without `lazy` (e.g. `lazy(a) + (b + c)`) is still computed
+   *          eagerly by the regular operators before being captured.
+   *          Vectors are captured by value but batches by reference: an
+   *          expression should not outlive the batches it uses, which is
+   *          the case when it is evaluated in the statement building it.
+   */
+  namespace expr {
+
+    /**
+     * @brief - The number of elements of expressions which do not involve
+     *          any batch: their value is the same for all elements.
+     */
+    constexpr std::size_t kBroadcast = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * @brief - Base of all the nodes of an expression. Each node provides:
+     *            - `ValueType` and `kDimension`: the coordinate type and the
+     *              number of coordinates (2 or 3).
+     *            - `size()`: the number of elements of the expression.
+     *            - `eval<Axis>(id)`: the coordinate `Axis` of the element
+     *              `id`.
+     *            - `evalPack<Axis>(id)`: the same for the `simd::kFloatWidth`
+     *              elements starting at `id`, only for `float` values.
+     */
+    template <typename Derived>
+    struct Expression {
+      constexpr const Derived&
+      derived() const noexcept {
+        return static_cast<const Derived&>(*this);
+      }
+    };
+
+    template <typename CoordinateType, std::size_t Dimension>
+    class VectorLeaf: public Expression<VectorLeaf<CoordinateType, Dimension>> {
+      public:
+
+        using ValueType = CoordinateType;
+        static constexpr std::size_t kDimension = Dimension;
+
+        explicit constexpr
+        VectorLeaf(const Vector2<CoordinateType>& vec) noexcept;
+
+        explicit constexpr
+        VectorLeaf(const Vector3<CoordinateType>& vec) noexcept;
+
+        constexpr std::size_t
+        size() const noexcept;
+
+        template <std::size_t Axis>
+        constexpr CoordinateType
+        eval(std::size_t id) const noexcept;
+
+# if defined(MATHS_UTILS_SIMD)
+        template <std::size_t Axis>
+        simd::FloatPack
+        evalPack(std::size_t id) const noexcept;
+# endif
+
+      private:
+
+        CoordinateType m_coords[Dimension];
+    };
+
+    template <typename CoordinateType>
+    class BatchLeaf: public Expression<BatchLeaf<CoordinateType>> {
+      public:
+
+        using ValueType = CoordinateType;
+        static constexpr std::size_t kDimension = 2u;
+
+        explicit
+        BatchLeaf(const Vector2Batch<CoordinateType>& batch) noexcept;
+
+        std::size_t
+        size() const noexcept;
+
+        template <std::size_t Axis>
+        CoordinateType
+        eval(std::size_t id) const noexcept;
+
+# if defined(MATHS_UTILS_SIMD)
+        template <std::size_t Axis>
+        simd::FloatPack
+        evalPack(std::size_t id) const noexcept;
+# endif
+
+      private:
+
+        const CoordinateType* m_x;
+        const CoordinateType* m_y;
+        std::size_t m_size;
+    };
+
+    /**
+     * @brief - A coordinate-wise binary operation: `Operation` provides a
+     *          static `apply` for scalars and `applyPack` for packs.
+     */
+    template <typename Operation, typename Lhs, typename Rhs>
+    class Binary: public Expression<Binary<Operation, Lhs, Rhs>> {
+      public:
+
+        static_assert(
+          std::is_same<typename Lhs::ValueType, typename Rhs::ValueType>::value,
+          "Expressions can only combine vectors with the same coordinate type"
+        );
+        static_assert(
+          Lhs::kDimension == Rhs::kDimension,
+          "Expressions can only combine vectors with the same dimension"
+        );
+
+        using ValueType = typename Lhs::ValueType;
+        static constexpr std::size_t kDimension = Lhs::kDimension;
+
+        constexpr
+        Binary(const Lhs& lhs, const Rhs& rhs) noexcept;
+
+        constexpr std::size_t
+        size() const noexcept;
+
+        template <std::size_t Axis>
+        constexpr ValueType
+        eval(std::size_t id) const noexcept;
+
+# if defined(MATHS_UTILS_SIMD)
+        template <std::size_t Axis>
+        simd::FloatPack
+        evalPack(std::size_t id) const noexcept;
+# endif
+
+      private:
+
+        Lhs m_lhs;
+        Rhs m_rhs;
+    };
+
+    /**
+     * @brief - Multiplies (or divides when `Divide` is `true`) each
+     *          coordinate of an expression by a scalar.
+     */
+    template <typename Operand, bool Divide>
+    class Scale: public Expression<Scale<Operand, Divide>> {
+      public:
+
+        using ValueType = typename Operand::ValueType;
+        static constexpr std::size_t kDimension = Operand::kDimension;
+
+        constexpr
+        Scale(const Operand& operand, const ValueType& scale) noexcept;
+
+        constexpr std::size_t
+        size() const noexcept;
+
+        template <std::size_t Axis>
+        constexpr ValueType
+        eval(std::size_t id) const noexcept;
+
+# if defined(MATHS_UTILS_SIMD)
+        template <std::size_t Axis>
+        simd::FloatPack
+        evalPack(std::size_t id) const noexcept;
+# endif
+
+      private:
+
+        Operand m_operand;
+        ValueType m_scale;
+    };
+
+    template <typename Operand>
+    class Negate: public Expression<Negate<Operand>> {
+      public:
+
+        using ValueType = typename Operand::ValueType;
+        static constexpr std::size_t kDimension = Operand::kDimension;
+
+        explicit constexpr
+        Negate(const Operand& operand) noexcept;
+
+        constexpr std::size_t
+        size() const noexcept;
+
+        template <std::size_t Axis>
+        constexpr ValueType
+        eval(std::size_t id) const noexcept;
+
+# if defined(MATHS_UTILS_SIMD)
+        template <std::size_t Axis>
+        simd::FloatPack
+        evalPack(std::size_t id) const noexcept;
+# endif
+
+      private:
+
+        Operand m_operand;
+    };
+
+    struct AddOperation;
+    struct SubOperation;
+
+    template <typename Lhs, typename Rhs>
+    constexpr Binary<AddOperation, Lhs, Rhs>
+    operator+(const Expression<Lhs>& lhs, const Expression<Rhs>& rhs) noexcept;
+
+    template <typename Lhs, typename Rhs>
+    constexpr Binary<SubOperation, Lhs, Rhs>
+    operator-(const Expression<Lhs>& lhs, const Expression<Rhs>& rhs) noexcept;
+
+    template <typename Operand>
+    constexpr Negate<Operand>
+    operator-(const Expression<Operand>& operand) noexcept;
+
+    template <typename Operand>
+    constexpr Scale<Operand, false>
+    operator*(const Expression<Operand>& operand, const typename Operand::ValueType& scale) noexcept;
+
+    template <typename Operand>
+    constexpr Scale<Operand, false>
+    operator*(const typename Operand::ValueType& scale, const Expression<Operand>& operand) noexcept;
+
+    template <typename Operand>
+    constexpr Scale<Operand, true>
+    operator/(const Expression<Operand>& operand, const typename Operand::ValueType& scale) noexcept;
+
+    /**
+     * @brief - Mixed operations with vectors which are not wrapped: they
+     *          are captured as leaves of the expression.
+     */
+    template <typename Lhs, typename CoordinateType>
+    constexpr Binary<AddOperation, Lhs, VectorLeaf<CoordinateType, 2u>>
+    operator+(const Expression<Lhs>& lhs, const Vector2<CoordinateType>& rhs) noexcept;
+
+    template <typename Rhs, typename CoordinateType>
+    constexpr Binary<AddOperation, VectorLeaf<CoordinateType, 2u>, Rhs>
+    operator+(const Vector2<CoordinateType>& lhs, const Expression<Rhs>& rhs) noexcept;
+
+    template <typename Lhs, typename CoordinateType>
+    constexpr Binary<SubOperation, Lhs, VectorLeaf<CoordinateType, 2u>>
+    operator-(const Expression<Lhs>& lhs, const Vector2<CoordinateType>& rhs) noexcept;
+
+    template <typename Rhs, typename CoordinateType>
+    constexpr Binary<SubOperation, VectorLeaf<CoordinateType, 2u>, Rhs>
+    operator-(const Vector2<CoordinateType>& lhs, const Expression<Rhs>& rhs) noexcept;
+
+    template <typename Lhs, typename CoordinateType>
+    constexpr Binary<AddOperation, Lhs, VectorLeaf<CoordinateType, 3u>>
+    operator+(const Expression<Lhs>& lhs, const Vector3<CoordinateType>& rhs) noexcept;
+
+    template <typename Rhs, typename CoordinateType>
+    constexpr Binary<AddOperation, VectorLeaf<CoordinateType, 3u>, Rhs>
+    operator+(const Vector3<CoordinateType>& lhs, const Expression<Rhs>& rhs) noexcept;
+
+    template <typename Lhs, typename CoordinateType>
+    constexpr Binary<SubOperation, Lhs, VectorLeaf<CoordinateType, 3u>>
+    operator-(const Expression<Lhs>& lhs, const Vector3<CoordinateType>& rhs) noexcept;
+
+    template <typename Rhs, typename CoordinateType>
+    constexpr Binary<SubOperation, VectorLeaf<CoordinateType, 3u>, Rhs>
+    operator-(const Vector3<CoordinateType>& lhs, const Expression<Rhs>& rhs) noexcept;
+
+  }
+
+  template <typename CoordinateType>
+  constexpr expr::VectorLeaf<CoordinateType, 2u>
+  lazy(const Vector2<CoordinateType>& vec) noexcept;
+
+  template <typename CoordinateType>
+  constexpr expr::VectorLeaf<CoordinateType, 3u>
+  lazy(const Vector3<CoordinateType>& vec) noexcept;
+
+  template <typename CoordinateType>
+  expr::BatchLeaf<CoordinateType>
+  lazy(const Vector2Batch<CoordinateType>& batch) noexcept;
+
+  /**
+   * @brief - Computes the value of an expression which does not involve
+   *          any batch as a `Vector2` or a `Vector3` depending on its
+   *          dimension.
+   */
+  template <typename Derived>
+  constexpr auto
+  evaluate(const expr::Expression<Derived>& expression) noexcept;
+
+  /**
+   * @brief - Computes the value of each element of `expression` into
+   *          `out`. Only the first `min(out.size(), expression.size())`
+   *          elements are computed, which is all of them for expressions
+   *          without batches.
+   */
+  template <typename CoordinateType, typename Derived>
+  void
+  assign(Vector2Batch<CoordinateType>& out,
+         const expr::Expression<Derived>& expression) noexcept;
+
+}
+
+# include "VectorExpression.hxx"
+
+#endif    /* VECTOR_EXPRESSION_HH */
@@ -0,0 +1,446 @@
+#ifndef    VECTOR_EXPRESSION_HXX
+# define   VECTOR_EXPRESSION_HXX
+
+# include <algorithm>
+# include "VectorExpression.hh"
+
+namespace utils {
+  namespace expr {
+
+    struct AddOperation {
+      template <typename CoordinateType>
+      static
+      constexpr CoordinateType
+      apply(const CoordinateType& lhs, const CoordinateType& rhs) noexcept {
+        return lhs + rhs;
+      }
+
+# if defined(MATHS_UTILS_SIMD)
+      static
+      simd::FloatPack
+      applyPack(simd::FloatPack lhs, simd::FloatPack rhs) noexcept {
+        return simd::add(lhs, rhs);
+      }
+# endif
+    };
+
+    struct SubOperation {
+      template <typename CoordinateType>
+      static
+      constexpr CoordinateType
+      apply(const CoordinateType& lhs, const CoordinateType& rhs) noexcept {
+        return lhs - rhs;
+      }
+
+# if defined(MATHS_UTILS_SIMD)
+      static
+      simd::FloatPack
+      applyPack(simd::FloatPack lhs, simd::FloatPack rhs) noexcept {
+        return simd::sub(lhs, rhs);
+      }
+# endif
+    };
+
+    template <typename CoordinateType, std::size_t Dimension>
+    inline
+    constexpr
+    VectorLeaf<CoordinateType, Dimension>::VectorLeaf(const Vector2<CoordinateType>& vec) noexcept:
+      m_coords{vec.x(), vec.y()}
+    {
+      static_assert(Dimension == 2u, "A Vector2 can only be captured by a leaf of dimension 2");
+    }
+
+    template <typename CoordinateType, std::size_t Dimension>
+    inline
+    constexpr
+    VectorLeaf<CoordinateType, Dimension>::VectorLeaf(const Vector3<CoordinateType>& vec) noexcept:
+      m_coords{vec.x(), vec.y(), vec.z()}
+    {
+      static_assert(Dimension == 3u, "A Vector3 can only be captured by a leaf of dimension 3");
+    }
+
+    template <typename CoordinateType, std::size_t Dimension>
+    inline
+    constexpr std::size_t
+    VectorLeaf<CoordinateType, Dimension>::size() const noexcept {
+      return kBroadcast;
+    }
+
+    template <typename CoordinateType, std::size_t Dimension>
+    template <std::size_t Axis>
+    inline
+    constexpr CoordinateType
+    VectorLeaf<CoordinateType, Dimension>::eval(std::size_t /*id*/) const noexcept {
+      return m_coords[Axis];
+    }
+
+# if defined(MATHS_UTILS_SIMD)
+    template <typename CoordinateType, std::size_t Dimension>
+    template <std::size_t Axis>
+    inline
+    simd::FloatPack
+    VectorLeaf<CoordinateType, Dimension>::evalPack(std::size_t /*id*/) const noexcept {
+      return simd::broadcast(m_coords[Axis]);
+    }
+# endif
+
+    template <typename CoordinateType>
+    inline
+    BatchLeaf<CoordinateType>::BatchLeaf(const Vector2Batch<CoordinateType>& batch) noexcept:
+      m_x(batch.x()),
+      m_y(batch.y()),
+      m_size(batch.size())
+    {}
+
+    template <typename CoordinateType>
+    inline
+    std::size_t
+    BatchLeaf<CoordinateType>::size() const noexcept {
+      return m_size;
+    }
+
+    template <typename CoordinateType>
+    template <std::size_t Axis>
+    inline
+    CoordinateType
+    BatchLeaf<CoordinateType>::eval(std::size_t id) const noexcept {
+      return (Axis == 0u ? m_x : m_y)[id];
+    }
+
+# if defined(MATHS_UTILS_SIMD)
+    template <typename CoordinateType>
+    template <std::size_t Axis>
+    inline
+    simd::FloatPack
+    BatchLeaf<CoordinateType>::evalPack(std::size_t id) const noexcept {
+      return simd::load((Axis == 0u ? m_x : m_y) + id);
+    }
+# endif
+
+    template <typename Operation, typename Lhs, typename Rhs>
+    inline
+    constexpr
+    Binary<Operation, Lhs, Rhs>::Binary(const Lhs& lhs, const Rhs& rhs) noexcept:
+      m_lhs(lhs),
+      m_rhs(rhs)
+    {}
+
+    template <typename Operation, typename Lhs, typename Rhs>
+    inline
+    constexpr std::size_t
+    Binary<Operation, Lhs, Rhs>::size() const noexcept {
+      return std::min(m_lhs.size(), m_rhs.size());
+    }
+
+    template <typename Operation, typename Lhs, typename Rhs>
+    template <std::size_t Axis>
+    inline
+    constexpr typename Binary<Operation, Lhs, Rhs>::ValueType
+    Binary<Operation, Lhs, Rhs>::eval(std::size_t id) const noexcept {
+      return Operation::apply(m_lhs.template eval<Axis>(id), m_rhs.template eval<Axis>(id));
+    }
+
+# if defined(MATHS_UTILS_SIMD)
+    template <typename Operation, typename Lhs, typename Rhs>
+    template <std::size_t Axis>
+    inline
+    simd::FloatPack
+    Binary<Operation, Lhs, Rhs>::evalPack(std::size_t id) const noexcept {
+      return Operation::applyPack(m_lhs.template evalPack<Axis>(id), m_rhs.template evalPack<Axis>(id));
+    }
+# endif
+
+    template <typename Operand, bool Divide>
+    inline
+    constexpr
+    Scale<Operand, Divide>::Scale(const Operand& operand, const ValueType& scale) noexcept:
+      m_operand(operand),
+      m_scale(scale)
+    {}
+
+    template <typename Operand, bool Divide>
+    inline
+    constexpr std::size_t
+    Scale<Operand, Divide>::size() const noexcept {
+      return m_operand.size();
+    }
+
+    template <typename Operand, bool Divide>
+    template <std::size_t Axis>
+    inline
+    constexpr typename Scale<Operand, Divide>::ValueType
+    Scale<Operand, Divide>::eval(std::size_t id) const noexcept {
+      // Divisions are kept as is rather than multiplying by the inverse so
+      // that the results match the ones of `Vector2::operator/`.
+      return (Divide ?
+        m_operand.template eval<Axis>(id) / m_scale :
+        m_operand.template eval<Axis>(id) * m_scale
+      );
+    }
+
+# if defined(MATHS_UTILS_SIMD)
+    template <typename Operand, bool Divide>
+    template <std::size_t Axis>
+    inline
+    simd::FloatPack
+    Scale<Operand, Divide>::evalPack(std::size_t id) const noexcept {
+      return (Divide ?
+        simd::div(m_operand.template evalPack<Axis>(id), simd::broadcast(m_scale)) :
+        simd::mul(m_operand.template evalPack<Axis>(id), simd::broadcast(m_scale))
+      );
+    }
+# endif
+
+    template <typename Operand>
+    inline
+    constexpr
+    Negate<Operand>::Negate(const Operand& operand) noexcept:
+      m_operand(operand)
+    {}
+
+    template <typename Operand>
+    inline
+    constexpr std::size_t
+    Negate<Operand>::size() const noexcept {
+      return m_operand.size();
+    }
+
+    template <typename Operand>
+    template <std::size_t Axis>
+    inline
+    constexpr typename Negate<Operand>::ValueType
+    Negate<Operand>::eval(std::size_t id) const noexcept {
+      return -m_operand.template eval<Axis>(id);
+    }
+
+# if defined(MATHS_UTILS_SIMD)
+    template <typename Operand>
+    template <std::size_t Axis>
+    inline
+    simd::FloatPack
+    Negate<Operand>::evalPack(std::size_t id) const noexcept {
+      // Flipping the sign is exact, just like the scalar negation.
+      return simd::mul(m_operand.template evalPack<Axis>(id), simd::broadcast(-1.0f));
+    }
+# endif
+
+    template <typename Lhs, typename Rhs>
+    inline
+    constexpr Binary<AddOperation, Lhs, Rhs>
+    operator+(const Expression<Lhs>& lhs, const Expression<Rhs>& rhs) noexcept {
+      return Binary<AddOperation, Lhs, Rhs>(lhs.derived(), rhs.derived());
+    }
+
+    template <typename Lhs, typename Rhs>
+    inline
+    constexpr Binary<SubOperation, Lhs, Rhs>
+    operator-(const Expression<Lhs>& lhs, const Expression<Rhs>& rhs) noexcept {
+      return Binary<SubOperation, Lhs, Rhs>(lhs.derived(), rhs.derived());
+    }
+
+    template <typename Operand>
+    inline
+    constexpr Negate<Operand>
+    operator-(const Expression<Operand>& operand) noexcept {
+      return Negate<Operand>(operand.derived());
+    }
+
+    template <typename Operand>
+    inline
+    constexpr Scale<Operand, false>
+    operator*(const Expression<Operand>& operand, const typename Operand::ValueType& scale) noexcept {
+      return Scale<Operand, false>(operand.derived(), scale);
+    }
+
+    template <typename Operand>
+    inline
+    constexpr Scale<Operand, false>
+    operator*(const typename Operand::ValueType& scale, const Expression<Operand>& operand) noexcept {
+      return Scale<Operand, false>(operand.derived(), scale);
+    }
+
+    template <typename Operand>
+    inline
+    constexpr Scale<Operand, true>
+    operator/(const Expression<Operand>& operand, const typename Operand::ValueType& scale) noexcept {
+      return Scale<Operand, true>(operand.derived(), scale);
+    }
+
+    template <typename Lhs, typename CoordinateType>
+    inline
+    constexpr Binary<AddOperation, Lhs, VectorLeaf<CoordinateType, 2u>>
+    operator+(const Expression<Lhs>& lhs, const Vector2<CoordinateType>& rhs) noexcept {
+      return lhs + lazy(rhs);
+    }
+
+    template <typename Rhs, typename CoordinateType>
+    inline
+    constexpr Binary<AddOperation, VectorLeaf<CoordinateType, 2u>, Rhs>
+    operator+(const Vector2<CoordinateType>& lhs, const Expression<Rhs>& rhs) noexcept {
+      return lazy(lhs) + rhs;
+    }
+
+    template <typename Lhs, typename CoordinateType>
+    inline
+    constexpr Binary<SubOperation, Lhs, VectorLeaf<CoordinateType, 2u>>
+    operator-(const Expression<Lhs>& lhs, const Vector2<CoordinateType>& rhs) noexcept {
+      return lhs - lazy(rhs);
+    }
+
+    template <typename Rhs, typename CoordinateType>
+    inline
+    constexpr Binary<SubOperation, VectorLeaf<CoordinateType, 2u>, Rhs>
+    operator-(const Vector2<CoordinateType>& lhs, const Expression<Rhs>& rhs) noexcept {
+      return lazy(lhs) - rhs;
+    }
+
+    template <typename Lhs, typename CoordinateType>
+    inline
+    constexpr Binary<AddOperation, Lhs, VectorLeaf<CoordinateType, 3u>>
+    operator+(const Expression<Lhs>& lhs, const Vector3<CoordinateType>& rhs) noexcept {
+      return lhs + lazy(rhs);
+    }
+
+    template <typename Rhs, typename CoordinateType>
+    inline
+    constexpr Binary<AddOperation, VectorLeaf<CoordinateType, 3u>, Rhs>
+    operator+(const Vector3<CoordinateType>& lhs, const Expression<Rhs>& rhs) noexcept {
+      return lazy(lhs) + rhs;
+    }
+
+    template <typename Lhs, typename CoordinateType>
+    inline
+    constexpr Binary<SubOperation, Lhs, VectorLeaf<CoordinateType, 3u>>
+    operator-(const Expression<Lhs>& lhs, const Vector3<CoordinateType>& rhs) noexcept {
+      return lhs - lazy(rhs);
+    }
+
+    template <typename Rhs, typename CoordinateType>
+    inline
+    constexpr Binary<SubOperation, VectorLeaf<CoordinateType, 3u>, Rhs>
+    operator-(const Vector3<CoordinateType>& lhs, const Expression<Rhs>& rhs) noexcept {
+      return lazy(lhs) - rhs;
+    }
+
+  }
+
+  namespace details {
+
+    template <typename CoordinateType, typename Derived>
+    inline
+    void
+    assignKernel(CoordinateType* x,
+                 CoordinateType* y,
+                 const Derived& expression,
+                 std::size_t start,
+                 std::size_t count) noexcept
+    {
+      for (std::size_t id = start ; id < count ; ++id) {
+        x[id] = expression.template eval<0u>(id);
+      }
+      for (std::size_t id = start ; id < count ; ++id) {
+        y[id] = expression.template eval<1u>(id);
+      }
+    }
+
+    template <typename CoordinateType, typename Derived>
+    inline
+    void
+    assignKernel(CoordinateType* x,
+                 CoordinateType* y,
+                 const Derived& expression,
+                 std::size_t count,
+                 std::false_type /*vectorized*/) noexcept
+    {
+      assignKernel(x, y, expression, 0u, count);
+    }
+
+# if defined(MATHS_UTILS_SIMD)
+
+    template <typename Derived>
+    inline
+    void
+    assignKernel(float* x,
+                 float* y,
+                 const Derived& expression,
+                 std::size_t count,
+                 std::true_type /*vectorized*/) noexcept
+    {
+      // Each element only depends on the same element of the operands so
+      // the output can be one of them.
+      std::size_t id = 0u;
+      for ( ; id + simd::kFloatWidth <= count ; id += simd::kFloatWidth) {
+        simd::store(x + id, expression.template evalPack<0u>(id));
+        simd::store(y + id, expression.template evalPack<1u>(id));
+      }
+
+      assignKernel(x, y, expression, id, count);
+    }
+
+# endif
+
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr expr::VectorLeaf<CoordinateType, 2u>
+  lazy(const Vector2<CoordinateType>& vec) noexcept {
+    return expr::VectorLeaf<CoordinateType, 2u>(vec);
+  }
+
+  template <typename CoordinateType>
+  inline
+  constexpr expr::VectorLeaf<CoordinateType, 3u>
+  lazy(const Vector3<CoordinateType>& vec) noexcept {
+    return expr::VectorLeaf<CoordinateType, 3u>(vec);
+  }
+
+  template <typename CoordinateType>
+  inline
+  expr::BatchLeaf<CoordinateType>
+  lazy(const Vector2Batch<CoordinateType>& batch) noexcept {
+    return expr::BatchLeaf<CoordinateType>(batch);
+  }
+
+  template <typename Derived>
+  inline
+  constexpr auto
+  evaluate(const expr::Expression<Derived>& expression) noexcept {
+    using CoordinateType = typename Derived::ValueType;
+    const Derived& e = expression.derived();
+
+    if constexpr (Derived::kDimension == 2u) {
+      return Vector2<CoordinateType>(e.template eval<0u>(0u), e.template eval<1u>(0u));
+    }
+    else {
+      return Vector3<CoordinateType>(e.template eval<0u>(0u), e.template eval<1u>(0u), e.template eval<2u>(0u));
+    }
+  }
+
+  template <typename CoordinateType, typename Derived>
+  inline
+  void
+  assign(Vector2Batch<CoordinateType>& out,
+         const expr::Expression<Derived>& expression) noexcept
+  {
+    static_assert(Derived::kDimension == 2u, "Only expressions of dimension 2 can be assigned to a batch");
+    static_assert(
+      std::is_same<CoordinateType, typename Derived::ValueType>::value,
+      "Expressions can only be assigned to batches with the same coordinate type"
+    );
+
+    const Derived& e = expression.derived();
+    const std::size_t count = std::min(out.size(), e.size());
+
+    details::assignKernel(
+      out.x(),
+      out.y(),
+      e,
+      count,
+      std::integral_constant<bool, simd::Pack<CoordinateType>::supported && std::is_same<CoordinateType, float>::value>()
+    );
+  }
+
+}
+
+#endif    /* VECTOR_EXPRESSION_HXX */
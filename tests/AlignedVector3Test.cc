@@ -0,0 +1,219 @@
+# include <cmath>
+# include <limits>
+# include <random>
+# include <vector>
+# include <cstdint>
+# include <cstring>
+# include <gtest/gtest.h>
+# include "AlignedVector3.hh"
+# include "Vector3.hh"
+
+namespace utils {
+  namespace {
+
+    // The vectorized operations of `AlignedVector3` are expected to give
+    // exactly the same results as the scalar ones of `Vector3f`: values
+    // are compared bit for bit, any NaN being considered equal to any
+    // other (their payload depends on the instructions used).
+    bool
+    sameBits(float lhs, float rhs) noexcept {
+      if (std::isnan(lhs) || std::isnan(rhs)) {
+        return std::isnan(lhs) && std::isnan(rhs);
+      }
+
+      std::uint32_t l, r;
+      std::memcpy(&l, &lhs, sizeof(float));
+      std::memcpy(&r, &rhs, sizeof(float));
+
+      return l == r;
+    }
+
+    ::testing::AssertionResult
+    sameBits(const AlignedVector3& lhs, const Vector3f& rhs) {
+      if (sameBits(lhs.x(), rhs.x()) && sameBits(lhs.y(), rhs.y()) && sameBits(lhs.z(), rhs.z())) {
+        return ::testing::AssertionSuccess();
+      }
+
+      return ::testing::AssertionFailure()
+        << "(" << lhs.x() << ", " << lhs.y() << ", " << lhs.z() << ") != "
+        << "(" << rhs.x() << ", " << rhs.y() << ", " << rhs.z() << ")";
+    }
+
+    const std::vector<float> kEdgeValues = {
+      0.0f,
+      -0.0f,
+      1.0f,
+      -1.0f,
+      std::numeric_limits<float>::min(),
+      std::numeric_limits<float>::denorm_min(),
+      -1.0e-40f,
+      3.0e-39f,
+      1.0e18f,
+      -1.0e19f,
+      1.0e30f,
+      -3.0e38f,
+      std::numeric_limits<float>::max(),
+      -std::numeric_limits<float>::max(),
+    };
+
+    /**
+     * @brief - Random vectors with moderate coordinates followed by vectors
+     *          built from the edge values: null coordinates, denormals and
+     *          large magnitudes which overflow when multiplied.
+     */
+    std::vector<Vector3f>
+    testVectors() {
+      std::mt19937 rng(2024u);
+      std::uniform_real_distribution<float> coord(-1000.0f, 1000.0f);
+      std::uniform_int_distribution<std::size_t> edge(0u, kEdgeValues.size() - 1u);
+
+      std::vector<Vector3f> out;
+      for (unsigned id = 0u ; id < 2000u ; ++id) {
+        out.emplace_back(coord(rng), coord(rng), coord(rng));
+      }
+      for (unsigned id = 0u ; id < 2000u ; ++id) {
+        out.emplace_back(kEdgeValues[edge(rng)], kEdgeValues[edge(rng)], kEdgeValues[edge(rng)]);
+      }
+      for (float value : kEdgeValues) {
+        out.emplace_back(value, value, value);
+      }
+
+      return out;
+    }
+
+    std::vector<float>
+    testScales() {
+      std::vector<float> out = kEdgeValues;
+      out.push_back(0.5f);
+      out.push_back(-3.75f);
+      out.push_back(1.0f / 3.0f);
+
+      return out;
+    }
+
+  }
+
+  TEST(AlignedVector3, UsesExpectedImplementation) {
+# if defined(MATHS_UTILS_SIMD)
+    EXPECT_TRUE(MATHS_UTILS_TESTS_EXPECT_SIMD);
+# else
+    EXPECT_FALSE(MATHS_UTILS_TESTS_EXPECT_SIMD);
+# endif
+  }
+
+  TEST(AlignedVector3, RoundTrip) {
+    for (const Vector3f& v : testVectors()) {
+      EXPECT_TRUE(sameBits(AlignedVector3(v), v));
+      EXPECT_TRUE(sameBits(AlignedVector3(v.x(), v.y(), v.z()), AlignedVector3(v).toVector3()));
+    }
+  }
+
+  TEST(AlignedVector3, AddAndSubtract) {
+    const std::vector<Vector3f> vectors = testVectors();
+
+    for (std::size_t id = 0u ; id < vectors.size() ; ++id) {
+      const Vector3f& lhs = vectors[id];
+      const Vector3f& rhs = vectors[(id * 7u + 3u) % vectors.size()];
+      const AlignedVector3 a(lhs);
+      const AlignedVector3 b(rhs);
+
+      EXPECT_TRUE(sameBits(a + b, lhs + rhs));
+      EXPECT_TRUE(sameBits(a - b, lhs - rhs));
+      EXPECT_TRUE(sameBits(-a, -lhs));
+
+      AlignedVector3 sum(a);
+      sum += b;
+      Vector3f expectedSum(lhs);
+      expectedSum += rhs;
+      EXPECT_TRUE(sameBits(sum, expectedSum));
+
+      AlignedVector3 diff(a);
+      diff -= b;
+      Vector3f expectedDiff(lhs);
+      expectedDiff -= rhs;
+      EXPECT_TRUE(sameBits(diff, expectedDiff));
+    }
+  }
+
+  TEST(AlignedVector3, Scale) {
+    for (const Vector3f& v : testVectors()) {
+      const AlignedVector3 a(v);
+
+      for (float scale : testScales()) {
+        EXPECT_TRUE(sameBits(a * scale, v * scale));
+        EXPECT_TRUE(sameBits(a / scale, v / scale));
+
+        AlignedVector3 scaled(a);
+        scaled *= scale;
+        Vector3f expected(v);
+        expected *= scale;
+        EXPECT_TRUE(sameBits(scaled, expected));
+
+        AlignedVector3 divided(a);
+        divided /= scale;
+        Vector3f expectedDivided(v);
+        expectedDivided /= scale;
+        EXPECT_TRUE(sameBits(divided, expectedDivided));
+      }
+    }
+  }
+
+  TEST(AlignedVector3, DotProduct) {
+    const std::vector<Vector3f> vectors = testVectors();
+
+    for (std::size_t id = 0u ; id < vectors.size() ; ++id) {
+      const Vector3f& lhs = vectors[id];
+      const Vector3f& rhs = vectors[(id * 13u + 5u) % vectors.size()];
+
+      EXPECT_TRUE(sameBits(AlignedVector3(lhs) * AlignedVector3(rhs), lhs * rhs));
+      EXPECT_TRUE(sameBits(AlignedVector3(lhs).lengthSquared(), lhs.lengthSquared()));
+      EXPECT_TRUE(sameBits(AlignedVector3(lhs).length(), lhs.length()));
+    }
+  }
+
+  TEST(AlignedVector3, CrossProduct) {
+    const std::vector<Vector3f> vectors = testVectors();
+
+    for (std::size_t id = 0u ; id < vectors.size() ; ++id) {
+      const Vector3f& lhs = vectors[id];
+      const Vector3f& rhs = vectors[(id * 11u + 1u) % vectors.size()];
+
+      EXPECT_TRUE(sameBits(AlignedVector3(lhs) ^ AlignedVector3(rhs), lhs ^ rhs));
+    }
+  }
+
+  TEST(AlignedVector3, Normalize) {
+    for (const Vector3f& v : testVectors()) {
+      AlignedVector3 a(v);
+      Vector3f expected(v);
+
+      EXPECT_TRUE(sameBits(a.normalize(), expected.normalize()));
+      EXPECT_TRUE(sameBits(a, expected));
+
+      AlignedVector3 b(v);
+      Vector3f expectedB(v);
+      EXPECT_TRUE(sameBits(b.normalized(), expectedB.normalized()));
+    }
+  }
+
+  // `Vector3::operator*=` used to leave the z coordinate untouched.
+  TEST(Vector3, ScaleInPlaceScalesAllCoordinates) {
+    Vector3f v(1.0f, -2.0f, 3.0f);
+    v *= 2.5f;
+
+    EXPECT_EQ(v.x(), 2.5f);
+    EXPECT_EQ(v.y(), -5.0f);
+    EXPECT_EQ(v.z(), 7.5f);
+
+    for (const Vector3f& w : testVectors()) {
+      Vector3f scaled(w);
+      scaled *= -3.75f;
+      EXPECT_TRUE(sameBits(AlignedVector3(scaled), w * -3.75f));
+    }
+
+    Vector3i i(4, 5, 6);
+    i *= 3;
+    EXPECT_EQ(i, Vector3i(12, 15, 18));
+  }
+
+}
@@ -0,0 +1,63 @@
+# include <limits>
+# include <random>
+# include <cstdint>
+# include <gtest/gtest.h>
+# include "Box.hh"
+# include "Size.hh"
+# include "Fixed.hh"
+
+namespace utils {
+  namespace {
+
+    template <int IntBits, int FracBits>
+    void
+    checkDivision() {
+      using Value = Fixed<IntBits, FracBits>;
+
+      std::mt19937 rng(5u);
+      std::uniform_int_distribution<std::int32_t> raw(
+        std::numeric_limits<std::int32_t>::min(),
+        std::numeric_limits<std::int32_t>::max()
+      );
+
+      for (unsigned id = 0u ; id < 200000u ; ++id) {
+        const std::int32_t lhs = raw(rng);
+        const std::int32_t rhs = raw(rng) >> (id % 31u);
+        if (rhs == 0) {
+          continue;
+        }
+
+        const std::int64_t expected = (std::int64_t(lhs) * Value::kOne) / rhs;
+        const Value quotient = Value::fromRaw(lhs) / Value::fromRaw(rhs);
+        ASSERT_EQ(quotient.raw(), static_cast<std::int32_t>(static_cast<std::uint32_t>(expected)))
+          << lhs << " / " << rhs;
+      }
+    }
+
+  }
+
+  // The quotient used to always be computed with doubles, which is not
+  // exact anymore once the dividend does not fit in 53 bits.
+  TEST(Fixed, DivisionMatchesIntegerDivision) {
+    checkDivision<16, 16>();
+    checkDivision<11, 21>();
+    checkDivision<10, 22>();
+    checkDivision<4, 28>();
+    checkDivision<2, 30>();
+  }
+
+  // Supporting fixed point dimensions made the scaling go through `float`
+  // for all types, losing the precision of `double` ones.
+  TEST(Fixed, ScaleKeepsPrecision) {
+    const double width = 16777217.25;
+
+    EXPECT_EQ(Size<double>(width, 3.0) * 2.0f, Size<double>(2.0 * width, 6.0));
+    EXPECT_EQ(Box<double>(1.0, 2.0, width, 3.0).scale(0.5f), Box<double>(1.0, 2.0, 0.5 * width, 1.5));
+    EXPECT_EQ(Size<int>(7, 3) * 1.5f, Size<int>(10, 4));
+
+    const Fixed16 dim = Fixed16::fromRaw(0x1ffffff2);
+    EXPECT_EQ((Size<Fixed16>(dim, dim) * 0.5f).w(), Fixed16::fromRaw(0x0ffffff9));
+    EXPECT_EQ(Box<Fixed16>(Fixed16(1), Fixed16(2), dim, dim).scale(0.5f).h(), Fixed16::fromRaw(0x0ffffff9));
+  }
+
+}
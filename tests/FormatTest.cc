@@ -0,0 +1,60 @@
+# include <limits>
+# include <string>
+# include <sstream>
+# include <cstdint>
+# include <gtest/gtest.h>
+# include "Box.hh"
+# include "Size.hh"
+# include "Bounds.hh"
+# include "Vector2.hh"
+# include "Vector3.hh"
+# include "AlignedVector3.hh"
+
+namespace utils {
+  namespace {
+
+    template <typename Primitive>
+    void
+    checkText(const Primitive& value, std::size_t count, const std::string& prefix) {
+      const std::string text = value.toString();
+
+      EXPECT_EQ(text.compare(0u, prefix.size(), prefix), 0) << text;
+      EXPECT_EQ(text.back(), ']') << text;
+      // Floating point values have at least 6 decimals.
+      EXPECT_GE(text.size(), prefix.size() + count * 7u) << text;
+
+      std::ostringstream out;
+      out << value;
+      EXPECT_EQ(out.str(), text);
+    }
+
+  }
+
+  // Large `double` values used not to fit in the fixed size buffer so that
+  // nothing was printed at all.
+  TEST(Format, LargeDoubles) {
+    const double big = std::numeric_limits<double>::max();
+
+    checkText(Vector2<double>(1.0e300, 1.0e300), 2u, "[Vector: 1000000000000000052504760255204420");
+    checkText(Vector3<double>(-big, big, -big), 3u, "[Vector: -1797693134862315");
+    checkText(Box<double>(-1.0e160, 1.0e160, 1.0e100, 1.0), 4u, "[Box: pos: -1000000000000000");
+    checkText(Size<double>(big, big), 2u, "[Size: 1797693134862315");
+    checkText(Bounds<double>(-big, -big, big, big), 4u, "[Bounds: min: -1797693134862315");
+  }
+
+  TEST(Format, Extremes) {
+    const float big = std::numeric_limits<float>::max();
+
+    checkText(Vector2f(-big, big), 2u, "[Vector: -3402823466385288");
+    checkText(AlignedVector3(-big, big, -big), 3u, "[Vector: -3402823466385288");
+    checkText(Box<std::int64_t>(std::numeric_limits<std::int64_t>::min(), 0, 1, 2), 0u, "[Box: pos: -9223372036854775808x0, dims: 1x2]");
+  }
+
+  TEST(Format, BufferSize) {
+    EXPECT_GE(formatBufferSize<float>(4u), kFormatBufferSize / 2u);
+    EXPECT_LE(formatBufferSize<float>(4u), kFormatBufferSize);
+    EXPECT_LE(formatBufferSize<int>(4u), kFormatBufferSize);
+    EXPECT_GT(formatBufferSize<double>(1u), 309u);
+  }
+
+}
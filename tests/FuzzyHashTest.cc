@@ -0,0 +1,106 @@
+# include <cmath>
+# include <limits>
+# include <random>
+# include <vector>
+# include <gtest/gtest.h>
+# include "FuzzyHash.hh"
+
+namespace utils {
+  namespace {
+
+    template <typename T>
+    std::vector<Vector2<T>>
+    bruteDedupe(const std::vector<Vector2<T>>& values, T epsilon) {
+      const FuzzyHash<T> hasher(epsilon);
+
+      std::vector<Vector2<T>> out;
+      for (const Vector2<T>& value : values) {
+        bool duplicate = false;
+        for (std::size_t id = 0u ; id < out.size() && !duplicate ; ++id) {
+          duplicate = hasher.equal(out[id], value);
+        }
+        if (!duplicate) {
+          out.push_back(value);
+        }
+      }
+
+      return out;
+    }
+
+    template <typename T>
+    void
+    checkDedupe(std::vector<Vector2<T>> values, T epsilon) {
+      const std::vector<Vector2<T>> expected = bruteDedupe(values, epsilon);
+
+      values.resize(dedupe(values.data(), values.size(), epsilon));
+      ASSERT_EQ(values.size(), expected.size());
+      for (std::size_t id = 0u ; id < values.size() ; ++id) {
+        EXPECT_EQ(values[id].x(), expected[id].x());
+        EXPECT_EQ(values[id].y(), expected[id].y());
+      }
+    }
+
+    template <typename T>
+    std::size_t
+    probes(T x, T y, T epsilon = std::numeric_limits<T>::min()) {
+      std::size_t hashes[FuzzyHash<T>::kMaxProbes];
+      return FuzzyHash<T>(epsilon).probe(Vector2<T>(x, y), hashes);
+    }
+
+  }
+
+  // With the default tolerance the scaled coordinates used to overflow to
+  // infinity: all the values ended up in the same cell and deduplicating
+  // them was quadratic.
+  TEST(FuzzyHash, DefaultToleranceIsExact) {
+    EXPECT_EQ(probes(12.5, -3000.0), 1u);
+    EXPECT_EQ(probes(1.0e300, 7.0), 1u);
+    EXPECT_EQ(probes(12.5f, -3000.0f), 1u);
+    EXPECT_EQ(probes(1.0e-30f, 7.0f), 1u);
+    EXPECT_EQ(probes(std::numeric_limits<double>::infinity(), std::nan("")), 1u);
+
+    std::size_t lhs[FuzzyHash<double>::kMaxProbes];
+    std::size_t rhs[FuzzyHash<double>::kMaxProbes];
+    FuzzyHash<double>().probe(Vector2<double>(-0.0, 1.0), lhs);
+    FuzzyHash<double>().probe(Vector2<double>(0.0, 1.0), rhs);
+    EXPECT_EQ(lhs[0u], rhs[0u]);
+  }
+
+  TEST(FuzzyHash, DedupeDefaultTolerance) {
+    std::mt19937 rng(3u);
+    std::uniform_real_distribution<double> coord(-1000.0, 1000.0);
+
+    std::vector<Vector2<double>> values;
+    for (unsigned id = 0u ; id < 40000u ; ++id) {
+      values.emplace_back(coord(rng), coord(rng));
+    }
+    // Duplicates of the first values.
+    for (unsigned id = 0u ; id < 1000u ; ++id) {
+      values.push_back(values[id * 7u]);
+    }
+
+    std::vector<Vector2<double>> deduped = values;
+    deduped.resize(dedupe(deduped.data(), deduped.size()));
+    ASSERT_EQ(deduped.size(), 40000u);
+    for (std::size_t id = 0u ; id < deduped.size() ; ++id) {
+      EXPECT_EQ(deduped[id], values[id]);
+    }
+  }
+
+  TEST(FuzzyHash, DedupeMatchesBruteForce) {
+    std::mt19937 rng(11u);
+    std::uniform_real_distribution<float> coord(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> tiny(-1.0e-37f, 1.0e-37f);
+
+    std::vector<Vector2f> values;
+    for (unsigned id = 0u ; id < 2000u ; ++id) {
+      values.emplace_back(coord(rng), coord(rng));
+      values.emplace_back(tiny(rng), tiny(rng));
+    }
+
+    checkDedupe(values, 0.05f);
+    checkDedupe(values, 1.0e-38f);
+    checkDedupe(values, std::numeric_limits<float>::min());
+  }
+
+}
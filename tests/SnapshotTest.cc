@@ -0,0 +1,70 @@
+# include <limits>
+# include <vector>
+# include <string>
+# include <cstdint>
+# include <sstream>
+# include <gtest/gtest.h>
+# include "Snapshot.hh"
+
+namespace utils {
+  namespace {
+
+    std::string
+    withCount(std::string snapshot, std::uint64_t count) {
+      std::uint8_t bytes[sizeof(count)];
+      encodeLittleEndian(bytes, count);
+      snapshot.replace(16u, sizeof(count), reinterpret_cast<const char*>(bytes), sizeof(count));
+
+      return snapshot;
+    }
+
+    bool
+    read(const std::string& snapshot, std::vector<Boxf>& out) {
+      std::istringstream in(snapshot);
+      return readSnapshot(in, out);
+    }
+
+  }
+
+  TEST(Snapshot, RoundTrip) {
+    std::vector<Boxf> boxes;
+    for (int id = 0 ; id < 100000 ; ++id) {
+      boxes.emplace_back(0.5f * id, -1.0f * id, 2.0f, 3.0f + id);
+    }
+
+    std::ostringstream out;
+    ASSERT_TRUE(writeSnapshot(out, boxes));
+
+    std::vector<Boxf> read;
+    ASSERT_TRUE(utils::read(out.str(), read));
+    EXPECT_EQ(read, boxes);
+  }
+
+  // The count of the header used to be trusted to size the output: huge
+  // values threw and the number of bytes to read could overflow.
+  TEST(Snapshot, CorruptedCount) {
+    const std::vector<Boxf> boxes(3u, Boxf(1.0f, 2.0f, 3.0f, 4.0f));
+
+    std::ostringstream out;
+    ASSERT_TRUE(writeSnapshot(out, boxes));
+
+    std::vector<Boxf> read(2u);
+    EXPECT_FALSE(utils::read(withCount(out.str(), 4u), read));
+    EXPECT_TRUE(read.empty());
+
+    const std::uint64_t counts[] = {
+      std::uint64_t(1u) << 40u,
+      std::uint64_t(1u) << 60u,
+      (std::numeric_limits<std::uint64_t>::max() / sizeof(Boxf)) + 1u,
+      std::numeric_limits<std::uint64_t>::max()
+    };
+    for (std::uint64_t count : counts) {
+      EXPECT_FALSE(utils::read(withCount(out.str(), count), read)) << count;
+      EXPECT_TRUE(read.empty());
+    }
+
+    ASSERT_TRUE(utils::read(withCount(out.str(), 2u), read));
+    EXPECT_EQ(read, std::vector<Boxf>(boxes.begin(), boxes.begin() + 2));
+  }
+
+}
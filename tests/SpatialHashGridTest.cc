@@ -0,0 +1,107 @@
+# include <cmath>
+# include <limits>
+# include <random>
+# include <vector>
+# include <algorithm>
+# include <gtest/gtest.h>
+# include "SpatialHashGrid.hh"
+
+namespace utils {
+  namespace {
+
+    std::vector<std::size_t>
+    bruteInRadius(const std::vector<Vector2f>& points, const Vector2f& p, float r) {
+      std::vector<std::size_t> out;
+      for (std::size_t id = 0u ; id < points.size() ; ++id) {
+        if (d2(p, points[id]) <= r * r) {
+          out.push_back(id);
+        }
+      }
+
+      return out;
+    }
+
+    std::vector<float>
+    bruteNearest(const std::vector<Vector2f>& points, const Vector2f& p, std::size_t k) {
+      std::vector<float> out;
+      for (const Vector2f& q : points) {
+        out.push_back(d2(p, q));
+      }
+      std::sort(out.begin(), out.end());
+      out.resize(std::min(k, out.size()));
+
+      return out;
+    }
+
+    void
+    checkQueries(const std::vector<Vector2f>& points,
+                 const SpatialHashGridf& grid,
+                 const Vector2f& p,
+                 float r,
+                 std::size_t k)
+    {
+      std::vector<std::size_t> found;
+      grid.inRadius(p, r, found);
+      std::sort(found.begin(), found.end());
+      EXPECT_EQ(found, bruteInRadius(points, p, r));
+
+      grid.nearest(p, k, found);
+      std::vector<float> distances;
+      for (std::size_t id : found) {
+        distances.push_back(d2(p, points[id]));
+      }
+      EXPECT_EQ(distances, bruteNearest(points, p, k));
+    }
+
+  }
+
+  TEST(SpatialHashGrid, MatchesBruteForce) {
+    std::mt19937 rng(7u);
+    std::uniform_real_distribution<float> coord(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> radius(0.0f, 300.0f);
+
+    std::vector<Vector2f> points;
+    for (unsigned id = 0u ; id < 3000u ; ++id) {
+      points.emplace_back(coord(rng), coord(rng));
+    }
+
+    SpatialHashGridf grid(10.0f);
+    grid.rebuild(points, 1u);
+
+    for (unsigned id = 0u ; id < 200u ; ++id) {
+      checkQueries(points, grid, Vector2f(coord(rng), coord(rng)), radius(rng), 1u + id % 17u);
+    }
+  }
+
+  // Queries used to visit every cell in range, empty or not: with cells
+  // of size 1 between these two points they took about a second each.
+  TEST(SpatialHashGrid, SparsePointsInLargeRange) {
+    const std::vector<Vector2f> points = {Vector2f(0.0f, 0.0f), Vector2f(16000.0f, 16000.0f)};
+
+    SpatialHashGridf grid(1.0f);
+    grid.rebuild(points, 1u);
+
+    for (unsigned id = 0u ; id < 100u ; ++id) {
+      checkQueries(points, grid, Vector2f(1.0f, 2.0f), 30000.0f, 1u);
+      checkQueries(points, grid, Vector2f(15000.0f, 14000.0f), 25000.0f, 2u);
+    }
+  }
+
+  TEST(SpatialHashGrid, HugeCoordinates) {
+    const float big = std::numeric_limits<float>::max();
+    const std::vector<Vector2f> points = {
+      Vector2f(0.0f, 0.0f),
+      Vector2f(big, -big),
+      Vector2f(-1.0e20f, 3.0e12f),
+      Vector2f(1.0f, 1.0f),
+    };
+
+    SpatialHashGridf grid(0.5f);
+    grid.rebuild(points, 1u);
+
+    checkQueries(points, grid, Vector2f(0.0f, 0.0f), 10.0f, 2u);
+    checkQueries(points, grid, Vector2f(-1.0e20f, 3.0e12f), 1.0f, 1u);
+    checkQueries(points, grid, Vector2f(2.0e9f, 0.0f), 1.0e10f, 3u);
+  }
+
+}